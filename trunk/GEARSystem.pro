@@ -39,52 +39,90 @@ INCLUDEPATH *= include
 HEADERS     += include/GEARSystem/namespace.hh \
                include/GEARSystem/CORBAImplementations/corbaradiosensor.hh \
                include/GEARSystem/gearsystem.hh \
+               include/GEARSystem/lockpolicy.hh \
                include/GEARSystem/Types/types.hh \
+               include/GEARSystem/Types/actuatorownership.hh \
                include/GEARSystem/Types/angle.hh \
                include/GEARSystem/Types/angularspeed.hh \
                include/GEARSystem/Types/field.hh \
                include/GEARSystem/Types/goal.hh \
+               include/GEARSystem/Types/idbitmap.hh \
+               include/GEARSystem/Types/playerdistance.hh \
+               include/GEARSystem/Types/playerstate.hh \
                include/GEARSystem/Types/position.hh \
+               include/GEARSystem/Types/robotcommand.hh \
                include/GEARSystem/Types/velocity.hh \
                include/GEARSystem/Types/team.hh \
+               include/GEARSystem/Types/trajectoryhistory.hh \
+               include/GEARSystem/Types/trajectorysample.hh \
+               include/GEARSystem/Types/worldupdate.hh \
                include/GEARSystem/CORBAImplementations/corbainterfaces.hh \
                include/GEARSystem/CORBAImplementations/corbaactuator.hh \
                include/GEARSystem/CORBAImplementations/corbacommandbus.hh \
+               include/GEARSystem/CORBAImplementations/corbaworldlistener.hh \
                include/GEARSystem/CORBAImplementations/corbacontroller.hh \
                include/GEARSystem/CORBAImplementations/corbasensor.hh \
                include/GEARSystem/actuator.hh \
+               include/GEARSystem/actuatorworker.hh \
                include/GEARSystem/controller.hh \
                include/GEARSystem/radiosensor.hh \
                include/GEARSystem/sensor.hh \
                include/GEARSystem/server.hh \
                include/GEARSystem/commandbus.hh \
-               include/GEARSystem/worldmap.hh
-
-SOURCES     += src/GEARSystem/Types/angle.cc \
+               include/GEARSystem/commandcoalescer.hh \
+               include/GEARSystem/worldmap.hh \
+               include/GEARSystem/worldsnapshot.hh \
+               include/GEARSystem/worldlistener.hh \
+               include/GEARSystem/motionmodel.hh \
+               include/GEARSystem/batchgeometry.hh \
+               include/GEARSystem/worldpublisher.hh \
+               include/GEARSystem/worldingest.hh \
+               include/GEARSystem/sharedworld.hh
+
+SOURCES     += src/GEARSystem/Types/actuatorownership.cc \
+               src/GEARSystem/Types/angle.cc \
                src/GEARSystem/radiosensor.cc \
                src/GEARSystem/CORBAImplementations/corbaradiosensor.cc \
                src/GEARSystem/Types/angularspeed.cc \
                src/GEARSystem/Types/field.cc \
                src/GEARSystem/Types/goal.cc \
+               src/GEARSystem/Types/idbitmap.cc \
+               src/GEARSystem/Types/playerdistance.cc \
+               src/GEARSystem/Types/playerstate.cc \
                src/GEARSystem/Types/position.cc \
+               src/GEARSystem/Types/robotcommand.cc \
                src/GEARSystem/Types/velocity.cc \
                src/GEARSystem/Types/team.cc \
+               src/GEARSystem/Types/trajectoryhistory.cc \
+               src/GEARSystem/Types/trajectorysample.cc \
+               src/GEARSystem/Types/worldupdate.cc \
                src/GEARSystem/CORBAImplementations/corbainterfacesSK.cc \
                src/GEARSystem/CORBAImplementations/corbaactuator.cc \
                src/GEARSystem/CORBAImplementations/corbacommandbus.cc \
+               src/GEARSystem/CORBAImplementations/corbaworldlistener.cc \
                src/GEARSystem/CORBAImplementations/corbacontroller.cc \
                src/GEARSystem/CORBAImplementations/corbasensor.cc \
                src/GEARSystem/actuator.cc \
+               src/GEARSystem/actuatorworker.cc \
                src/GEARSystem/controller.cc \
                src/GEARSystem/sensor.cc \
                src/GEARSystem/server.cc \
                src/GEARSystem/commandbus.cc \
-               src/GEARSystem/worldmap.cc
+               src/GEARSystem/commandcoalescer.cc \
+               src/GEARSystem/worldmap.cc \
+               src/GEARSystem/worldsnapshot.cc \
+               src/GEARSystem/worldlistener.cc \
+               src/GEARSystem/motionmodel.cc \
+               src/GEARSystem/batchgeometry.cc \
+               src/GEARSystem/worldpublisher.cc \
+               src/GEARSystem/worldingest.cc \
+               src/GEARSystem/sharedworld.cc
 
 OTHER_FILES += README.txt \
                pre-build.sh \
                build/corba_skeletons.sh \
                include/GEARSystem/CORBAImplementations/corbainterfaces.idl \
+               include/GEARSystem/lockconfig.hh.in \
                install.sh
 
 
@@ -106,8 +144,18 @@ contains(debug_msg, true):  DEFINES += GSDEBUGMSG
 contains(debug_msg, false): DEFINES -= GSDEBUGMSG
 
 
-# Thread-safe configuration
-#count(thread-safe, 0):        DEFINES -= GSTHREADSAFE
-#contains(thread-safe, true):  DEFINES += GSTHREADSAFE
-#contains(thread-safe, false): DEFINES -= GSTHREADSAFE
-DEFINES -= GSTHREADSAFE
+# SIMD kernels configuration (the instruction set follows 'arch', e.g. arch=native)
+contains(simd, false): DEFINES += GSNOSIMD
+
+
+# Lock policy configuration (none, mutex, spin or readwrite, the default). It is written to a header in the build
+# dir, installed with the others by install.sh, since the lock is part of the layout of public classes
+GSLOCKPOLICY = GSLOCKPOLICY_READWRITE
+contains(lock_policy, none):  GSLOCKPOLICY = GSLOCKPOLICY_NONE
+contains(lock_policy, mutex): GSLOCKPOLICY = GSLOCKPOLICY_MUTEX
+contains(lock_policy, spin):  GSLOCKPOLICY = GSLOCKPOLICY_SPIN
+
+lockconfig.input  = $$PWD/include/GEARSystem/lockconfig.hh.in
+lockconfig.output = $$OUT_PWD/tmp/include/GEARSystem/lockconfig.hh
+QMAKE_SUBSTITUTES += lockconfig
+INCLUDEPATH       *= $$OUT_PWD/tmp/include
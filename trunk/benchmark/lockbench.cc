@@ -0,0 +1,198 @@
+/*** GEARSystem - Lock policies benchmark
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Includes GEARSystem
+#include <GEARSystem/lockpolicy.hh>
+
+// Inlcudes Qt library
+#include <QtCore/QtCore>
+
+// Inlcudes IO streams
+#include <iostream>
+#include <iomanip>
+
+
+// Selects namespace
+using namespace GEARSystem;
+using std::cout;
+using std::endl;
+using std::setw;
+
+
+/*** 'Guarded' class
+  ** Description: A value guarded like the world state (a position read and written under a lock)
+  ** Comments:    The value is volatile, so reads without a lock aren't hoisted out of the loops
+  ***/
+template <class LockType>
+class Guarded {
+    public:
+        LockType       lock;
+        volatile float value[3];
+
+        Guarded() { value[0] = value[1] = value[2] = 0.0f; }
+
+        float read() {
+            BasicReadLocker<LockType> locker(lock);
+            return(value[0] + value[1] + value[2]);
+        }
+
+        void write(float x) {
+            BasicWriteLocker<LockType> locker(lock);
+            value[0] = x;
+            value[1] = x;
+            value[2] = x;
+        }
+};
+
+
+/*** 'Reader' class
+  ** Description: A thread that reads a guarded value until told to stop
+  ***/
+template <class LockType>
+class Reader : public QThread {
+    private:
+        Guarded<LockType>* _guarded;
+        QAtomicInt*        _stop;
+        qint64             _reads;
+        float              _sum;
+
+    public:
+        Reader(Guarded<LockType>* guarded, QAtomicInt* stop) : _guarded(guarded), _stop(stop), _reads(0), _sum(0.0f) {}
+
+        qint64 reads() const { return(_reads); }
+        float  sum() const   { return(_sum); }
+
+    protected:
+        void run() {
+            while (_stop->loadAcquire() == 0) {
+                _sum += _guarded->read();
+                _reads++;
+            }
+        }
+};
+
+
+// Keeps the compiler from dropping the reads
+static volatile float sink;
+
+
+/*** 'uncontended' function
+  ** Description: Measures a read and a write of a single thread
+  ** Receives:    [iterations] The number of reads and of writes
+                  [readNs]     The time of a read, in nanoseconds
+                  [writeNs]    The time of a write, in nanoseconds
+  ** Returns:     Nothing
+  ***/
+template <class LockType>
+void uncontended(int iterations, double* readNs, double* writeNs) {
+    Guarded<LockType> guarded;
+    QElapsedTimer timer;
+
+    float sum = 0.0f;
+    timer.start();
+    for (int i = 0; i < iterations; i++) {
+        sum += guarded.read();
+    }
+    *readNs = static_cast<double>(timer.nsecsElapsed())/iterations;
+    sink = sum;
+
+    timer.start();
+    for (int i = 0; i < iterations; i++) {
+        guarded.write(static_cast<float>(i));
+    }
+    *writeNs = static_cast<double>(timer.nsecsElapsed())/iterations;
+}
+
+/*** 'contended' function
+  ** Description: Measures the reads of several threads while another one writes at the vision rate
+  ** Receives:    [readers]  The number of reader threads
+                  [duration] The duration, in milliseconds
+  ** Returns:     The reads per millisecond of all the readers
+  ***/
+template <class LockType>
+double contended(int readers, int duration) {
+    Guarded<LockType> guarded;
+    QAtomicInt stop(0);
+
+    QList<Reader<LockType>*> threads;
+    for (int i = 0; i < readers; i++) {
+        threads.append(new Reader<LockType>(&guarded, &stop));
+        threads.last()->start();
+    }
+
+    // Writes a frame every millisecond
+    QElapsedTimer timer;
+    timer.start();
+    for (int frame = 0; timer.elapsed() < duration; frame++) {
+        guarded.write(static_cast<float>(frame));
+        QThread::usleep(1000);
+    }
+    stop.storeRelease(1);
+
+    qint64 reads = 0;
+    float  sum   = 0.0f;
+    for (int i = 0; i < threads.size(); i++) {
+        (void) threads.at(i)->wait();
+        reads += threads.at(i)->reads();
+        sum   += threads.at(i)->sum();
+    }
+    qDeleteAll(threads);
+    sink = sum;
+
+    return(static_cast<double>(reads)/duration);
+}
+
+/*** 'report' function
+  ** Description: Runs and prints the measures of a policy
+  ** Receives:    [name]       The policy name
+                  [iterations] The number of uncontended reads and writes
+                  [readers]    The number of reader threads (0 to skip the contended measure)
+                  [duration]   The duration of the contended measure, in milliseconds
+  ** Returns:     Nothing
+  ***/
+template <class LockType>
+void report(const char* name, int iterations, int readers, int duration) {
+    double readNs, writeNs;
+    uncontended<LockType>(iterations, &readNs, &writeNs);
+
+    cout << setw(10) << name << setw(12) << readNs << setw(12) << writeNs;
+    if (readers > 0) {
+        cout << setw(16) << contended<LockType>(readers, duration);
+    }
+    else {
+        cout << setw(16) << "-";
+    }
+    cout << endl;
+}
+
+
+/*** 'main' function
+  ** Description: Compares the lock policies
+  ** Receives:    [argv[1]] The number of uncontended reads and writes (10000000 if not given)
+                  [argv[2]] The number of reader threads of the contended measure (3 if not given)
+                  [argv[3]] The duration of the contended measure, in milliseconds (1000 if not given)
+  ** Returns:     0
+  ** Comments:    The no-lock policy isn't measured with several threads, since it isn't safe there
+  ***/
+int main(int argc, char** argv) {
+    const int iterations = (argc > 1)? atoi(argv[1]) : 10000000;
+    const int readers    = (argc > 2)? atoi(argv[2]) : 3;
+    const int duration   = (argc > 3)? atoi(argv[3]) : 1000;
+
+    cout << std::fixed << std::setprecision(1);
+    cout << ">> GEARSystem: Lock policies benchmark (" << QThread::idealThreadCount() << " cores, ";
+    cout << readers << " readers, a write per millisecond)" << endl;
+    cout << setw(10) << "policy" << setw(12) << "read ns" << setw(12) << "write ns" << setw(16) << "reads/ms" << endl;
+
+    report<NoLock>("none", iterations, 0, duration);
+    report<MutexLock>("mutex", iterations, readers, duration);
+    report<SpinLock>("spin", iterations, readers, duration);
+    report<ReadWriteLock>("readwrite", iterations, readers, duration);
+
+    return(0);
+}
@@ -0,0 +1,35 @@
+# GEARSystem - Lock policies benchmark project file
+# GEAR - Grupo de Estudos Avancados em Robotica
+# Department of Electrical Engineering, University of Sao Paulo
+# http://www.sel.eesc.usp.br/gear
+# This file is part of the GEARSystem project
+
+
+# Application info
+TEMPLATE = app
+DESTDIR  = .
+TARGET   = lockbench
+CONFIG  += c++14 console release
+CONFIG  -= app_bundle
+
+
+# Qt info
+QT -= gui
+
+
+# Temporary dirs
+OBJECTS_DIR = tmp/obj
+
+
+# Compilation flags
+QMAKE_CXXFLAGS_RELEASE = -O2
+count(arch, 1) {
+    QMAKE_CXXFLAGS_RELEASE += -march=$$arch
+}
+
+
+# Project files (the policies are defined in the headers, so only the library lock configuration is needed;
+# run the library qmake first, so 'tmp/include/GEARSystem/lockconfig.hh' exists)
+INCLUDEPATH *= ../include ../tmp/include
+
+SOURCES     += lockbench.cc
@@ -59,6 +59,13 @@ class GEARSystem::CORBAImplementations::Actuator : public POA_GEARSystem::CORBAI
           ***/
         virtual void setSpeed(Octet teamNum, Octet playerNum, Float x, Float y, Float theta);
 
+        /*** 'setSpeeds'
+          ** Description: Sets the speed of several players at once
+          ** Receives:    [commands] The speed commands
+          ** Returns:     Nothing
+          ***/
+        virtual void setSpeeds(const CORBATypes::RobotCommandSeq& commands);
+
         /*** 'kick'
           ** Description: Activates the player kicking device
           ** Receives:    [teamNum]   The team number
@@ -108,6 +115,21 @@ class GEARSystem::CORBAImplementations::Actuator : public POA_GEARSystem::CORBAI
           ** Returns:     Nothing
           ***/
         virtual void holdBall(Octet teamNum, Octet playerNum, Boolean enable);
+
+
+    public:
+        /*** Asynchronous commands
+          ** Description: Oneway versions of the commands above; the caller doesn't wait for a reply
+          ** Receives:    The same arguments of the synchronous commands
+          ** Returns:     Nothing
+          ***/
+        virtual void setSpeedAsync(Octet teamNum, Octet playerNum, Float x, Float y, Float theta);
+        virtual void setSpeedsAsync(const CORBATypes::RobotCommandSeq& commands);
+        virtual void kickAsync(Octet teamNum, Octet playerNum, Float power);
+        virtual void chipKickAsync(Octet teamNum, Octet playerNum, Float power);
+        virtual void kickOnTouchAsync(Octet teamNum, Octet playerNum, Boolean enable, Float power);
+        virtual void chipKickOnTouchAsync(Octet teamNum, Octet playerNum, Boolean enable, Float power);
+        virtual void holdBallAsync(Octet teamNum, Octet playerNum, Boolean enable);
 };
 
 
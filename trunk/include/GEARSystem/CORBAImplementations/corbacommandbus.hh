@@ -39,11 +39,12 @@ class GEARSystem::CORBAImplementations::CommandBus : public POA_GEARSystem::CORB
     public:
         /*** 'addActuator'
           ** Description: Adds an actuator to the server
-          ** Receives:    [name]    The actuator name
-                          [address] The actuator corba address
+          ** Receives:    [name]      The actuator name
+                          [address]   The actuator corba address
+                          [ownership] The teams and players the actuator drives
           ** Returns:     Nothing
           ***/
-        virtual void addActuator(const char* name, const char* address);
+        virtual void addActuator(const char* name, const char* address, const CORBATypes::TeamOwnershipSeq& ownership);
 
         /*** 'delActuator'
           ** Description: Deletes an actuator from the server
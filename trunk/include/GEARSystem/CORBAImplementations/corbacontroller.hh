@@ -16,6 +16,7 @@
 #include <GEARSystem/Types/types.hh>
 #include <GEARSystem/commandbus.hh>
 #include <GEARSystem/worldmap.hh>
+#include <GEARSystem/worldpublisher.hh>
 #include <GEARSystem/CORBAImplementations/corbainterfaces.hh>
 
 
@@ -41,6 +42,9 @@ class GEARSystem::CORBAImplementations::Controller : public POA_GEARSystem::CORB
         const WorldMap*   _worldMap;
         const GEARSystem::CommandBus* _commandBus;
 
+        // Frames publisher
+        WorldPublisher* _publisher;
+
 
     public:
         /*** Constructor
@@ -50,6 +54,21 @@ class GEARSystem::CORBAImplementations::Controller : public POA_GEARSystem::CORB
           ***/
         Controller(const WorldMap* worldMap, const GEARSystem::CommandBus* commandBus);
 
+        /*** Destructor
+          ** Description: Destroys the controller
+          ** Receives:    Nothing
+          ***/
+        ~Controller();
+
+
+    public:
+        /*** 'worldMap' function
+          ** Description: Gets the world map the controller reads from
+          ** Receives:    Nothing
+          ** Returns:     The world map
+          ***/
+        const WorldMap* worldMap() const;
+
 
     public:
         /*** 'teamName' function
@@ -70,35 +89,40 @@ class GEARSystem::CORBAImplementations::Controller : public POA_GEARSystem::CORB
 
         /*** 'teams' function
           ** Description: Gets the created teams
-          ** Receives:    [teamsStr] A reference to where the stringfied teams list will be stored
-                          [nGEARSystemTeams]   A reference to where the number of teams will be stored
-                          [hasGEARSystemTeam0] A reference to where the GEARSystemTeam #0 flag will be stored
+          ** Receives:    [teams]         Where the teams bitmap will be stored
+                          [rosterVersion] A reference to where the roster version will be stored
           ** Returns:     Nothing
           ***/
-        virtual void teams(String_out teamsStr, Octet& nGEARSystemTeams, Boolean& hasGEARSystemTeam0);
+        virtual void teams(CORBATypes::IdBitmap teams, CORBA::ULongLong& rosterVersion);
 
 
     public:
         /*** 'players' function
           ** Description: Gets the created players
-          ** Receives:    [teamNum]    The team number
-                          [playersStr] A reference to where the stringfied players list will be stored
-                          [nPlayers]   A reference to where the number of players will be stored
-                          [hasPlayer0] A reference to where the Player #0 flag will be stored
+          ** Receives:    [teamNum]       The team number
+                          [players]       Where the players bitmap will be stored
+                          [rosterVersion] A reference to where the roster version will be stored
           ** Returns:     Nothing
           ***/
-        virtual void players(Octet teamNum, String_out playersStr, Octet& nPlayers, Boolean& hasPlayer0);
+        virtual void players(Octet teamNum, CORBATypes::IdBitmap players, CORBA::ULongLong& rosterVersion);
 
 
     public:
         /*** 'balls' function
           ** Description: Gets the created balls
-          ** Receives:    [ballsStr] A reference to where the stringfied balls list will be stored
-                          [nBalls]   A reference to where the number of balls will be stored
-                          [hasBall0] A reference to where the Ball #0 flag will be stored
+          ** Receives:    [balls]         Where the balls bitmap will be stored
+                          [rosterVersion] A reference to where the roster version will be stored
           ** Returns:     Nothing
           ***/
-        virtual void balls(String_out ballsStr, Octet& nBalls, Boolean& hasBall0);
+        virtual void balls(CORBATypes::IdBitmap balls, CORBA::ULongLong& rosterVersion);
+
+        /*** 'rosterChanged' function
+          ** Description: Verifies if teams, players or balls were added or removed after a roster version
+          ** Receives:    [sinceVersion]  The roster version the client has seen
+                          [rosterVersion] A reference to where the current roster version will be stored
+          ** Returns:     'true' if the roster changed, 'false' otherwise
+          ***/
+        virtual Boolean rosterChanged(CORBA::ULongLong sinceVersion, CORBA::ULongLong& rosterVersion);
 
         /*** 'ballPosition' function
           ** Description: Gets the ball position
@@ -201,6 +225,74 @@ class GEARSystem::CORBAImplementations::Controller : public POA_GEARSystem::CORB
           ***/
         void capacitorCharge(Octet teamNum, Octet playerNum, unsigned char& charge);
 
+        /*** 'playerState' function
+          ** Description: Gets the whole player state in a single call
+          ** Receives:    [teamNum]   The team number
+                          [playerNum] The player number
+                          [state]     The player state
+          ** Returns:     'true' if the player exists, 'false' otherwise
+          ***/
+        Boolean playerState(Octet teamNum, Octet playerNum, CORBATypes::PlayerState& state);
+
+
+    public:
+        /*** Positions at a time functions
+          ** Description: Gets a ball or player pose at a given capture time, interpolated from the history
+          ** Receives:    [ballNum]     The ball number
+                          [teamNum]     The team number
+                          [playerNum]   The player number
+                          [time]        The capture time, in seconds
+                          [position]    A reference to where the position will be stored
+                          [orientation] A reference to where the orientation will be stored
+          ** Returns:     Nothing
+          ***/
+        virtual void ballPositionAt(Octet ballNum, CORBA::Double time, CORBATypes::Position& position);
+        virtual void playerPositionAt(Octet teamNum, Octet playerNum, CORBA::Double time, CORBATypes::Position& position);
+        virtual void playerOrientationAt(Octet teamNum, Octet playerNum, CORBA::Double time, CORBATypes::Angle& orientation);
+
+        /*** Trajectory functions
+          ** Description: Gets the stored samples of a ball or player in a time interval
+          ** Receives:    [ballNum]   The ball number
+                          [teamNum]   The team number
+                          [playerNum] The player number
+                          [startTime] The interval start, in seconds
+                          [endTime]   The interval end, in seconds
+                          [samples]   A reference to where the samples will be stored
+          ** Returns:     Nothing
+          ***/
+        virtual void ballTrajectory(Octet ballNum, CORBA::Double startTime, CORBA::Double endTime, CORBATypes::TrajectorySampleSeq_out samples);
+        virtual void playerTrajectory(Octet teamNum, Octet playerNum, CORBA::Double startTime, CORBA::Double endTime, CORBATypes::TrajectorySampleSeq_out samples);
+
+        /*** Prediction functions
+          ** Description: Predicts a ball position or a player pose at a given capture time
+          ** Receives:    [ballNum]   The ball number
+                          [teamNum]   The team number
+                          [playerNum] The player number
+                          [time]      The capture time, in seconds
+                          [position]  A reference to where the position will be stored
+                          [pose]      A reference to where the pose will be stored
+          ** Returns:     Nothing
+          ***/
+        virtual void predictedBallPosition(Octet ballNum, CORBA::Double time, CORBATypes::Position& position);
+        virtual void predictedPlayerPose(Octet teamNum, Octet playerNum, CORBA::Double time, CORBATypes::TrajectorySample& pose);
+
+        /*** Spatial query functions
+          ** Description: Finds the players closest to a point, within a radius of a point, or within a radius of a
+                          segment
+          ** Receives:    [point]   The queried point
+                          [k]       The maximum number of players
+                          [radius]  The search radius
+                          [a]       The segment start
+                          [b]       The segment end
+                          [teams]   The teams searched (an empty bitmap searches all teams)
+                          [players] A reference to where the players will be stored
+          ** Returns:     Nothing
+          ***/
+        virtual void nearestPlayers(const CORBATypes::Position& point, CORBA::UShort k, const CORBATypes::IdBitmap teams, CORBATypes::PlayerDistanceSeq_out players);
+        virtual void playersWithinRadius(const CORBATypes::Position& point, CORBA::Float radius, const CORBATypes::IdBitmap teams, CORBATypes::PlayerDistanceSeq_out players);
+        virtual void segmentClearance(const CORBATypes::Position& a, const CORBATypes::Position& b, CORBA::Float radius, const CORBATypes::IdBitmap teams, CORBATypes::PlayerDistanceSeq_out players);
+
+
     public:
         /*** 'setSpeed'
           ** Description: Sets a player speed
@@ -213,6 +305,13 @@ class GEARSystem::CORBAImplementations::Controller : public POA_GEARSystem::CORB
           ***/
         virtual void setSpeed(Octet teamNum, Octet playerNum, Float x, Float y, Float theta);
 
+        /*** 'setSpeeds'
+          ** Description: Sets the speed of several players at once
+          ** Receives:    [commands] The speed commands
+          ** Returns:     Nothing
+          ***/
+        virtual void setSpeeds(const CORBATypes::RobotCommandSeq& commands);
+
         /*** 'kick'
           ** Description: Activates the player kicking device
           ** Receives:    [teamNum]   The team number
@@ -264,6 +363,21 @@ class GEARSystem::CORBAImplementations::Controller : public POA_GEARSystem::CORB
         virtual void holdBall(Octet teamNum, Octet playerNum, Boolean enable);
 
 
+    public:
+        /*** Asynchronous commands
+          ** Description: Oneway versions of the commands above; the caller doesn't wait for a reply
+          ** Receives:    The same arguments of the synchronous commands
+          ** Returns:     Nothing
+          ***/
+        virtual void setSpeedAsync(Octet teamNum, Octet playerNum, Float x, Float y, Float theta);
+        virtual void setSpeedsAsync(const CORBATypes::RobotCommandSeq& commands);
+        virtual void kickAsync(Octet teamNum, Octet playerNum, Float power);
+        virtual void chipKickAsync(Octet teamNum, Octet playerNum, Float power);
+        virtual void kickOnTouchAsync(Octet teamNum, Octet playerNum, Boolean enable, Float power);
+        virtual void chipKickOnTouchAsync(Octet teamNum, Octet playerNum, Boolean enable, Float power);
+        virtual void holdBallAsync(Octet teamNum, Octet playerNum, Boolean enable);
+
+
     public:
         /*** Field handling functions
           ** Description: Handles field info
@@ -281,6 +395,41 @@ class GEARSystem::CORBAImplementations::Controller : public POA_GEARSystem::CORB
         virtual void rightPenaltyMark(CORBATypes::Position& position);
 
         virtual void fieldCenterRadius(CORBA::Float& centerRadius);
+
+        /*** 'fieldGeometry' function
+          ** Description: Gets every field element and the geometry version in a single call
+          ** Receives:    [geometry] A reference to where the field geometry will be stored
+          ** Returns:     Nothing
+          ***/
+        virtual void fieldGeometry(CORBATypes::FieldGeometry& geometry);
+
+
+    public:
+        /*** 'worldState' function
+          ** Description: Gets every team, player and ball of the last published snapshot in a single call
+          ** Receives:    [state] A reference to where the world state will be stored
+          ** Returns:     Nothing
+          ***/
+        virtual void worldState(CORBATypes::WorldState_out state);
+
+        /*** 'versions' function
+          ** Description: Gets the world and field versions, so clients can tell if their copies are outdated
+          ** Receives:    [worldVersion]    A reference to where the world map version will be stored
+                          [geometryVersion] A reference to where the field version will be stored
+          ** Returns:     Nothing
+          ***/
+        virtual void versions(CORBA::ULongLong& worldVersion, CORBA::ULongLong& geometryVersion);
+
+
+    public:
+        /*** Subscription functions
+          ** Description: Adds or removes a remote listener that receives every committed frame
+          ** Receives:    [name]     The subscriber name
+                          [listener] The remote listener
+          ** Returns:     Nothing
+          ***/
+        virtual void subscribe(const char* name, CORBAInterfaces::WorldListener_ptr listener);
+        virtual void unsubscribe(const char* name);
 };
 
 
@@ -15,6 +15,7 @@
 #include <GEARSystem/namespace.hh>
 #include <GEARSystem/Types/types.hh>
 #include <GEARSystem/worldmap.hh>
+#include <GEARSystem/worldingest.hh>
 #include <GEARSystem/CORBAImplementations/corbainterfaces.hh>
 
 
@@ -25,8 +26,10 @@
 // Selects namespace
 using namespace GEARSystem;
 using CORBA::Boolean;
+using CORBA::Double;
 using CORBA::Float;
 using CORBA::Octet;
+using CORBA::ULong;
 
 
 /*** 'Sensor' class
@@ -38,13 +41,45 @@ class GEARSystem::CORBAImplementations::Sensor : public POA_GEARSystem::CORBAInt
         // World map
         WorldMap* _worldMap;
 
+        // Ingest stage (NULL if the updates are applied by the calling thread)
+        WorldIngest* _ingest;
+
 
     public:
-        /*** Constructor
+        /*** Constructors
           ** Description: Creates the sensor
-          ** Receives:    [worldMap] The world map the sensor will control
+          ** Receives:    [worldMap]       The world map the sensor will control
+                          [ingestCapacity] The queue capacity of an ingest stage that applies the ball, player and
+                                           frame changes from its own thread, or 0 to apply them on the calling
+                                           thread (the default)
           ***/
         Sensor(WorldMap* worldMap);
+        Sensor(WorldMap* worldMap, int ingestCapacity);
+
+        /*** Destructor
+          ** Description: Applies the queued changes and destroys the sensor
+          ** Receives:    Nothing
+          ***/
+        ~Sensor();
+
+
+    public:
+        /*** 'ingest' function
+          ** Description: Gets the ingest stage, to read its metrics
+          ** Receives:    Nothing
+          ** Returns:     The ingest stage, or NULL if there is none
+          ***/
+        WorldIngest* ingest() const;
+
+
+    private:
+        /*** 'toUpdates' function
+          ** Description: Converts the samples of a frame into world updates
+          ** Receives:    [players] The pose and velocities of each player seen
+                          [balls]   The position and velocity of each ball seen
+          ** Returns:     The updates
+          ***/
+        static QList<WorldUpdate> toUpdates(const CORBATypes::PlayerSampleSeq& players, const CORBATypes::BallSampleSeq& balls);
 
 
     public:
@@ -142,6 +177,32 @@ class GEARSystem::CORBAImplementations::Sensor : public POA_GEARSystem::CORBAInt
         void setBallPossession(Octet teamNum, Octet playerNum, bool possession);
 
 
+    public:
+        /*** Frames handling functions
+          ** Description: Groups the changes of a vision frame, applied at once on commit
+          ** Receives:    [frameId]     The frame number
+                          [captureTime] The frame capture time, in seconds
+                          [players]     The pose and velocities of players seen
+                          [balls]       The position and velocity of balls seen
+          ** Returns:     Nothing
+          ** Comments:    Only the samples staged with the frame number are held for the commit; the value setters
+                          are always applied right away
+          ***/
+        virtual void beginFrame(ULong frameId, Double captureTime);
+        virtual void stageSamples(ULong frameId, const CORBATypes::PlayerSampleSeq& players, const CORBATypes::BallSampleSeq& balls);
+        virtual void commitFrame(ULong frameId);
+
+        /*** 'pushFrame' function
+          ** Description: Applies a whole vision frame received in a single call
+          ** Receives:    [players]   The pose and velocities of each player seen
+                          [balls]     The position and velocity of each ball seen
+                          [frameInfo] The frame number and capture time
+          ** Returns:     Nothing
+          ** Comments:    Every value of the samples is set, invalid ones included
+          ***/
+        virtual void pushFrame(const CORBATypes::PlayerSampleSeq& players, const CORBATypes::BallSampleSeq& balls, const CORBATypes::FrameInfo& frameInfo);
+
+
     public:
         /*** Field handling functions
           ** Description: Handles field info
@@ -162,6 +223,13 @@ class GEARSystem::CORBAImplementations::Sensor : public POA_GEARSystem::CORBAInt
         virtual void setRightPenaltyMark(const CORBATypes::Position& position);
 
         virtual void setFieldCenterRadius(float centerRadius);
+
+        /*** 'setFieldGeometry' function
+          ** Description: Replaces every field element at once
+          ** Receives:    [geometry] The field geometry (its version is ignored)
+          ** Returns:     Nothing
+          ***/
+        virtual void setFieldGeometry(const CORBATypes::FieldGeometry& geometry);
 };
 
 
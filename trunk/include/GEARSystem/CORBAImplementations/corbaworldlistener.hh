@@ -0,0 +1,56 @@
+/*** GEARSystem - CORBA WorldListener class
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Prevents multiple definitions
+#ifndef GSCORBAWORLDLISTENER
+#define GSCORBAWORLDLISTENER
+
+
+// Includes GEARSystem
+#include <GEARSystem/namespace.hh>
+#include <GEARSystem/CORBAImplementations/corbainterfaces.hh>
+
+
+// Includes omniORB 4
+#include <omniORB4/CORBA.h>
+
+
+// Selects namespace
+using namespace GEARSystem;
+
+
+/*** 'WorldListener' class
+  ** Description: This class implements the WorldListener CORBA interface, receiving the frames pushed
+                  by the server to a subscribed controller
+  ** Comments:
+  ***/
+class GEARSystem::CORBAImplementations::WorldListener : public POA_GEARSystem::CORBAInterfaces::WorldListener {
+    private:
+        // Controller
+        GEARSystem::Controller* _controller;
+
+
+    public:
+        /*** Constructor
+          ** Description: Creates the listener
+          ** Receives:    [controller] The GEARSystem::Controller that receives the frames
+          ***/
+        WorldListener(GEARSystem::Controller* controller);
+
+
+    public:
+        /*** 'frameCommitted' function
+          ** Description: Receives a committed frame
+          ** Receives:    [state] The world state of the frame
+          ** Returns:     Nothing
+          ***/
+        virtual void frameCommitted(const CORBATypes::WorldState& state);
+};
+
+
+#endif
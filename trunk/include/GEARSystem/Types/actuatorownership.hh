@@ -0,0 +1,99 @@
+/*** GEARSystem - ActuatorOwnership class
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Prevents multiple definitions
+#ifndef GSACTUATOROWNERSHIP
+#define GSACTUATOROWNERSHIP
+
+
+// Includes GEARSystem
+#include <GEARSystem/namespace.hh>
+#include <GEARSystem/Types/idbitmap.hh>
+#include <GEARSystem/CORBAImplementations/corbainterfaces.hh>
+
+// Inlcudes Qt library
+#include <QtCore/QtCore>
+
+
+// Selects namespace
+using namespace GEARSystem;
+
+
+/*** 'ActuatorOwnership' class
+  ** Description: This class holds the teams and players an actuator drives, so the command bus
+                  only sends it their commands
+  ** Comments:    This class is reentrant, but it isn't thread-safe. An empty ownership owns every
+                  player, so actuators that don't declare any receive all the commands
+  ***/
+class GEARSystem::ActuatorOwnership {
+    private:
+        // Whole teams
+        IdBitmap _teams;
+
+        // Single players, by team
+        QHash<quint8,IdBitmap> _players;
+
+
+    public:
+        /*** Constructor
+          ** Description: Creates an empty ownership, which owns every player
+          ** Receives:    Nothing
+          ***/
+        ActuatorOwnership();
+
+        /*** Constructor
+          ** Description: Creates an ownership from a CORBA TeamOwnershipSeq
+          ** Receives:    [ownership] The CORBA TeamOwnershipSeq
+          ***/
+        ActuatorOwnership(const CORBATypes::TeamOwnershipSeq& ownership);
+
+
+    public:
+        /*** 'toCORBA' function
+          ** Description: Copies the ownership to a CORBA TeamOwnershipSeq
+          ** Receives:    [other] The CORBA TeamOwnershipSeq
+          ** Returns:     Nothing
+          ***/
+        void toCORBA(CORBATypes::TeamOwnershipSeq* other) const;
+
+
+    public:
+        /*** Ownership handling functions
+          ** Description: Adds a whole team or a single player to the ownership
+          ** Receives:    [teamNum]   The team number
+                          [playerNum] The player number
+          ** Returns:     Nothing
+          ***/
+        void addTeam(quint8 teamNum);
+        void addPlayer(quint8 teamNum, quint8 playerNum);
+
+        /*** 'clear' function
+          ** Description: Empties the ownership, so it owns every player again
+          ** Receives:    Nothing
+          ** Returns:     Nothing
+          ***/
+        void clear();
+
+        /*** 'isEmpty' function
+          ** Description: Verifies if no team or player was declared
+          ** Receives:    Nothing
+          ** Returns:     'true' if the ownership is empty (owns every player), 'false' otherwise
+          ***/
+        bool isEmpty() const;
+
+        /*** 'owns' function
+          ** Description: Verifies if a player is owned
+          ** Receives:    [teamNum]   The team number
+                          [playerNum] The player number
+          ** Returns:     'true' if the player is owned, 'false' otherwise
+          ***/
+        bool owns(quint8 teamNum, quint8 playerNum) const;
+};
+
+
+#endif
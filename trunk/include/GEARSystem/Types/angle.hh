@@ -15,6 +15,9 @@
 #include <GEARSystem/namespace.hh>
 #include <GEARSystem/CORBAImplementations/corbainterfaces.hh>
 
+// Inlcudes Qt library
+#include <QtCore/QtCore>
+
 
 /*** 'Angle' class
   ** Description: This class handles an angle measured in radians
@@ -40,6 +43,10 @@ class GEARSystem::Angle {
         bool _unknown;
         bool _valid;
 
+        // Capture info
+        quint32 _frameId;
+        double  _captureTime;
+
 
     public:
         /*** 'toRadians' function
@@ -163,6 +170,19 @@ class GEARSystem::Angle {
           ** Returns:     Nothing
           ***/
         void setInvalid();
+
+
+    public:
+        /*** Capture info functions
+          ** Description: Handles the vision frame that produced the angle
+          ** Receives:    [frameId]     The frame number
+                          [captureTime] The frame capture time, in seconds
+          ** Returns:     Nothing, or the requested info (0 if the angle wasn't produced by a frame)
+          ** Comments:    The capture info is kept when the value changes, and copied with it
+          ***/
+        void    setCapture(quint32 frameId, double captureTime);
+        quint32 frameId()     const;
+        double  captureTime() const;
 };
 
 
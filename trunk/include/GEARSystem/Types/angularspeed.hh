@@ -15,6 +15,9 @@
 #include <GEARSystem/namespace.hh>
 #include <GEARSystem/CORBAImplementations/corbainterfaces.hh>
 
+// Inlcudes Qt library
+#include <QtCore/QtCore>
+
 
 /*** 'AngularSpeed' class
   ** Description: This class handles an angular speed measured in radians per second
@@ -29,6 +32,10 @@ class GEARSystem::AngularSpeed {
         bool _unknown;
         bool _valid;
 
+        // Capture info
+        quint32 _frameId;
+        double  _captureTime;
+
 
     public:
         /*** Constructor
@@ -121,6 +128,19 @@ class GEARSystem::AngularSpeed {
           ** Returns:     Nothing
           ***/
         void setInvalid();
+
+
+    public:
+        /*** Capture info functions
+          ** Description: Handles the vision frame that produced the angular speed
+          ** Receives:    [frameId]     The frame number
+                          [captureTime] The frame capture time, in seconds
+          ** Returns:     Nothing, or the requested info (0 if the angular speed wasn't produced by a frame)
+          ** Comments:    The capture info is kept when the value changes, and copied with it
+          ***/
+        void    setCapture(quint32 frameId, double captureTime);
+        quint32 frameId()     const;
+        double  captureTime() const;
 };
 
 
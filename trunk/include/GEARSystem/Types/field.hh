@@ -13,6 +13,7 @@
 
 // Includes GEARSystem
 #include <GEARSystem/namespace.hh>
+#include <GEARSystem/lockpolicy.hh>
 //#include <GEARSystem/Types/types.hh>  // TODO: Fix includes conflict
 #include <GEARSystem/Types/position.hh>
 #include <GEARSystem/Types/goal.hh>
@@ -28,7 +29,8 @@ using namespace GEARSystem;
 
 /*** 'Field' class
   ** Description: This class handles information about all field elements
-  ** Comments:    This class is reentrant and thread-safe
+  ** Comments:    This class is reentrant and thread-safe. Copies are taken while holding every lock of the
+                  copied field, so a copy is a consistent, independent geometry
   ***/
 class GEARSystem::Field {
     private:
@@ -47,15 +49,13 @@ class GEARSystem::Field {
         Position _leftPenaltyMark;
         Position _rightPenaltyMark;
 
-        // Center radius
+        // Center radius (guarded by _cornersLock)
         float _centerRadius;
 
         // Locks
-        #ifdef GSTHREADSAFE
-        mutable QReadWriteLock* _goalsLock;
-        mutable QReadWriteLock* _cornersLock;
-        mutable QReadWriteLock* _penaltyLock;
-        #endif
+        mutable Lock _goalsLock;
+        mutable Lock _cornersLock;
+        mutable Lock _penaltyLock;
 
 
     public:
@@ -65,6 +65,18 @@ class GEARSystem::Field {
           ***/
         Field();
 
+        /*** Constructor
+          ** Description: Creates a field from a CORBA FieldGeometry
+          ** Receives:    [geometry] The CORBA FieldGeometry
+          ***/
+        Field(const CORBATypes::FieldGeometry& geometry);
+
+        /*** Copy constructor
+          ** Description: Creates a consistent copy of a field
+          ** Receives:    [other] The field
+          ***/
+        Field(const Field& other);
+
         /*** Destructor
           ** Description: Destroys the field
           ** Receives:    Nothing
@@ -72,6 +84,23 @@ class GEARSystem::Field {
         ~Field();
 
 
+    public:
+        /*** Assignment operator
+          ** Description: Replaces every field element at once
+          ** Receives:    [other] The field
+          ** Returns:     This field
+          ***/
+        Field& operator =(const Field& other);
+
+        /*** 'toCORBA' function
+          ** Description: Copies the field to a CORBA FieldGeometry
+          ** Receives:    [other] The CORBA FieldGeometry
+          ** Returns:     Nothing
+          ** Comments:    The geometry version is left to the caller
+          ***/
+        void toCORBA(CORBATypes::FieldGeometry* other) const;
+
+
     public:
         /*** Set/get functions
           ** Description: Handles field data
@@ -58,6 +58,21 @@ class GEARSystem::Goal {
           ***/
         Goal(const Position& leftPost, const Position& rightPost, float depth, float areaLength, float areaWidth, float areaRoundedRadius);
 
+        /*** Constructor
+          ** Description: Creates a goal from a CORBA GoalGeometry
+          ** Receives:    [goal] The CORBA GoalGeometry
+          ***/
+        Goal(const CORBATypes::GoalGeometry& goal);
+
+
+    public:
+        /*** 'toCORBA' function
+          ** Description: Copies the goal to a CORBA GoalGeometry
+          ** Receives:    [other] The CORBA GoalGeometry
+          ** Returns:     Nothing
+          ***/
+        void toCORBA(CORBATypes::GoalGeometry* other) const;
+
 
     public:
         /*** Positions handling function
@@ -0,0 +1,126 @@
+/*** GEARSystem - IdBitmap class
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Prevents multiple definitions
+#ifndef GSIDBITMAP
+#define GSIDBITMAP
+
+
+// Includes GEARSystem
+#include <GEARSystem/namespace.hh>
+#include <GEARSystem/CORBAImplementations/corbainterfaces.hh>
+
+
+// Inlcudes Qt library
+#include <QtCore/QtCore>
+
+
+// Selects namespace
+using namespace GEARSystem;
+
+
+/*** 'IdBitmap' class
+  ** Description: This class is a set of 8-bit ids (team, player or ball numbers) stored as a 256-bit map
+  ** Comments:    This class is reentrant, but it isn't thread-safe
+  ***/
+class GEARSystem::IdBitmap {
+    public:
+        // Map size
+        static const int nWords = 8;
+
+
+    private:
+        // Bits and number of set bits
+        quint32 _words[nWords];
+        int     _count;
+
+
+    public:
+        /*** Constructor
+          ** Description: Creates an empty bitmap
+          ** Receives:    Nothing
+          ***/
+        IdBitmap();
+
+        /*** Constructor
+          ** Description: Creates a bitmap from a CORBA IdBitmap
+          ** Receives:    [bitmap] The CORBA IdBitmap
+          ***/
+        IdBitmap(const CORBATypes::IdBitmap bitmap);
+
+
+    public:
+        /*** 'toCORBA' function
+          ** Description: Copies the bitmap to a CORBA IdBitmap
+          ** Receives:    [other] The CORBA IdBitmap
+          ** Returns:     Nothing
+          ***/
+        void toCORBA(CORBATypes::IdBitmap other) const;
+
+
+    public:
+        /*** Ids handling functions
+          ** Description: Adds, removes and checks an id
+          ** Receives:    [id] The id
+          ** Returns:     'set' and 'clear' return 'true' if the bitmap changed; 'test' returns 'true' if the id is set
+          ***/
+        bool set(quint8 id);
+        bool clear(quint8 id);
+        bool test(quint8 id) const;
+
+        /*** 'reset' function
+          ** Description: Removes all the ids
+          ** Receives:    Nothing
+          ** Returns:     Nothing
+          ***/
+        void reset();
+
+        /*** 'count' function
+          ** Description: Gets the number of ids set
+          ** Receives:    Nothing
+          ** Returns:     The number of ids
+          ***/
+        int count() const;
+
+        /*** 'isEmpty' function
+          ** Description: Verifies if there are no ids set
+          ** Receives:    Nothing
+          ** Returns:     'true' if the bitmap is empty, 'false' otherwise
+          ***/
+        bool isEmpty() const;
+
+        /*** 'toList' function
+          ** Description: Lists the ids set
+          ** Receives:    Nothing
+          ** Returns:     The ids, in ascending order
+          ***/
+        QList<quint8> toList() const;
+
+
+    public:
+        /*** Raw words handling functions
+          ** Description: Gets/sets a 32-bit word of the map (id 'n' is bit 'n%32' of word 'n/32')
+          ** Receives:    [index] The word index
+                          [value] The word value
+          ***/
+        quint32 word(int index) const;
+        void    setWord(int index, quint32 value);
+
+
+    public:
+        /*** Comparison operators
+          ** Description: Compares two bitmaps
+          ** Receives:    [other] The other bitmap
+          ** Returns:     'true' if the sets are (not) equal
+          ***/
+        bool operator ==(const IdBitmap& other) const;
+        bool operator !=(const IdBitmap& other) const;
+};
+
+
+#endif
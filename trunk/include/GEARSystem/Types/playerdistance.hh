@@ -0,0 +1,108 @@
+/*** GEARSystem - PlayerDistance class
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Prevents multiple definitions
+#ifndef GSPLAYERDISTANCE
+#define GSPLAYERDISTANCE
+
+
+// Includes GEARSystem
+#include <GEARSystem/namespace.hh>
+#include <GEARSystem/CORBAImplementations/corbainterfaces.hh>
+
+// Inlcudes Qt library
+#include <QtCore/QtCore>
+
+
+// Selects namespace
+using namespace GEARSystem;
+
+
+/*** 'PlayerDistance' class
+  ** Description: This class holds a player found by a spatial query and its distance to the queried point
+                  or segment
+  ** Comments:    This class is reentrant, but it isn't thread-safe
+  ***/
+class GEARSystem::PlayerDistance {
+    private:
+        // Player info
+        quint8 _teamNum;
+        quint8 _playerNum;
+
+        // Distance
+        float _distance;
+
+
+    public:
+        /*** Constructor
+          ** Description: Creates player 0 of team 0 at distance 0
+          ** Receives:    Nothing
+          ***/
+        PlayerDistance();
+
+        /*** Constructor
+          ** Description: Creates a player distance
+          ** Receives:    [teamNum]   The team number
+                          [playerNum] The player number
+                          [distance]  The distance
+          ***/
+        PlayerDistance(quint8 teamNum, quint8 playerNum, float distance);
+
+        /*** Constructor
+          ** Description: Creates a player distance from a CORBA PlayerDistance
+          ** Receives:    [playerDistance] The CORBA PlayerDistance
+          ***/
+        PlayerDistance(const CORBATypes::PlayerDistance& playerDistance);
+
+
+    public:
+        /*** 'toCORBA' function
+          ** Description: Copies the player distance to a CORBA PlayerDistance
+          ** Receives:    [other] The CORBA PlayerDistance
+          ** Returns:     Nothing
+          ***/
+        void toCORBA(CORBATypes::PlayerDistance* other) const;
+
+        /*** 'toCORBA' function
+          ** Description: Copies a list of player distances to a CORBA PlayerDistanceSeq
+          ** Receives:    [playerDistances] The player distances
+                          [other]           The CORBA PlayerDistanceSeq
+          ** Returns:     Nothing
+          ***/
+        static void toCORBA(const QList<PlayerDistance>& playerDistances, CORBATypes::PlayerDistanceSeq* other);
+
+        /*** 'fromCORBA' function
+          ** Description: Copies a CORBA PlayerDistanceSeq to a list of player distances
+          ** Receives:    [playerDistances] The CORBA PlayerDistanceSeq
+          ** Returns:     The player distances
+          ***/
+        static QList<PlayerDistance> fromCORBA(const CORBATypes::PlayerDistanceSeq& playerDistances);
+
+
+    public:
+        /*** '<' operator
+          ** Description: Compares the distances, so results can be sorted from the closest player
+          ** Receives:    [other] The other player distance
+          ** Returns:     'true' if this player is closer, 'false' otherwise
+          ***/
+        bool operator <(const PlayerDistance& other) const;
+
+
+    public:
+        /*** Info functions
+          ** Description: Gets the player distance info
+          ** Receives:    Nothing
+          ** Returns:     The requested info
+          ***/
+        quint8 teamNum()   const;
+        quint8 playerNum() const;
+        float  distance()  const;
+};
+
+
+#endif
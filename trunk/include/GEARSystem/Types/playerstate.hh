@@ -0,0 +1,126 @@
+/*** GEARSystem - PlayerState class
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Prevents multiple definitions
+#ifndef GSPLAYERSTATE
+#define GSPLAYERSTATE
+
+
+// Includes GEARSystem
+#include <GEARSystem/namespace.hh>
+#include <GEARSystem/Types/angle.hh>
+#include <GEARSystem/Types/angularspeed.hh>
+#include <GEARSystem/Types/position.hh>
+#include <GEARSystem/Types/velocity.hh>
+#include <GEARSystem/CORBAImplementations/corbainterfaces.hh>
+
+// Inlcudes Qt library
+#include <QtCore/QtCore>
+
+
+// Selects namespace
+using namespace GEARSystem;
+
+
+/*** 'PlayerState' class
+  ** Description: This class holds the whole state of a player (pose, velocities, flags and charges), read at once
+  ** Comments:    This class is reentrant, but it isn't thread-safe
+  ***/
+class GEARSystem::PlayerState {
+    private:
+        // Player info
+        quint8 _teamNum;
+        quint8 _playerNum;
+        bool   _valid;
+
+        // Pose and velocities
+        Position     _position;
+        Angle        _orientation;
+        Velocity     _velocity;
+        AngularSpeed _angularSpeed;
+
+        // Flags and charges
+        bool          _ballPossession;
+        bool          _kickEnabled;
+        bool          _dribbleEnabled;
+        unsigned char _batteryCharge;
+        unsigned char _capacitorCharge;
+
+
+    public:
+        /*** Constructor
+          ** Description: Creates the invalid state of a player that doesn't exist
+          ** Receives:    [teamNum]   The team number
+                          [playerNum] The player number
+          ***/
+        PlayerState();
+        PlayerState(quint8 teamNum, quint8 playerNum);
+
+        /*** Constructor
+          ** Description: Creates a player state
+          ** Receives:    [teamNum]         The team number
+                          [playerNum]       The player number
+                          [position]        The position
+                          [orientation]     The orientation
+                          [velocity]        The velocity
+                          [angularSpeed]    The angular speed
+                          [ballPossession]  'true' if the player has the ball
+                          [kickEnabled]     'true' if the kicking device is enabled
+                          [dribbleEnabled]  'true' if the dribbling device is enabled
+                          [batteryCharge]   The battery charge
+                          [capacitorCharge] The capacitor charge
+          ***/
+        PlayerState(quint8 teamNum, quint8 playerNum, const Position& position, const Angle& orientation,
+                    const Velocity& velocity, const AngularSpeed& angularSpeed, bool ballPossession, bool kickEnabled,
+                    bool dribbleEnabled, unsigned char batteryCharge, unsigned char capacitorCharge);
+
+        /*** Constructor
+          ** Description: Creates a player state from a CORBA PlayerState
+          ** Receives:    [state] The CORBA PlayerState
+          ** Comments:    The state is taken as valid, since the servers only send states of existing players
+          ***/
+        PlayerState(const CORBATypes::PlayerState& state);
+
+
+    public:
+        /*** 'toCORBA' function
+          ** Description: Copies the state to a CORBA PlayerState
+          ** Receives:    [other] The CORBA PlayerState
+          ** Returns:     Nothing
+          ***/
+        void toCORBA(CORBATypes::PlayerState* other) const;
+
+
+    public:
+        /*** 'isValid' function
+          ** Description: Verifies if the state belongs to an existing player
+          ** Receives:    Nothing
+          ** Returns:     'true' if it does, 'false' otherwise
+          ***/
+        bool isValid() const;
+
+        /*** Info functions
+          ** Description: Gets the player info
+          ** Receives:    Nothing
+          ** Returns:     The requested info
+          ***/
+        quint8              teamNum()         const;
+        quint8              playerNum()       const;
+        const Position&     position()        const;
+        const Angle&        orientation()     const;
+        const Velocity&     velocity()        const;
+        const AngularSpeed& angularSpeed()    const;
+        bool                ballPossession()  const;
+        bool                kickEnabled()     const;
+        bool                dribbleEnabled()  const;
+        unsigned char       batteryCharge()   const;
+        unsigned char       capacitorCharge() const;
+};
+
+
+#endif
@@ -15,6 +15,9 @@
 #include <GEARSystem/namespace.hh>
 #include <GEARSystem/CORBAImplementations/corbainterfaces.hh>
 
+// Inlcudes Qt library
+#include <QtCore/QtCore>
+
 
 /*** 'Position' class
   ** Description: This class handles a 3D coordinate
@@ -31,6 +34,10 @@ class GEARSystem::Position {
         bool _unknown;
         bool _valid;
 
+        // Capture info
+        quint32 _frameId;
+        double  _captureTime;
+
 
     public:
         /*** Constructor
@@ -122,6 +129,19 @@ class GEARSystem::Position {
           ** Returns:     Nothing
           ***/
         void setInvalid();
+
+
+    public:
+        /*** Capture info functions
+          ** Description: Handles the vision frame that produced the position
+          ** Receives:    [frameId]     The frame number
+                          [captureTime] The frame capture time, in seconds
+          ** Returns:     Nothing, or the requested info (0 if the position wasn't produced by a frame)
+          ** Comments:    The capture info is kept when the value changes, and copied with it
+          ***/
+        void    setCapture(quint32 frameId, double captureTime);
+        quint32 frameId()     const;
+        double  captureTime() const;
 };
 
 
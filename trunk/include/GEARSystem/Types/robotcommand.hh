@@ -0,0 +1,105 @@
+/*** GEARSystem - RobotCommand class
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Prevents multiple definitions
+#ifndef GSROBOTCOMMAND
+#define GSROBOTCOMMAND
+
+
+// Includes GEARSystem
+#include <GEARSystem/namespace.hh>
+#include <GEARSystem/CORBAImplementations/corbainterfaces.hh>
+
+// Inlcudes Qt library
+#include <QtCore/QtCore>
+
+
+// Selects namespace
+using namespace GEARSystem;
+
+
+/*** 'RobotCommand' class
+  ** Description: This class holds the speed command of a single player, so the commands of a whole
+                  team can be sent at once
+  ** Comments:    This class is reentrant, but it isn't thread-safe
+  ***/
+class GEARSystem::RobotCommand {
+    private:
+        // Player info
+        quint8 _teamNum;
+        quint8 _playerNum;
+
+        // Speed
+        float _x;
+        float _y;
+        float _theta;
+
+
+    public:
+        /*** Constructor
+          ** Description: Creates a null command for player 0 of team 0
+          ** Receives:    Nothing
+          ***/
+        RobotCommand();
+
+        /*** Constructor
+          ** Description: Creates a speed command
+          ** Receives:    [teamNum]   The team number
+                          [playerNum] The player number
+                          [x]         The x speed component
+                          [y]         The y speed component
+                          [theta]     The angular speed
+          ***/
+        RobotCommand(quint8 teamNum, quint8 playerNum, float x, float y, float theta);
+
+        /*** Constructor
+          ** Description: Creates a command from a CORBA RobotCommand
+          ** Receives:    [command] The CORBA RobotCommand
+          ***/
+        RobotCommand(const CORBATypes::RobotCommand& command);
+
+
+    public:
+        /*** 'toCORBA' function
+          ** Description: Copies the command to a CORBA RobotCommand
+          ** Receives:    [other] The CORBA RobotCommand
+          ** Returns:     Nothing
+          ***/
+        void toCORBA(CORBATypes::RobotCommand* other) const;
+
+        /*** 'toCORBA' function
+          ** Description: Copies a list of commands to a CORBA RobotCommandSeq
+          ** Receives:    [commands] The commands
+                          [other]    The CORBA RobotCommandSeq
+          ** Returns:     Nothing
+          ***/
+        static void toCORBA(const QList<RobotCommand>& commands, CORBATypes::RobotCommandSeq* other);
+
+        /*** 'fromCORBA' function
+          ** Description: Copies a CORBA RobotCommandSeq to a list of commands
+          ** Receives:    [commands] The CORBA RobotCommandSeq
+          ** Returns:     The commands
+          ***/
+        static QList<RobotCommand> fromCORBA(const CORBATypes::RobotCommandSeq& commands);
+
+
+    public:
+        /*** Info functions
+          ** Description: Gets the command info
+          ** Receives:    Nothing
+          ** Returns:     The requested info
+          ***/
+        quint8 teamNum() const;
+        quint8 playerNum() const;
+        float  x() const;
+        float  y() const;
+        float  theta() const;
+};
+
+
+#endif
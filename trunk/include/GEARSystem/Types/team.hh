@@ -13,7 +13,14 @@
 
 // Includes GEARSystem
 #include <GEARSystem/namespace.hh>
+#include <GEARSystem/lockpolicy.hh>
 #include <GEARSystem/Types/types.hh>
+#include <GEARSystem/Types/angle.hh>
+#include <GEARSystem/Types/angularspeed.hh>
+#include <GEARSystem/Types/idbitmap.hh>
+#include <GEARSystem/Types/playerstate.hh>
+#include <GEARSystem/Types/position.hh>
+#include <GEARSystem/Types/velocity.hh>
 
 
 // Inlcudes Qt library
@@ -26,7 +33,7 @@ using namespace GEARSystem;
 
 /*** 'GEARSystemTeam' class
   ** Description: This class handles a team
-  ** Comments:    This class is reentrant and thread-safe
+  ** Comments:    This class is reentrant and thread-safe, unless its owner guards it (see 'setExternalLocking')
   ***/
 class GEARSystem::GEARSystemTeam {
     private:
@@ -34,40 +41,49 @@ class GEARSystem::GEARSystemTeam {
         uint8   _number;
         QString _name;
 
-        // GEARSystemTeam players
-        uint8 _nPlayers;
-        QHash<uint8,bool>          _validPlayers;
-        QHash<uint8,Position*>     _playersPositions;
-        QHash<uint8,Angle*>        _playersOrientations;
-        QHash<uint8,Velocity*>     _playersVelocities;
-        QHash<uint8,AngularSpeed*> _playersAngularSpeeds;
-        QHash<uint8,bool>          _ballPossessions;
-        QHash<uint8,bool>          _dribbleEnabled;
-        QHash<uint8,bool>          _kickEnabled;
-        QHash<uint8,unsigned char>          _batteryCharge;
-        QHash<uint8,unsigned char>          _capacitorCharge;
+        // Players capacity (player numbers are 8-bit)
+        static const int _maxPlayers = 256;
+
+        // Player state, packed contiguously
+        struct PlayerSlot {
+            Position      position;
+            Angle         orientation;
+            Velocity      velocity;
+            AngularSpeed  angularSpeed;
+            bool          ballPossession;
+            bool          dribbleEnabled;
+            bool          kickEnabled;
+            unsigned char batteryCharge;
+            unsigned char capacitorCharge;
+        };
+
+        // GEARSystemTeam players, indexed by player number
+        IdBitmap   _validPlayers;
+        PlayerSlot _players[_maxPlayers];
 
         // Info flag
         bool _valid;
 
-        // Invalid types
-        Angle*        _invalidAngle;
-        AngularSpeed* _invalidAngularSpeed;
-        Position*     _invalidPosition;
-        Velocity*     _invalidVelocity;
-
-        // Locks
-        #ifdef GSTHREADSAFE
-        mutable QReadWriteLock* _positionsLock;
-        mutable QReadWriteLock* _orientationsLock;
-        mutable QReadWriteLock* _velocitiesLock;
-        mutable QReadWriteLock* _angularSpeedsLock;
-        mutable QReadWriteLock* _possessionsLock;
-        mutable QReadWriteLock* _dribblesLock;
-        mutable QReadWriteLock* _kicksLock;
-        mutable QReadWriteLock* _batteriesLock;
-        mutable QReadWriteLock* _capacitorsLock;
-        #endif
+        // Invalid types (shared by all teams)
+        static const Angle        _invalidAngle;
+        static const AngularSpeed _invalidAngularSpeed;
+        static const Position     _invalidPosition;
+        static const Velocity     _invalidVelocity;
+
+        // Locks (turned off when the owner guards the team)
+        typedef OptionalLock<Lock>            PlayersLock;
+        typedef BasicReadLocker<PlayersLock>  PlayersReadLocker;
+        typedef BasicWriteLocker<PlayersLock> PlayersWriteLocker;
+        mutable PlayersLock _playersLock;
+
+
+    private:
+        /*** 'resetSlot' function
+          ** Description: Sets a player slot to its initial state
+          ** Receives:    [playerNum] The player number
+          ** Returns:     Nothing
+          ***/
+        void resetSlot(uint8 playerNum);
 
 
     public:
@@ -89,11 +105,13 @@ class GEARSystem::GEARSystemTeam {
         /*** Players handling functions
           ** Description: Handles the team players
           ** Receives:    [playerNum] The player number
-          ** Returns:     Nothing
+          ** Returns:     'addPlayer' and 'delPlayer' return 'true' if the player was added or removed (re-adding
+                          only resets it); 'players' and 'playersBitmap' return the players
           ***/
-        void addPlayer(uint8 playerNum);
-        void delPlayer(uint8 playerNum);
+        bool addPlayer(uint8 playerNum);
+        bool delPlayer(uint8 playerNum);
         QList<uint8> players() const;
+        IdBitmap     playersBitmap() const;
 
         /*** GEARSystemTeam info functions
           ** Description: Controls team name and number
@@ -103,6 +121,24 @@ class GEARSystem::GEARSystemTeam {
         void  setName(const QString& name);
         void  setNumber(uint8 number);
 
+        /*** 'reset' function
+          ** Description: Turns the team into a new team without players, so its storage can be reused
+          ** Receives:    [number] The team number
+                          [name]   The team name
+          ** Returns:     Nothing
+          ** Comments:    Player slots are reset when the players are added
+          ***/
+        void reset(uint8 number, const QString& name);
+
+        /*** 'setExternalLocking' function
+          ** Description: Selects who guards the team
+          ** Receives:    [enable] 'true' if the owner guards every call with its own lock (as WorldMap does with
+                                   its per-team locks), 'false' if the team locks itself (the default)
+          ** Returns:     Nothing
+          ** Comments:    Must be called before the team is shared between threads
+          ***/
+        void setExternalLocking(bool enable);
+
     public:
         /*** Players RadioSensor functions
          **  Description: Handles the radiosensor functions
@@ -133,6 +169,22 @@ class GEARSystem::GEARSystemTeam {
         bool                kickEnabled(uint8 playerNum)     const;
         bool                dribbleEnabled(uint8 playerNum)  const;
 
+        /*** 'playerState' function
+          ** Description: Gets the whole player state at once
+          ** Receives:    [playerNum] The player number
+          ** Returns:     The player state, invalid if there is no such player
+          ** Comments:    The state is copied under a single lock, so its fields are consistent
+          ***/
+        PlayerState playerState(uint8 playerNum) const;
+
+        /*** 'playerStates' function
+          ** Description: Gets the state of every player of the team at once
+          ** Receives:    Nothing
+          ** Returns:     The player states, in ascending player order
+          ** Comments:    Only the players in the team are copied, under a single lock
+          ***/
+        QVector<PlayerState> playerStates() const;
+
         /*** 'setPosition' function
           ** Description: Sets the player position
           ** Receives:    [playerNum] The player number
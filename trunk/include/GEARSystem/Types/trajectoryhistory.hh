@@ -0,0 +1,119 @@
+/*** GEARSystem - TrajectoryHistory class
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Prevents multiple definitions
+#ifndef GSTRAJECTORYHISTORY
+#define GSTRAJECTORYHISTORY
+
+
+// Includes GEARSystem
+#include <GEARSystem/namespace.hh>
+#include <GEARSystem/Types/trajectorysample.hh>
+
+// Inlcudes Qt library
+#include <QtCore/QtCore>
+
+
+// Selects namespace
+using namespace GEARSystem;
+
+
+/*** 'TrajectoryHistory' class
+  ** Description: This class holds the last samples of a ball or player in a ring buffer, ordered by time
+  ** Comments:    This class is reentrant, but it isn't thread-safe. When the buffer is full, the oldest
+                  sample is overwritten
+  ***/
+class GEARSystem::TrajectoryHistory {
+    private:
+        // Ring buffer
+        QVector<TrajectorySample> _samples;
+        int _first;
+        int _size;
+
+
+    public:
+        /*** Constructor
+          ** Description: Creates an empty history with no room
+          ** Receives:    Nothing
+          ***/
+        TrajectoryHistory();
+
+        /*** Constructor
+          ** Description: Creates an empty history
+          ** Receives:    [capacity] The maximum number of samples
+          ***/
+        TrajectoryHistory(int capacity);
+
+
+    public:
+        /*** Capacity functions
+          ** Description: Handles the maximum number of samples
+          ** Receives:    [capacity] The maximum number of samples (the newest samples are kept when shrinking)
+          ** Returns:     Nothing, or the capacity
+          ***/
+        void setCapacity(int capacity);
+        int  capacity() const;
+
+        /*** 'size' function
+          ** Description: Gets the number of stored samples
+          ** Receives:    Nothing
+          ** Returns:     The number of samples
+          ***/
+        int size() const;
+
+        /*** 'clear' function
+          ** Description: Removes every sample
+          ** Receives:    Nothing
+          ** Returns:     Nothing
+          ***/
+        void clear();
+
+
+    public:
+        /*** 'append' function
+          ** Description: Stores a new sample
+          ** Receives:    [sample] The sample
+          ** Returns:     Nothing
+          ** Comments:    A sample with the same time as the newest one replaces it; older samples are ignored
+          ***/
+        void append(const TrajectorySample& sample);
+
+        /*** 'at' function
+          ** Description: Gets a sample
+          ** Receives:    [index] The sample index, 0 being the oldest
+          ** Returns:     The sample
+          ***/
+        const TrajectorySample& at(int index) const;
+
+        /*** 'sampleAt' function
+          ** Description: Gets the sample at a given time, interpolating the stored samples
+          ** Receives:    [time] The wanted time, in seconds
+          ** Returns:     The sample (the newest one after the last stored time, invalid before the first)
+          ***/
+        TrajectorySample sampleAt(double time) const;
+
+        /*** 'samples' function
+          ** Description: Gets the stored samples in a time interval
+          ** Receives:    [startTime] The interval start, in seconds
+                          [endTime]   The interval end, in seconds
+          ** Returns:     The samples, oldest first
+          ***/
+        QList<TrajectorySample> samples(double startTime, double endTime) const;
+
+
+    private:
+        /*** 'lowerBound' function
+          ** Description: Finds the first sample not older than a given time
+          ** Receives:    [time] The time
+          ** Returns:     The sample index ('size' if every sample is older)
+          ***/
+        int lowerBound(double time) const;
+};
+
+
+#endif
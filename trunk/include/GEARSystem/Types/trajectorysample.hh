@@ -0,0 +1,118 @@
+/*** GEARSystem - TrajectorySample class
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Prevents multiple definitions
+#ifndef GSTRAJECTORYSAMPLE
+#define GSTRAJECTORYSAMPLE
+
+
+// Includes GEARSystem
+#include <GEARSystem/namespace.hh>
+#include <GEARSystem/Types/angle.hh>
+#include <GEARSystem/Types/position.hh>
+#include <GEARSystem/Types/velocity.hh>
+#include <GEARSystem/CORBAImplementations/corbainterfaces.hh>
+
+// Inlcudes Qt library
+#include <QtCore/QtCore>
+
+
+// Selects namespace
+using namespace GEARSystem;
+
+
+/*** 'TrajectorySample' class
+  ** Description: This class holds the pose of a ball or player at the capture time of a frame
+  ** Comments:    This class is reentrant, but it isn't thread-safe. Balls have no orientation, so it is
+                  invalid in their samples
+  ***/
+class GEARSystem::TrajectorySample {
+    private:
+        // Capture time
+        double _time;
+
+        // Pose
+        Position _position;
+        Angle    _orientation;
+        Velocity _velocity;
+
+
+    public:
+        /*** Constructor
+          ** Description: Creates an invalid sample at time 0
+          ** Receives:    Nothing
+          ***/
+        TrajectorySample();
+
+        /*** Constructor
+          ** Description: Creates a sample
+          ** Receives:    [time]        The capture time, in seconds
+                          [position]    The position
+                          [orientation] The orientation
+                          [velocity]    The velocity
+          ***/
+        TrajectorySample(double time, const Position& position, const Angle& orientation, const Velocity& velocity);
+
+        /*** Constructor
+          ** Description: Creates a sample from a CORBA TrajectorySample
+          ** Receives:    [sample] The CORBA TrajectorySample
+          ***/
+        TrajectorySample(const CORBATypes::TrajectorySample& sample);
+
+
+    public:
+        /*** 'toCORBA' function
+          ** Description: Copies the sample to a CORBA TrajectorySample
+          ** Receives:    [other] The CORBA TrajectorySample
+          ** Returns:     Nothing
+          ***/
+        void toCORBA(CORBATypes::TrajectorySample* other) const;
+
+        /*** 'toCORBA' function
+          ** Description: Copies a list of samples to a CORBA TrajectorySampleSeq
+          ** Receives:    [samples] The samples
+                          [other]   The CORBA TrajectorySampleSeq
+          ** Returns:     Nothing
+          ***/
+        static void toCORBA(const QList<TrajectorySample>& samples, CORBATypes::TrajectorySampleSeq* other);
+
+        /*** 'fromCORBA' function
+          ** Description: Copies a CORBA TrajectorySampleSeq to a list of samples
+          ** Receives:    [samples] The CORBA TrajectorySampleSeq
+          ** Returns:     The samples
+          ***/
+        static QList<TrajectorySample> fromCORBA(const CORBATypes::TrajectorySampleSeq& samples);
+
+
+    public:
+        /*** 'interpolate' function
+          ** Description: Interpolates two samples linearly
+          ** Receives:    [a]    The earlier sample
+                          [b]    The later sample
+                          [time] The wanted time, between the samples times
+          ** Returns:     The interpolated sample
+          ** Comments:    The orientation takes the shortest turn. Values that aren't known in both samples are
+                          taken from the sample closest in time
+          ***/
+        static TrajectorySample interpolate(const TrajectorySample& a, const TrajectorySample& b, double time);
+
+
+    public:
+        /*** Info functions
+          ** Description: Gets the sample info
+          ** Receives:    Nothing
+          ** Returns:     The requested info
+          ***/
+        double          time()        const;
+        const Position& position()    const;
+        const Angle&    orientation() const;
+        const Velocity& velocity()    const;
+};
+
+
+#endif
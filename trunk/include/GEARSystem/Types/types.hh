@@ -24,13 +24,21 @@
 
 
 // Includes other types
+#include <GEARSystem/Types/actuatorownership.hh>
 #include <GEARSystem/Types/angle.hh>
 #include <GEARSystem/Types/angularspeed.hh>
 #include <GEARSystem/Types/field.hh>
 #include <GEARSystem/Types/goal.hh>
+#include <GEARSystem/Types/idbitmap.hh>
+#include <GEARSystem/Types/playerdistance.hh>
+#include <GEARSystem/Types/playerstate.hh>
 #include <GEARSystem/Types/position.hh>
+#include <GEARSystem/Types/robotcommand.hh>
 #include <GEARSystem/Types/team.hh>
+#include <GEARSystem/Types/trajectoryhistory.hh>
+#include <GEARSystem/Types/trajectorysample.hh>
 #include <GEARSystem/Types/velocity.hh>
+#include <GEARSystem/Types/worldupdate.hh>
 
 
 #endif
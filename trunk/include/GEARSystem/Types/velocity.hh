@@ -36,6 +36,10 @@ class GEARSystem::Velocity {
         bool _unknown;
         bool _valid;
 
+        // Capture info
+        quint32 _frameId;
+        double  _captureTime;
+
 
     public:
         /*** Constructor
@@ -159,6 +163,19 @@ class GEARSystem::Velocity {
           ** Returns:     Nothing
           ***/
         void setPolarComponents();
+
+
+    public:
+        /*** Capture info functions
+          ** Description: Handles the vision frame that produced the velocity
+          ** Receives:    [frameId]     The frame number
+                          [captureTime] The frame capture time, in seconds
+          ** Returns:     Nothing, or the requested info (0 if the velocity wasn't produced by a frame)
+          ** Comments:    The capture info is kept when the value changes, and copied with it
+          ***/
+        void    setCapture(quint32 frameId, double captureTime);
+        quint32 frameId()     const;
+        double  captureTime() const;
 };
 
 
@@ -0,0 +1,145 @@
+/*** GEARSystem - WorldUpdate class
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Prevents multiple definitions
+#ifndef GSWORLDUPDATE
+#define GSWORLDUPDATE
+
+
+// Includes GEARSystem
+#include <GEARSystem/namespace.hh>
+#include <GEARSystem/Types/angle.hh>
+#include <GEARSystem/Types/angularspeed.hh>
+#include <GEARSystem/Types/position.hh>
+#include <GEARSystem/Types/velocity.hh>
+
+
+// Inlcudes Qt library
+#include <QtCore/QtCore>
+
+
+// Selects namespace
+using namespace GEARSystem;
+
+
+/*** 'WorldUpdate' class
+  ** Description: This class holds a single change to the world map (a ball or player value), so it can be
+                  staged and applied later as part of a frame
+  ** Comments:    This class is reentrant, but it isn't thread-safe
+  ***/
+class GEARSystem::WorldUpdate {
+    public:
+        // Update types
+        enum Type {
+            Invalid,
+            BallPosition,
+            BallVelocity,
+            PlayerPosition,
+            PlayerOrientation,
+            PlayerVelocity,
+            PlayerAngularSpeed,
+            BallPossession,
+            KickEnabled,
+            DribbleEnabled,
+            BatteryCharge,
+            CapacitorCharge
+        };
+
+
+    private:
+        // Update info
+        Type   _type;
+        quint8 _teamNum;
+        quint8 _num;
+
+        // Values (only the one matching the type is meaningful)
+        Position      _position;
+        Angle         _orientation;
+        Velocity      _velocity;
+        AngularSpeed  _angularSpeed;
+        bool          _flag;
+        unsigned char _charge;
+
+
+    public:
+        /*** Constructor
+          ** Description: Creates an invalid update
+          ** Receives:    Nothing
+          ***/
+        WorldUpdate();
+
+        /*** Constructors
+          ** Description: Creates a ball position or velocity update
+          ** Receives:    [ballNum]  The ball number
+                          [position] The ball position
+                          [velocity] The ball velocity
+          ***/
+        WorldUpdate(quint8 ballNum, const Position& position);
+        WorldUpdate(quint8 ballNum, const Velocity& velocity);
+
+        /*** Constructors
+          ** Description: Creates a player pose, velocity or angular speed update
+          ** Receives:    [teamNum]      The team number
+                          [playerNum]    The player number
+                          [position]     The player position
+                          [orientation]  The player orientation
+                          [velocity]     The player velocity
+                          [angularSpeed] The player angular speed
+          ***/
+        WorldUpdate(quint8 teamNum, quint8 playerNum, const Position& position);
+        WorldUpdate(quint8 teamNum, quint8 playerNum, const Angle& orientation);
+        WorldUpdate(quint8 teamNum, quint8 playerNum, const Velocity& velocity);
+        WorldUpdate(quint8 teamNum, quint8 playerNum, const AngularSpeed& angularSpeed);
+
+        /*** Constructors
+          ** Description: Creates a player flag (ball possession, kick or dribble) or charge (battery or capacitor) update
+          ** Receives:    [type]      The update type
+                          [teamNum]   The team number
+                          [playerNum] The player number
+                          [flag]      The flag value
+                          [charge]    The charge value
+          ***/
+        WorldUpdate(Type type, quint8 teamNum, quint8 playerNum, bool flag);
+        WorldUpdate(Type type, quint8 teamNum, quint8 playerNum, unsigned char charge);
+
+
+    public:
+        /*** Info functions
+          ** Description: Gets the update info
+          ** Receives:    Nothing
+          ** Returns:     The update type, whether it targets a ball, the team number and the player (or ball) number
+          ***/
+        Type   type()      const;
+        bool   isBall()    const;
+        quint8 teamNum()   const;
+        quint8 playerNum() const;
+        quint8 ballNum()   const;
+
+        /*** Values functions
+          ** Description: Gets the update value
+          ** Receives:    Nothing
+          ** Returns:     The value
+          ***/
+        const Position&     position()     const;
+        const Angle&        orientation()  const;
+        const Velocity&     velocity()     const;
+        const AngularSpeed& angularSpeed() const;
+        bool                flag()         const;
+        unsigned char       charge()       const;
+
+        /*** 'setCapture' function
+          ** Description: Sets the vision frame that produced the value, unless the value already has one
+          ** Receives:    [frameId]     The frame number
+                          [captureTime] The frame capture time, in seconds
+          ** Returns:     Nothing
+          ***/
+        void setCapture(quint32 frameId, double captureTime);
+};
+
+
+#endif
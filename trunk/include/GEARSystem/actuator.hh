@@ -40,6 +40,7 @@ class GEARSystem::Actuator {
         CORBAImplementations::Actuator* _corbaActuator;
         CORBAInterfaces::CommandBus_var _corbaCommandBus;
         QString _name;
+        ActuatorOwnership _ownership;
 
         // CORBA objects
         CORBA::ORB_var               _orb;
@@ -90,6 +91,23 @@ class GEARSystem::Actuator {
         bool isConnected() const;
 
 
+    public:
+        /*** 'setOwnership' function
+          ** Description: Sets the teams and players this actuator drives
+          ** Receives:    [ownership] The ownership (if empty, the actuator receives every command)
+          ** Returns:     Nothing
+          ** Comments:    The ownership is sent to the server on 'connect', so it must be set before it
+          ***/
+        void setOwnership(const ActuatorOwnership& ownership);
+
+        /*** 'ownership' function
+          ** Description: Gets the teams and players this actuator drives
+          ** Receives:    Nothing
+          ** Returns:     The ownership
+          ***/
+        const ActuatorOwnership& ownership() const;
+
+
     public:
         /*** 'setSpeed'
           ** Description: Sets a player speed
@@ -102,6 +120,15 @@ class GEARSystem::Actuator {
           ***/
         virtual void setSpeed(uint8 teamNum, uint8 playerNum, float x, float y, float theta) = 0;
 
+        /*** 'setSpeeds'
+          ** Description: Sets the speed of several players at once
+          ** Receives:    [commands] The speed commands
+          ** Returns:     Nothing
+          ** Comments:    The default implementation calls 'setSpeed' for each command. Actuators that
+                          can send all the commands in a single packet should reimplement it
+          ***/
+        virtual void setSpeeds(const QList<RobotCommand>& commands);
+
         /*** 'kick'
           ** Description: Activates the player kicking device
           ** Receives:    [teamNum]   The team number
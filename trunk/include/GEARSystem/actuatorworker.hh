@@ -0,0 +1,178 @@
+/*** GEARSystem - ActuatorWorker class
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Prevents multiple definitions
+#ifndef GSACTUATORWORKER
+#define GSACTUATORWORKER
+
+
+// Includes GEARSystem
+#include <GEARSystem/namespace.hh>
+#include <GEARSystem/Types/types.hh>
+#include <GEARSystem/CORBAImplementations/corbainterfaces.hh>
+
+
+// Inlcudes Qt library
+#include <QtCore/QtCore>
+
+// Includes C++ standard library
+#include <memory>
+
+
+// Selects namespace
+using namespace GEARSystem;
+
+
+/*** 'ActuatorWorker' class
+  ** Description: This class sends the commands queued by the command bus to a single actuator,
+                  so a slow actuator doesn't delay the others
+  ** Comments:    This class is reentrant and thread-safe
+  ***/
+class GEARSystem::ActuatorWorker : public QThread {
+    public:
+        // Command types
+        enum CommandType {
+            SetSpeed,
+            SetSpeeds,
+            Kick,
+            ChipKick,
+            KickOnTouch,
+            ChipKickOnTouch,
+            HoldBall
+        };
+
+        // A queued command ('value' holds the power or the theta speed component)
+        struct Command {
+            CommandType type;
+            uint8       teamNum;
+            uint8       playerNum;
+            float       x;
+            float       y;
+            float       value;
+            bool        enable;
+            std::shared_ptr<const CORBATypes::RobotCommandSeq> commands;
+
+            /*** Constructor
+              ** Description: Creates an empty speed command
+              ** Receives:    Nothing
+              ***/
+            Command();
+        };
+
+        // Default maximum number of queued commands
+        static const int defaultMaxQueueSize = 64;
+
+
+    private:
+        // Actuator info
+        QString _name;
+        CORBAInterfaces::Actuator_var _actuator;
+        uint32 _timeout;
+        bool   _oneway;
+
+        // Command queue
+        QQueue<Command> _queue;
+        int  _maxQueueSize;
+        bool _running;
+
+        // Locks
+        mutable QMutex* _queueLock;
+        QWaitCondition* _queueNotEmpty;
+
+
+    public:
+        /*** Constructor
+          ** Description: Creates the worker and starts its thread
+          ** Receives:    [name]     The actuator name
+                          [actuator] The connected actuator
+          ***/
+        ActuatorWorker(const QString& name, const CORBAInterfaces::Actuator_var& actuator);
+
+        /*** Destructor
+          ** Description: Stops the thread, discarding the pending commands, and destroys the worker
+          ** Receives:    Nothing
+          ***/
+        ~ActuatorWorker();
+
+
+    public:
+        /*** 'enqueue' function
+          ** Description: Queues a command to be sent to the actuator
+          ** Receives:    [command] The command
+          ** Returns:     Nothing
+          ** Comments:    If the queue is full, a speed command queued for the same robot is replaced, or else the
+                          oldest speed command is dropped. Kick, chip kick and hold ball commands are events and are
+                          never dropped, so a queue holding only events grows past its maximum size
+          ***/
+        void enqueue(const Command& command);
+
+        /*** 'pendingCommands' function
+          ** Description: Gets the number of commands waiting to be sent
+          ** Receives:    Nothing
+          ** Returns:     The number of queued commands
+          ***/
+        int pendingCommands() const;
+
+        /*** 'setMaxQueueSize' function
+          ** Description: Sets the maximum number of queued commands
+          ** Receives:    [size] The queue size
+          ** Returns:     Nothing
+          ***/
+        void setMaxQueueSize(int size);
+
+        /*** 'setTimeout' function
+          ** Description: Sets the call timeout of the actuator
+          ** Receives:    [timeout] The timeout in milliseconds, or 0 to use the ORB default
+          ** Returns:     Nothing
+          ***/
+        void setTimeout(uint32 timeout);
+
+        /*** 'timeout' function
+          ** Description: Gets the call timeout of the actuator
+          ** Receives:    Nothing
+          ** Returns:     The timeout in milliseconds
+          ***/
+        uint32 timeout() const;
+
+        /*** 'setOneway' function
+          ** Description: Selects if the commands are sent as oneway calls
+          ** Receives:    [enable] 'true' to send the commands without waiting for the actuator reply,
+                                   'false' to wait for it (the default)
+          ** Returns:     Nothing
+          ***/
+        void setOneway(bool enable);
+
+        /*** 'isOneway' function
+          ** Description: Verifies if the commands are sent as oneway calls
+          ** Receives:    Nothing
+          ** Returns:     'true' if they are, 'false' otherwise
+          ***/
+        bool isOneway() const;
+
+
+    protected:
+        /*** 'run' function
+          ** Description: Sends the queued commands until the worker is stopped
+          ** Receives:    Nothing
+          ** Returns:     Nothing
+          ***/
+        void run();
+
+
+    private:
+        /*** 'send' function
+          ** Description: Sends a command to the actuator
+          ** Receives:    [command] The command
+                          [oneway]  'true' to send it as a oneway call
+          ** Returns:     Nothing
+          ***/
+        void send(const Command& command, bool oneway);
+};
+
+
+#endif
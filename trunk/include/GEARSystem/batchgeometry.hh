@@ -0,0 +1,175 @@
+/*** GEARSystem - BatchGeometry class
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Prevents multiple definitions
+#ifndef GSBATCHGEOMETRY
+#define GSBATCHGEOMETRY
+
+
+// Includes GEARSystem
+#include <GEARSystem/namespace.hh>
+#include <GEARSystem/Types/types.hh>
+#include <GEARSystem/worldsnapshot.hh>
+
+// Inlcudes Qt library
+#include <QtCore/QtCore>
+
+
+// Selects namespace
+using namespace GEARSystem;
+
+
+/*** 'BatchGeometry' class
+  ** Description: This class runs geometry kernels over arrays of coordinates and angles kept as separate x, y
+                  and angle arrays (structure of arrays). The kernels use AVX or SSE2 when the library is built
+                  for them and plain C++ otherwise
+  ** Comments:    This class is reentrant and thread-safe. Angles are in radians and follow the 'Angle' range
+                  (0 <= angle < 2*Pi). Result arrays must hold 'n' values and may alias the input arrays
+  ***/
+class GEARSystem::BatchGeometry {
+    private:
+        /*** Constructor
+          ** Description: This class only has static functions
+          ** Receives:    Nothing
+          ***/
+        BatchGeometry();
+
+
+    public:
+        /*** 'instructionSet' function
+          ** Description: Gets the instruction set the kernels were built with
+          ** Receives:    Nothing
+          ** Returns:     "AVX", "SSE2" or "scalar"
+          ***/
+        static const char* instructionSet();
+
+
+    public:
+        /*** Distances functions
+          ** Description: Calculates the distances (or squared distances) from a point to each point of an array
+          ** Receives:    [x]      The points x coordinates
+                          [y]      The points y coordinates
+                          [n]      The number of points
+                          [pointX] The reference point x coordinate
+                          [pointY] The reference point y coordinate
+                          [result] Where the distances will be stored
+          ** Returns:     Nothing
+          ***/
+        static void distances(const float* x, const float* y, int n, float pointX, float pointY, float* result);
+        static void squaredDistances(const float* x, const float* y, int n, float pointX, float pointY, float* result);
+
+        /*** 'pairwiseDistances' function
+          ** Description: Calculates the distances between every point of two arrays
+          ** Receives:    [ax]     The first points x coordinates
+                          [ay]     The first points y coordinates
+                          [na]     The number of first points
+                          [bx]     The second points x coordinates
+                          [by]     The second points y coordinates
+                          [nb]     The number of second points
+                          [result] Where the na*nb distances will be stored, row 'i' holding the distances from
+                                   the first point 'i'
+          ** Returns:     Nothing
+          ***/
+        static void pairwiseDistances(const float* ax, const float* ay, int na, const float* bx, const float* by, int nb, float* result);
+
+        /*** 'segmentDistances' function
+          ** Description: Calculates the distances from each point of an array to a segment
+          ** Receives:    [x]      The points x coordinates
+                          [y]      The points y coordinates
+                          [n]      The number of points
+                          [ax]     The segment start x coordinate
+                          [ay]     The segment start y coordinate
+                          [bx]     The segment end x coordinate
+                          [by]     The segment end y coordinate
+                          [result] Where the distances will be stored
+          ** Returns:     Nothing
+          ***/
+        static void segmentDistances(const float* x, const float* y, int n, float ax, float ay, float bx, float by, float* result);
+
+        /*** 'bearings' function
+          ** Description: Calculates the direction from a point to each point of an array
+          ** Receives:    [x]      The points x coordinates
+                          [y]      The points y coordinates
+                          [n]      The number of points
+                          [fromX]  The origin x coordinate
+                          [fromY]  The origin y coordinate
+                          [result] Where the angles will be stored
+          ** Returns:     Nothing
+          ** Comments:    The arc tangent is approximated by a polynomial, with an error under 1e-5 radians
+          ***/
+        static void bearings(const float* x, const float* y, int n, float fromX, float fromY, float* result);
+
+
+    public:
+        /*** 'normalizeAngles' function
+          ** Description: Brings angles to the range 0 <= angle < 2*Pi
+          ** Receives:    [angles] The angles
+                          [n]      The number of angles
+                          [result] Where the normalized angles will be stored
+          ** Returns:     Nothing
+          ***/
+        static void normalizeAngles(const float* angles, int n, float* result);
+
+        /*** 'angleDifferences' function
+          ** Description: Calculates the difference of each pair of angles, as 'Angle::difference' does
+          ** Receives:    [a]      The first angles (normalized)
+                          [b]      The second angles (normalized)
+                          [n]      The number of angles
+                          [result] Where the differences will be stored
+          ** Returns:     Nothing
+          ***/
+        static void angleDifferences(const float* a, const float* b, int n, float* result);
+
+
+    public:
+        /*** 'pointsInPolygon' function
+          ** Description: Tests if each point of an array is inside a polygon
+          ** Receives:    [x]         The points x coordinates
+                          [y]         The points y coordinates
+                          [n]         The number of points
+                          [polygonX]  The polygon vertices x coordinates
+                          [polygonY]  The polygon vertices y coordinates
+                          [nVertices] The number of vertices
+                          [result]    Where the results will be stored
+          ** Returns:     Nothing
+          ** Comments:    Uses the even-odd rule, so the polygon may be concave
+          ***/
+        static void pointsInPolygon(const float* x, const float* y, int n, const float* polygonX, const float* polygonY, int nVertices, bool* result);
+
+        /*** 'pointsInField' function
+          ** Description: Tests if each point of an array is inside the area bounded by the field corners
+          ** Receives:    [x]      The points x coordinates
+                          [y]      The points y coordinates
+                          [n]      The number of points
+                          [field]  The field
+                          [result] Where the results will be stored
+          ** Returns:     Nothing
+          ** Comments:    No point is inside a field whose corners are unknown
+          ***/
+        static void pointsInField(const float* x, const float* y, int n, const Field& field, bool* result);
+
+
+    public:
+        /*** 'packPlayers' function
+          ** Description: Copies the known players positions and orientations of a snapshot into arrays that can
+                          be given to the kernels
+          ** Receives:    [snapshot]    The snapshot
+                          [teams]       The teams copied (an empty bitmap copies all teams)
+                          [x]           Where the x coordinates will be stored
+                          [y]           Where the y coordinates will be stored
+                          [orientation] Where the orientations will be stored (NaN if unknown), or NULL
+                          [players]     Where the team and player numbers will be stored, as (team << 8) | player
+          ** Returns:     The number of players copied
+          ** Comments:    Players with unknown or invalid positions are skipped
+          ***/
+        static int packPlayers(const WorldSnapshot& snapshot, const IdBitmap& teams, QVector<float>* x, QVector<float>* y,
+                               QVector<float>* orientation, QVector<quint16>* players);
+};
+
+
+#endif
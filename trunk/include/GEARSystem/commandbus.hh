@@ -13,7 +13,10 @@
 
 // Includes GEARSystem
 #include <GEARSystem/namespace.hh>
+#include <GEARSystem/lockpolicy.hh>
 #include <GEARSystem/Types/types.hh>
+#include <GEARSystem/actuatorworker.hh>
+#include <GEARSystem/commandcoalescer.hh>
 #include <GEARSystem/CORBAImplementations/corbainterfaces.hh>
 
 
@@ -27,19 +30,28 @@ using namespace GEARSystem;
 
 /*** 'CommandBus' class
   ** Description: This class sends commands to actuators
-  ** Comments:    This class is reentrat and thread-safe
+  ** Comments:    This class is reentrat and thread-safe. Each actuator has its own worker thread,
+                  so the commands are sent to all actuators concurrently and the command functions
+                  return as soon as the commands are queued. A command is only sent to the actuators
+                  that own its player
   ***/
 class GEARSystem::CommandBus {
+    friend class GEARSystem::CommandCoalescer;
+
     private:
         // Actuators info
         uint8 _nActuators;
         QHash<QString,bool> _validActuators;
-        QHash<QString,CORBAInterfaces::Actuator_var> _actuators;
+        QHash<QString,ActuatorWorker*> _workers;
+        QHash<QString,ActuatorOwnership> _ownership;
+        uint32 _defaultTimeout;
+        bool   _oneway;
+
+        // Speed commands coalescing (NULL if disabled)
+        CommandCoalescer* _coalescer;
 
         // Locks
-        #ifdef GSTHREADSAFE
-        mutable QReadWriteLock* _actuatorsLock;
-        #endif
+        mutable Lock _actuatorsLock;
 
 
     public:
@@ -49,17 +61,73 @@ class GEARSystem::CommandBus {
           ***/
         CommandBus();
 
+        /*** Destructor
+          ** Description: Stops the actuator workers and destroys the bus
+          ** Receives:    Nothing
+          ***/
+        ~CommandBus();
+
 
     public:
         /*** Actuators handling functions
           ** Description: Handles the actuators
-          ** Receives:    [name]    The actuator name
-                          [address] The actuator address
+          ** Receives:    [name]      The actuator name
+                          [address]   The actuator address
+                          [ownership] The teams and players the actuator drives
+                                      (if omitted or empty, it receives every command)
           ** Returns:     Nothing
           ***/
         void addActuator(const QString& name, const QString& address);
+        void addActuator(const QString& name, const QString& address, const ActuatorOwnership& ownership);
         void delActuator(const QString& name);
 
+        /*** 'setActuatorTimeout' function
+          ** Description: Sets the call timeout of an actuator
+          ** Receives:    [name]    The actuator name
+                          [timeout] The timeout in milliseconds, or 0 to use the ORB default
+          ** Returns:     Nothing
+          ***/
+        void setActuatorTimeout(const QString& name, uint32 timeout);
+
+        /*** 'setDefaultTimeout' function
+          ** Description: Sets the call timeout given to the actuators added from now on
+          ** Receives:    [timeout] The timeout in milliseconds, or 0 to use the ORB default
+          ** Returns:     Nothing
+          ***/
+        void setDefaultTimeout(uint32 timeout);
+
+        /*** 'setAsynchronousCommands' function
+          ** Description: Selects if the commands are sent to the actuators as oneway calls
+          ** Receives:    [enable] 'true' to send the commands without waiting for the actuators replies,
+                                   'false' to wait for them (the default)
+          ** Returns:     Nothing
+          ***/
+        void setAsynchronousCommands(bool enable);
+
+        /*** 'setCoalescingRate' function
+          ** Description: Enables or disables the coalescing of speed commands
+          ** Receives:    [rate] The rate (in Hz) the latest speed of each player is sent to the actuators,
+                                 or 0 to send every speed command as soon as it arrives (the default)
+          ** Returns:     Nothing
+          ** Comments:    When enabled, only the latest speed of each player is kept between two ticks.
+                          Kicks and ball holding commands are never coalesced
+          ***/
+        void setCoalescingRate(float rate);
+
+        /*** 'coalescingRate' function
+          ** Description: Gets the coalescing rate of speed commands
+          ** Receives:    Nothing
+          ** Returns:     The rate in Hz, or 0 if coalescing is disabled
+          ***/
+        float coalescingRate() const;
+
+        /*** 'pendingCommands' function
+          ** Description: Gets the number of commands not yet sent to an actuator
+          ** Receives:    [name] The actuator name
+          ** Returns:     The number of queued commands
+          ***/
+        int pendingCommands(const QString& name) const;
+
 
     public:
         /*** 'setSpeed'
@@ -73,6 +141,14 @@ class GEARSystem::CommandBus {
           ***/
         void setSpeed(uint8 teamNum, uint8 playerNum, float x, float y, float theta) const;
 
+        /*** 'setSpeeds'
+          ** Description: Sets the speed of several players at once
+          ** Receives:    [commands] The speed commands
+          ** Returns:     Nothing
+          ** Comments:    Each actuator receives all the commands of its players in a single call
+          ***/
+        void setSpeeds(const QList<RobotCommand>& commands) const;
+
         /*** 'kick'
           ** Description: Activates the player kicking device
           ** Receives:    [teamNum]   The team number
@@ -125,6 +201,29 @@ class GEARSystem::CommandBus {
 
 
     private:
+        /*** 'coalesce' function
+          ** Description: Hands speed commands to the coalescer, if coalescing is enabled
+          ** Receives:    [command]  The speed command
+                          [commands] The speed commands
+          ** Returns:     'true' if the commands were coalesced, 'false' if they must be sent now
+          ***/
+        bool coalesce(const RobotCommand& command) const;
+        bool coalesce(const QList<RobotCommand>& commands) const;
+
+        /*** 'sendSpeeds' function
+          ** Description: Queues speed commands on the workers of the actuators that own their players
+          ** Receives:    [commands] The speed commands
+          ** Returns:     Nothing
+          ***/
+        void sendSpeeds(const QList<RobotCommand>& commands) const;
+
+        /*** 'dispatch' function
+          ** Description: Queues a command on the workers of the actuators that own its player
+          ** Receives:    [command] The command
+          ** Returns:     Nothing
+          ***/
+        void dispatch(const ActuatorWorker::Command& command) const;
+
         /*** 'connectToActuator'
           ** Description: Connects to a given actuator address
           ** Receives:    [address] The actuator address
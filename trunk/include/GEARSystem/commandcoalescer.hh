@@ -0,0 +1,102 @@
+/*** GEARSystem - CommandCoalescer class
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Prevents multiple definitions
+#ifndef GSCOMMANDCOALESCER
+#define GSCOMMANDCOALESCER
+
+
+// Includes GEARSystem
+#include <GEARSystem/namespace.hh>
+#include <GEARSystem/Types/types.hh>
+
+
+// Inlcudes Qt library
+#include <QtCore/QtCore>
+
+
+// Selects namespace
+using namespace GEARSystem;
+
+
+/*** 'CommandCoalescer' class
+  ** Description: This class keeps the latest speed command of each player and sends all of them to the
+                  command bus at a fixed rate, so the actuators traffic doesn't depend on how often the
+                  speeds are set
+  ** Comments:    This class is reentrant and thread-safe
+  ***/
+class GEARSystem::CommandCoalescer : public QThread {
+    private:
+        // Command bus
+        const CommandBus* _commandBus;
+
+        // Flush interval (in milliseconds)
+        int _interval;
+
+        // Latest command of each player, keyed by (teamNum << 8 | playerNum)
+        QHash<quint16,RobotCommand> _pending;
+        bool _running;
+
+        // Locks
+        mutable QMutex* _pendingLock;
+        QWaitCondition* _stopCondition;
+
+
+    public:
+        /*** Constructor
+          ** Description: Creates the coalescer and starts its thread
+          ** Receives:    [commandBus] The bus the commands are flushed to
+                          [rate]       The flush rate in Hz
+          ***/
+        CommandCoalescer(const CommandBus* commandBus, float rate);
+
+        /*** Destructor
+          ** Description: Stops the thread, flushes the pending commands and destroys the coalescer
+          ** Receives:    Nothing
+          ***/
+        ~CommandCoalescer();
+
+
+    public:
+        /*** 'store' function
+          ** Description: Stores speed commands, replacing the pending ones of the same players
+          ** Receives:    [command]  The speed command
+                          [commands] The speed commands
+          ** Returns:     Nothing
+          ***/
+        void store(const RobotCommand& command);
+        void store(const QList<RobotCommand>& commands);
+
+        /*** 'rate' function
+          ** Description: Gets the flush rate
+          ** Receives:    Nothing
+          ** Returns:     The flush rate in Hz
+          ***/
+        float rate() const;
+
+
+    protected:
+        /*** 'run' function
+          ** Description: Flushes the pending commands at every tick until the coalescer is stopped
+          ** Receives:    Nothing
+          ** Returns:     Nothing
+          ***/
+        void run();
+
+
+    private:
+        /*** 'flush' function
+          ** Description: Sends the pending commands to the command bus in a single batch
+          ** Receives:    Nothing
+          ** Returns:     Nothing
+          ***/
+        void flush();
+};
+
+
+#endif
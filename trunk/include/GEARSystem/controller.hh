@@ -14,6 +14,8 @@
 // Includes GEARSystem
 #include <GEARSystem/namespace.hh>
 #include <GEARSystem/Types/types.hh>
+#include <GEARSystem/worldsnapshot.hh>
+#include <GEARSystem/worldlistener.hh>
 #include <GEARSystem/CORBAImplementations/corbainterfaces.hh>
 
 
@@ -30,6 +32,8 @@ using namespace GEARSystem;
   ** Comments:
   ***/
 class GEARSystem::Controller {
+    friend class GEARSystem::CORBAImplementations::WorldListener;
+
     private:
         // CORBA Controller
         CORBAInterfaces::Controller_var _corbaController;
@@ -39,6 +43,39 @@ class GEARSystem::Controller {
         uint32  _serverPort;
         bool    _isConnected;
 
+        // Command mode
+        bool _asynchronousCommands;
+
+        // Frames subscription
+        CORBAImplementations::WorldListener* _corbaListener;
+        PortableServer::POA_var              _poa;
+        QString                              _subscriptionName;
+        bool                                 _isSubscribed;
+
+        // Last pushed frame and local listeners
+        mutable WorldSnapshotPtr _lastFrame;
+        QList<WorldListener*>    _listeners;
+        mutable QMutex*          _frameLock;
+        mutable QMutex*          _listenersLock;
+        QWaitCondition*          _frameArrived;
+
+        // World shared by a server on this host
+        SharedWorld* _sharedWorld;
+
+        // Client-side cache. The world and the field are fetched again only when the server versions change,
+        // and the versions are checked at most once per interval
+        bool                     _caching;
+        uint32                   _cacheInterval;
+        mutable QElapsedTimer    _cacheTimer;
+        mutable quint64          _serverWorldVersion;
+        mutable quint64          _serverGeometryVersion;
+        mutable WorldSnapshotPtr _cachedWorld;
+        mutable quint64          _cachedWorldVersion;
+        mutable Field            _cachedField;
+        mutable quint64          _cachedGeometryVersion;
+        mutable bool             _hasCachedField;
+        mutable QMutex*          _cacheLock;
+
         // Invalid types
         Angle        _invalidAngle;
         Position     _invalidPosition;
@@ -56,6 +93,12 @@ class GEARSystem::Controller {
           ***/
         Controller();
 
+        /*** Destructor
+          ** Description: Unsubscribes and destroys the controller
+          ** Receives:    Nothing
+          ***/
+        ~Controller();
+
 
     public:
         /*** 'connect' function
@@ -80,6 +123,78 @@ class GEARSystem::Controller {
           ***/
         bool isConnected() const;
 
+        /*** 'setAsynchronousCommands' function
+          ** Description: Selects if the commands (speeds, kicks and ball holding) are sent as oneway calls
+          ** Receives:    [enable] 'true' to send the commands without waiting for the server reply,
+                                   'false' to wait for it (the default)
+          ** Returns:     Nothing
+          ** Comments:    Oneway commands may be lost silently if the server is unreachable
+          ***/
+        void setAsynchronousCommands(bool enable);
+
+        /*** 'asynchronousCommands' function
+          ** Description: Verifies if the commands are sent as oneway calls
+          ** Receives:    Nothing
+          ** Returns:     'true' if they are, 'false' otherwise
+          ***/
+        bool asynchronousCommands() const;
+
+
+    public:
+        /*** 'attachSharedWorld' function
+          ** Description: Attaches to the world shared by a server on this host. While attached, the teams,
+                          players and balls functions and 'worldState' read the shared memory segment instead
+                          of calling the server; field functions and commands still go through CORBA
+          ** Receives:    [key] The segment key (SharedWorld::defaultKey if not given)
+          ** Returns:     'true' if the segment was found, 'false' otherwise
+          ** Comments:    Must not be called concurrently with the world functions
+          ***/
+        bool attachSharedWorld();
+        bool attachSharedWorld(const QString& key);
+
+        /*** 'detachSharedWorld' function
+          ** Description: Detaches from the shared world, going back to reading the world through CORBA
+          ** Receives:    Nothing
+          ** Returns:     Nothing
+          ** Comments:    Must not be called concurrently with the world functions
+          ***/
+        void detachSharedWorld();
+
+        /*** 'isSharedWorldAttached' function
+          ** Description: Verifies if the world is read from a shared memory segment
+          ** Receives:    Nothing
+          ** Returns:     'true' if it is, 'false' otherwise
+          ***/
+        bool isSharedWorldAttached() const;
+
+
+    public:
+        // Default interval between version checks, in milliseconds
+        static const uint32 defaultCacheInterval = 5;
+
+        /*** 'setCaching' function
+          ** Description: Enables or disables the client-side cache. While enabled, the teams, players and balls
+                          functions and 'worldState' answer from a copy of the world fetched again only when the
+                          server world version changes, and the field functions from a copy fetched again only
+                          when the field changes
+          ** Receives:    [enable]   'true' to cache, 'false' to call the server on every function (the default)
+                          [interval] The minimum time between version checks, in milliseconds
+                                     (defaultCacheInterval if not given)
+          ** Returns:     Nothing
+          ** Comments:    Cached values may be up to 'interval' old. While subscribed, the last pushed frame is
+                          used as long as the server has not changed after it, which saves fetching the world
+                          after each frame. The shared world, if attached, is still read first
+          ***/
+        void setCaching(bool enable);
+        void setCaching(bool enable, uint32 interval);
+
+        /*** 'isCaching' function
+          ** Description: Verifies if the client-side cache is enabled
+          ** Receives:    Nothing
+          ** Returns:     'true' if it is, 'false' otherwise
+          ***/
+        bool isCaching() const;
+
 
     public:
         /*** 'teamName' function
@@ -136,6 +251,20 @@ class GEARSystem::Controller {
         const Velocity ballVelocity(uint8 ballNum) const;
 
 
+    public:
+        /*** 'rosterChanged' function
+          ** Description: Verifies, in a single call, if teams, players or balls were added or removed on the
+                          server after a roster version
+          ** Receives:    [sinceVersion] The roster version seen before (0 if none)
+                          [version]      Where the current roster version will be stored (if not NULL)
+          ** Returns:     'true' if the roster changed or the call failed, 'false' otherwise
+          ** Comments:    Lists read after getting a version are at least as new as it, so callers may keep them
+                          until this returns 'true'
+          ***/
+        bool rosterChanged(quint64 sinceVersion) const;
+        bool rosterChanged(quint64 sinceVersion, quint64* version) const;
+
+
     public:
         /*** Gets functions
           ** Description: Gets the player pose
@@ -152,6 +281,15 @@ class GEARSystem::Controller {
         unsigned char      batteryCharge(uint8 teamNum, uint8 playerNum)      const;
         unsigned char      capacitorCharge(uint8 teamNum, uint8 playerNum)    const;
 
+        /*** 'playerState' function
+          ** Description: Gets the whole player state (pose, velocities, flags and charges) in a single call
+          ** Receives:    [teamNum]   The team number
+                          [playerNum] The player number
+          ** Returns:     The player state, invalid if there is no such player or an error occourred
+          ** Comments:    All the fields come from the same update, unlike the ones read with the functions above
+          ***/
+        PlayerState playerState(uint8 teamNum, uint8 playerNum) const;
+
 
     public:
         /*** 'ballPossession' function
@@ -163,6 +301,65 @@ class GEARSystem::Controller {
         bool ballPossession(uint8 teamNum, uint8 playerNum);
 
 
+    public:
+        /*** Positions at a time functions
+          ** Description: Gets a ball or player pose at a given capture time, interpolated from the history the
+                          server keeps for each ball and player
+          ** Receives:    [ballNum]   The ball number
+                          [teamNum]   The team number
+                          [playerNum] The player number
+                          [time]      The capture time, in seconds
+          ** Returns:     The position or orientation (the latest one after the last frame, invalid if the time is
+                          older than the history)
+          ***/
+        const Position ballPositionAt(uint8 ballNum, double time) const;
+        const Position playerPositionAt(uint8 teamNum, uint8 playerNum, double time) const;
+        const Angle    playerOrientationAt(uint8 teamNum, uint8 playerNum, double time) const;
+
+        /*** Trajectory functions
+          ** Description: Gets the samples the server stored for a ball or player in a time interval
+          ** Receives:    [ballNum]   The ball number
+                          [teamNum]   The team number
+                          [playerNum] The player number
+                          [startTime] The interval start, in seconds
+                          [endTime]   The interval end, in seconds
+          ** Returns:     The samples, oldest first
+          ***/
+        QList<TrajectorySample> ballTrajectory(uint8 ballNum, double startTime, double endTime) const;
+        QList<TrajectorySample> playerTrajectory(uint8 teamNum, uint8 playerNum, double startTime, double endTime) const;
+
+        /*** Prediction functions
+          ** Description: Predicts a ball position or a player pose at a given capture time, using the server
+                          motion model
+          ** Receives:    [ballNum]   The ball number
+                          [teamNum]   The team number
+                          [playerNum] The player number
+                          [time]      The capture time, in seconds (on the frames clock)
+          ** Returns:     The predicted position, or the predicted pose along with the last known velocity
+          ***/
+        const Position   predictedBallPosition(uint8 ballNum, double time) const;
+        TrajectorySample predictedPlayerPose(uint8 teamNum, uint8 playerNum, double time) const;
+
+        /*** Spatial query functions
+          ** Description: Finds the players closest to a point, within a radius of a point, or within a radius of a
+                          segment (a pass lane), in a single call to the server
+          ** Receives:    [point]  The queried point
+                          [k]      The maximum number of players
+                          [radius] The search radius
+                          [a]      The segment start
+                          [b]      The segment end
+                          [teams]  The teams searched (an empty bitmap searches all teams)
+          ** Returns:     The players and their distances to the point or segment, closest first
+          ** Comments:    An empty 'segmentClearance' list means the lane is clear
+          ***/
+        QList<PlayerDistance> nearestPlayers(const Position& point, int k) const;
+        QList<PlayerDistance> nearestPlayers(const Position& point, int k, const IdBitmap& teams) const;
+        QList<PlayerDistance> playersWithinRadius(const Position& point, float radius) const;
+        QList<PlayerDistance> playersWithinRadius(const Position& point, float radius, const IdBitmap& teams) const;
+        QList<PlayerDistance> segmentClearance(const Position& a, const Position& b, float radius) const;
+        QList<PlayerDistance> segmentClearance(const Position& a, const Position& b, float radius, const IdBitmap& teams) const;
+
+
     public:
         /*** 'setSpeed'
           ** Description: Sets a player speed
@@ -175,6 +372,13 @@ class GEARSystem::Controller {
           ***/
         void setSpeed(uint8 teamNum, uint8 playerNum, float x, float y, float theta);
 
+        /*** 'setSpeeds'
+          ** Description: Sets the speed of several players at once
+          ** Receives:    [commands] The speed commands
+          ** Returns:     Nothing
+          ***/
+        void setSpeeds(const QList<RobotCommand>& commands);
+
         /*** 'kick'
           ** Description: Activates the player kicking device
           ** Receives:    [teamNum]   The team number
@@ -243,6 +447,129 @@ class GEARSystem::Controller {
         const Position rightPenaltyMark() const;
 
         float fieldCenterRadius() const;
+
+        /*** 'fieldGeometry' function
+          ** Description: Gets every field element in a single call
+          ** Receives:    [version] Where the server geometry version will be stored (if not NULL)
+          ** Returns:     The field (empty, version 0, if the call failed)
+          ** Comments:    The version grows on every field change, so it tells if a field kept by the caller is
+                          outdated
+          ***/
+        const Field fieldGeometry() const;
+        const Field fieldGeometry(quint64* version) const;
+
+
+    public:
+        /*** 'worldState' function
+          ** Description: Gets every team, player and ball, from the same frame, in a single call
+          ** Receives:    Nothing
+          ** Returns:     The world snapshot (empty, version 0, if the call failed)
+          ***/
+        WorldSnapshotPtr worldState() const;
+
+
+    public:
+        /*** 'subscribe' function
+          ** Description: Asks the server to push every committed frame to this controller
+          ** Receives:    [name] The subscriber name (unique among the controllers connected to the server)
+          ** Returns:     'true' if the subscription was made, 'false' otherwise
+          ***/
+        bool subscribe(const QString& name);
+
+        /*** 'unsubscribe' function
+          ** Description: Stops receiving frames from the server
+          ** Receives:    Nothing
+          ** Returns:     Nothing
+          ***/
+        void unsubscribe();
+
+        /*** 'isSubscribed' function
+          ** Description: Verifies if the controller receives the frames pushed by the server
+          ** Receives:    Nothing
+          ** Returns:     'true' if it is subscribed, 'false' otherwise
+          ***/
+        bool isSubscribed() const;
+
+        /*** 'waitForFrame' function
+          ** Description: Blocks until a frame newer than a given version is pushed by the server
+          ** Receives:    [afterVersion] The version of the last frame the caller has seen (0 for any frame)
+                          [timeout]      The maximum waiting time, in milliseconds
+          ** Returns:     The newest pushed frame (empty, version 0, if none arrived in time)
+          ***/
+        WorldSnapshotPtr waitForFrame(quint64 afterVersion, uint32 timeout);
+
+        /*** 'lastFrame' function
+          ** Description: Gets the newest frame pushed by the server, without blocking
+          ** Receives:    Nothing
+          ** Returns:     The frame (empty, version 0, if none arrived yet)
+          ***/
+        WorldSnapshotPtr lastFrame() const;
+
+        /*** Listeners handling functions
+          ** Description: Registers or unregisters an object notified of each pushed frame
+          ** Receives:    [listener] The listener
+          ** Returns:     Nothing
+          ** Comments:    Listeners are called from an ORB thread, while a lock is held, so they must return
+                          quickly and must not register or unregister listeners themselves
+          ***/
+        void addListener(WorldListener* listener);
+        void removeListener(WorldListener* listener);
+
+
+    private:
+        /*** 'frameReceived' function
+          ** Description: Stores a frame pushed by the server and notifies the waiting threads and listeners
+          ** Receives:    [frame] The frame
+          ** Returns:     Nothing
+          ***/
+        void frameReceived(const WorldSnapshotPtr& frame);
+
+        /*** 'resetLastFrame' function
+          ** Description: Drops the last pushed frame, so the next one is accepted whatever its version
+          ** Receives:    Nothing
+          ** Returns:     Nothing
+          ** Comments:    Used when a new subscription starts and when the server version goes backwards (the
+                          server was restarted)
+          ***/
+        void resetLastFrame() const;
+
+        /*** 'releaseListener' function
+          ** Description: Deactivates and releases the CORBA listener
+          ** Receives:    Nothing
+          ** Returns:     Nothing
+          ***/
+        void releaseListener();
+
+        /*** 'cachedWorld' function
+          ** Description: Gets the cached world, fetching it again if the server version changed
+          ** Receives:    Nothing
+          ** Returns:     The world (NULL if it could not be fetched)
+          ***/
+        WorldSnapshotPtr cachedWorld() const;
+
+        /*** 'cachedField' function
+          ** Description: Gets the cached field, fetching it again if the server geometry version changed
+          ** Receives:    [field]   Where the field will be copied
+                          [version] Where its geometry version will be stored (if not NULL)
+          ** Returns:     'true' if the field was copied, 'false' if it could not be fetched
+          ***/
+        bool cachedField(Field* field, quint64* version) const;
+
+        /*** 'checkVersions' function
+          ** Description: Gets the server versions, unless they were checked less than an interval ago
+          ** Receives:    Nothing
+          ** Returns:     'true' if the versions are known, 'false' otherwise
+          ** Comments:    Must be called with the cache lock held. Drops the cache and the last pushed frame if the
+                          server versions went backwards
+          ***/
+        bool checkVersions() const;
+
+        /*** 'clearCache' function
+          ** Description: Drops the cached world and field
+          ** Receives:    Nothing
+          ** Returns:     Nothing
+          ***/
+        void clearCache();
 };
 
 
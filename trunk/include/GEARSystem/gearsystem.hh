@@ -13,11 +13,18 @@
 
 // Includes system namespace
 #include <GEARSystem/namespace.hh>
+#include <GEARSystem/lockpolicy.hh>
 
 // Includes system modules
 #include <GEARSystem/Types/types.hh>
 #include <GEARSystem/commandbus.hh>
 #include <GEARSystem/worldmap.hh>
+#include <GEARSystem/worldsnapshot.hh>
+#include <GEARSystem/worldlistener.hh>
+#include <GEARSystem/worldingest.hh>
+#include <GEARSystem/motionmodel.hh>
+#include <GEARSystem/batchgeometry.hh>
+#include <GEARSystem/sharedworld.hh>
 #include <GEARSystem/actuator.hh>
 #include <GEARSystem/controller.hh>
 #include <GEARSystem/sensor.hh>
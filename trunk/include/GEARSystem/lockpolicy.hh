@@ -0,0 +1,220 @@
+/*** GEARSystem - Lock policies
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Prevents multiple definitions
+#ifndef GSLOCKPOLICY
+#define GSLOCKPOLICY
+
+
+// Includes GEARSystem
+#include <GEARSystem/namespace.hh>
+#include <GEARSystem/lockconfig.hh>
+
+// Inlcudes Qt library
+#include <QtCore/QtCore>
+
+
+/*** Lock policies
+  ** Description: The shared state of WorldMap, GEARSystemTeam, Field and CommandBus is guarded by 'GEARSystem::Lock',
+                  chosen when the library is built ('qmake lock_policy=...') and recorded in 'lockconfig.hh':
+                    none      - NoLock, for single-threaded embeddings
+                    mutex     - MutexLock, one thread at a time
+                    spin      - SpinLock, readers and writers spin on an atomic word
+                    readwrite - ReadWriteLock, the default
+  ** Comments:    Every policy has 'lockForRead', 'lockForWrite' and 'unlock'. Copying a lock creates a new, unlocked
+                  lock, so classes holding one keep their implicit copies. The functions are defined in this header
+                  so the no-lock policy compiles away
+  ***/
+
+
+/*** 'NoLock' class
+  ** Description: This policy does no synchronisation at all
+  ** Comments:    Only for builds where a single thread uses the library
+  ***/
+class GEARSystem::NoLock {
+    public:
+        void lockForRead()  {}
+        void lockForWrite() {}
+        void unlock()       {}
+};
+
+
+/*** 'MutexLock' class
+  ** Description: This policy lets one thread at a time in, readers included
+  ** Comments:    Cheaper than a read-write lock when sections are short and readers rarely overlap
+  ***/
+class GEARSystem::MutexLock {
+    private:
+        QMutex _mutex;
+
+    public:
+        MutexLock() {}
+        MutexLock(const MutexLock&) {}
+        MutexLock& operator =(const MutexLock&) { return(*this); }
+
+        void lockForRead()  { _mutex.lock();   }
+        void lockForWrite() { _mutex.lock();   }
+        void unlock()       { _mutex.unlock(); }
+};
+
+
+/*** 'ReadWriteLock' class
+  ** Description: This policy lets many readers or a single writer in
+  ***/
+class GEARSystem::ReadWriteLock {
+    private:
+        QReadWriteLock _lock;
+
+    public:
+        ReadWriteLock() {}
+        ReadWriteLock(const ReadWriteLock&) {}
+        ReadWriteLock& operator =(const ReadWriteLock&) { return(*this); }
+
+        void lockForRead()  { _lock.lockForRead();  }
+        void lockForWrite() { _lock.lockForWrite(); }
+        void unlock()       { _lock.unlock();       }
+};
+
+
+/*** 'SpinLock' class
+  ** Description: This policy lets many readers or a single writer in, spinning on an atomic word (the number of
+                  readers, or -1 while written) instead of sleeping
+  ** Comments:    Meant for the short sections of the world state. Writers may wait while readers keep coming
+  ***/
+class GEARSystem::SpinLock {
+    private:
+        // Spins before yielding the processor
+        static const int _spins = 64;
+
+        QAtomicInt _state;
+
+    public:
+        SpinLock() : _state(0) {}
+        SpinLock(const SpinLock&) : _state(0) {}
+        SpinLock& operator =(const SpinLock&) { return(*this); }
+
+        void lockForRead() {
+            for (int tries = 1; ; tries++) {
+                const int state = _state.loadAcquire();
+                if (state >= 0 && _state.testAndSetAcquire(state, state+1)) {
+                    return;
+                }
+                if (tries % _spins == 0) {
+                    QThread::yieldCurrentThread();
+                }
+            }
+        }
+
+        void lockForWrite() {
+            for (int tries = 1; !_state.testAndSetAcquire(0, -1); tries++) {
+                if (tries % _spins == 0) {
+                    QThread::yieldCurrentThread();
+                }
+            }
+        }
+
+        void unlock() {
+            // The writer is the only owner while the state is -1
+            if (_state.loadAcquire() < 0) {
+                _state.storeRelease(0);
+            }
+            else {
+                (void) _state.fetchAndAddRelease(-1);
+            }
+        }
+};
+
+
+/*** 'OptionalLock' class
+  ** Description: This policy wraps another one and can be turned off, for objects already guarded by a lock of
+                  their owner
+  ** Comments:    Enabled by default. It must not be turned off or on while held. A copy is a new, enabled lock,
+                  since it isn't guarded by the owner of the original
+  ***/
+template <class LockType>
+class GEARSystem::OptionalLock {
+    private:
+        LockType _lock;
+        bool     _enabled;
+
+    public:
+        OptionalLock() : _enabled(true) {}
+        OptionalLock(const OptionalLock&) : _enabled(true) {}
+        OptionalLock& operator =(const OptionalLock&) { return(*this); }
+
+        void setEnabled(bool enable) { _enabled = enable; }
+        bool isEnabled() const       { return(_enabled); }
+
+        void lockForRead()  { if (_enabled) { _lock.lockForRead();  } }
+        void lockForWrite() { if (_enabled) { _lock.lockForWrite(); } }
+        void unlock()       { if (_enabled) { _lock.unlock();       } }
+};
+
+
+/*** 'BasicReadLocker' and 'BasicWriteLocker' classes
+  ** Description: These classes hold a lock of any policy for reading or writing while they exist, unless
+                  'unlock' releases it earlier
+  ***/
+template <class LockType>
+class GEARSystem::BasicReadLocker {
+    private:
+        LockType& _lock;
+        bool      _locked;
+
+        BasicReadLocker(const BasicReadLocker&);
+        BasicReadLocker& operator =(const BasicReadLocker&);
+
+    public:
+        explicit BasicReadLocker(LockType& lock) : _lock(lock), _locked(true) { _lock.lockForRead(); }
+        ~BasicReadLocker() { unlock(); }
+
+        void unlock() { if (_locked)  { _lock.unlock(); _locked = false; } }
+        void relock() { if (!_locked) { _lock.lockForRead(); _locked = true; } }
+};
+
+template <class LockType>
+class GEARSystem::BasicWriteLocker {
+    private:
+        LockType& _lock;
+        bool      _locked;
+
+        BasicWriteLocker(const BasicWriteLocker&);
+        BasicWriteLocker& operator =(const BasicWriteLocker&);
+
+    public:
+        explicit BasicWriteLocker(LockType& lock) : _lock(lock), _locked(true) { _lock.lockForWrite(); }
+        ~BasicWriteLocker() { unlock(); }
+
+        void unlock() { if (_locked)  { _lock.unlock(); _locked = false; } }
+        void relock() { if (!_locked) { _lock.lockForWrite(); _locked = true; } }
+};
+
+
+// Refuses a policy other than the one the library was built with
+#if (defined(GSLOCKPOLICY_NONE) + defined(GSLOCKPOLICY_MUTEX) + defined(GSLOCKPOLICY_SPIN) + defined(GSLOCKPOLICY_READWRITE)) > 1
+#error "GEARSystem: the lock policy defined differs from the one in 'lockconfig.hh'"
+#endif
+
+// Selects the build policy
+namespace GEARSystem {
+    #if defined(GSLOCKPOLICY_NONE)
+    typedef NoLock Lock;
+    #elif defined(GSLOCKPOLICY_MUTEX)
+    typedef MutexLock Lock;
+    #elif defined(GSLOCKPOLICY_SPIN)
+    typedef SpinLock Lock;
+    #else
+    typedef ReadWriteLock Lock;
+    #endif
+
+    typedef BasicReadLocker<Lock>  ReadLocker;
+    typedef BasicWriteLocker<Lock> WriteLocker;
+}
+
+
+#endif
@@ -0,0 +1,98 @@
+/*** GEARSystem - MotionModel class
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Prevents multiple definitions
+#ifndef GSMOTIONMODEL
+#define GSMOTIONMODEL
+
+
+// Includes GEARSystem
+#include <GEARSystem/namespace.hh>
+#include <GEARSystem/Types/types.hh>
+
+
+// Selects namespace
+using namespace GEARSystem;
+
+
+/*** 'MotionModel' class
+  ** Description: This class extrapolates the balls and players from their last known state. By default, players
+                  move at constant velocity and angular speed, and balls move in a straight line slowing down at
+                  a constant deceleration. It may be inherited to provide other models
+  ** Comments:    This class is reentrant. The prediction functions are called concurrently, so derived classes
+                  must keep them thread-safe
+  ***/
+class GEARSystem::MotionModel {
+    public:
+        // Default maximum prediction interval, in seconds
+        static constexpr double defaultMaxInterval = 1.0;
+
+
+    private:
+        // Model parameters
+        float  _ballDeceleration;
+        double _maxInterval;
+
+
+    public:
+        /*** Constructor
+          ** Description: Creates the default model, with no ball deceleration
+          ** Receives:    Nothing
+          ***/
+        MotionModel();
+
+        /*** Destructor
+          ** Description: Destroys the model
+          ** Receives:    Nothing
+          ***/
+        virtual ~MotionModel();
+
+
+    public:
+        /*** Parameters functions
+          ** Description: Handles the model parameters
+          ** Receives:    [deceleration] The ball rolling deceleration, in distance units per squared second
+                          [interval]     The maximum prediction interval, in seconds (longer ones are clamped)
+          ** Returns:     Nothing, or the requested parameter
+          ***/
+        void   setBallDeceleration(float deceleration);
+        float  ballDeceleration() const;
+        void   setMaxInterval(double interval);
+        double maxInterval() const;
+
+
+    public:
+        /*** 'predictBall' function
+          ** Description: Extrapolates a ball position
+          ** Receives:    [position] The last known position
+                          [velocity] The last known velocity
+                          [interval] The time since the position was captured, in seconds (at least 0 and at
+                                     most 'maxInterval')
+          ** Returns:     The predicted position (invalid or unknown if the last position is)
+          ***/
+        virtual Position predictBall(const Position& position, const Velocity& velocity, double interval) const;
+
+        /*** 'predictPlayer' function
+          ** Description: Extrapolates a player pose
+          ** Receives:    [position]     The last known position
+                          [orientation]  The last known orientation
+                          [velocity]     The last known velocity
+                          [angularSpeed] The last known angular speed
+                          [interval]     The time since the pose was captured, in seconds (at least 0 and at
+                                         most 'maxInterval')
+                          [newPosition]    Where the predicted position will be stored
+                          [newOrientation] Where the predicted orientation will be stored
+          ** Returns:     Nothing
+          ***/
+        virtual void predictPlayer(const Position& position, const Angle& orientation, const Velocity& velocity,
+                                   const AngularSpeed& angularSpeed, double interval,
+                                   Position* newPosition, Angle* newOrientation) const;
+};
+
+
+#endif
@@ -9,20 +9,46 @@
 // Defines the GEARSystem namespace
 namespace GEARSystem {
     // Basic classes
+    class ActuatorOwnership;
     class Angle;
     class AngularSpeed;
     class Field;
     class Goal;
+    class IdBitmap;
     class Position;
+    class RobotCommand;
     class Velocity;
     class GEARSystemTeam;
+    class PlayerDistance;
+    class PlayerState;
+    class TrajectoryHistory;
+    class TrajectorySample;
+    class WorldUpdate;
+
+    // Lock policies
+    class NoLock;
+    class MutexLock;
+    class ReadWriteLock;
+    class SpinLock;
+    template <class LockType> class OptionalLock;
+    template <class LockType> class BasicReadLocker;
+    template <class LockType> class BasicWriteLocker;
 
     // Game classes
     class WorldMap;
+    class WorldSnapshot;
+    class WorldListener;
+    class WorldPublisher;
+    class WorldIngest;
+    class MotionModel;
+    class BatchGeometry;
+    class SharedWorld;
     class CommandBus;
+    class CommandCoalescer;
 
     // System elements
     class Actuator;
+    class ActuatorWorker;
     class Controller;
     class Sensor;
     class RadioSensor;
@@ -35,6 +61,7 @@ namespace GEARSystem {
         class Controller;
         class Sensor;
         class RadioSensor;
+        class WorldListener;
     }
 
     namespace CORBATypes {
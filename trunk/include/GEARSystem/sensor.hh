@@ -30,6 +30,38 @@ using namespace GEARSystem;
   ** Comments:
   ***/
 class GEARSystem::Sensor {
+    public:
+        // A player seen in a frame
+        struct PlayerSample {
+            uint8        teamNum;
+            uint8        playerNum;
+            Position     position;
+            Angle        orientation;
+            Velocity     velocity;
+            AngularSpeed angularSpeed;
+
+            /*** Constructors
+              ** Description: Creates an empty sample of player #0 of team #0, or a sample with the given values
+              ***/
+            PlayerSample();
+            PlayerSample(uint8 teamNum, uint8 playerNum, const Position& position, const Angle& orientation,
+                         const Velocity& velocity, const AngularSpeed& angularSpeed);
+        };
+
+        // A ball seen in a frame
+        struct BallSample {
+            uint8    ballNum;
+            Position position;
+            Velocity velocity;
+
+            /*** Constructors
+              ** Description: Creates an empty sample of ball #0, or a sample with the given values
+              ***/
+            BallSample();
+            BallSample(uint8 ballNum, const Position& position, const Velocity& velocity);
+        };
+
+
     private:
         // CORBA Sensor
         CORBAInterfaces::Sensor_var _corbaSensor;
@@ -40,6 +72,18 @@ class GEARSystem::Sensor {
         bool    _isConnected;
 
 
+    private:
+        /*** 'toCORBA' functions
+          ** Description: Copies the samples of a frame to CORBA sequences
+          ** Receives:    [players] The players seen
+                          [balls]   The balls seen
+                          [other]   The CORBA sequence
+          ** Returns:     Nothing
+          ***/
+        static void toCORBA(const QList<PlayerSample>& players, CORBATypes::PlayerSampleSeq* other);
+        static void toCORBA(const QList<BallSample>& balls, CORBATypes::BallSampleSeq* other);
+
+
     public:
         /*** Constructor
           ** Description: Creates the sensor
@@ -166,6 +210,36 @@ class GEARSystem::Sensor {
         void setBallPossession(uint8 teamNum, uint8 playerNum, bool possession);
 
 
+    public:
+        /*** Frames handling functions
+          ** Description: Groups the changes of a vision frame. Samples staged with the frame number between
+                          'beginFrame' and 'commitFrame' are applied by the server at once, so controllers only see
+                          complete frames
+          ** Receives:    [frameId]     The frame number
+                          [captureTime] The frame capture time, in seconds
+                          [players]     The players seen
+                          [balls]       The balls seen
+          ** Returns:     Nothing
+          ** Comments:    A frame may be staged in several calls. The value setters are never held for a frame.
+                          The server drops a frame that isn't committed within its frame timeout
+          ***/
+        void beginFrame(uint32 frameId, double captureTime);
+        void stageSamples(uint32 frameId, const QList<PlayerSample>& players, const QList<BallSample>& balls);
+        void commitFrame(uint32 frameId);
+
+        /*** 'pushFrame' function
+          ** Description: Sends a whole vision frame in a single call, applied by the server at once
+          ** Receives:    [frameId]     The frame number
+                          [captureTime] The frame capture time, in seconds
+                          [players]     The players seen
+                          [balls]       The balls seen
+          ** Returns:     Nothing
+          ** Comments:    Replaces 'beginFrame', 'stageSamples' and 'commitFrame'. Every value of the samples is
+                          set, invalid ones included
+          ***/
+        void pushFrame(uint32 frameId, double captureTime, const QList<PlayerSample>& players, const QList<BallSample>& balls);
+
+
     public:
         /*** Field handling functions
           ** Description: Handles field info
@@ -186,6 +260,13 @@ class GEARSystem::Sensor {
         void setRightPenaltyMark(const Position& position);
 
         void setFieldCenterRadius(float centerRadius);
+
+        /*** 'setFieldGeometry' function
+          ** Description: Replaces every field element at once, in a single call
+          ** Receives:    [field] The field
+          ** Returns:     Nothing
+          ***/
+        void setFieldGeometry(const Field& field);
 };
 
 
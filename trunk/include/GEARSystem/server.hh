@@ -18,6 +18,7 @@
 #include <GEARSystem/CORBAImplementations/corbasensor.hh>
 #include <GEARSystem/CORBAImplementations/corbacommandbus.hh>
 #include <GEARSystem/CORBAImplementations/corbaradiosensor.hh>
+#include <GEARSystem/sharedworld.hh>
 
 
 // Includes omniORB 4
@@ -45,6 +46,10 @@ class GEARSystem::Server {
         CORBAImplementations::RadioSensor* _radioSensor;
         CORBAImplementations::CommandBus*  _commandBus;
 
+        // World shared with same-host clients
+        SharedWorld*    _sharedWorld;
+        const WorldMap* _sharedWorldMap;
+
         // Info flags
         bool _initialized;
         bool _running;
@@ -61,6 +66,13 @@ class GEARSystem::Server {
                CORBAImplementations::RadioSensor* radioSensor, CORBAImplementations::CommandBus* commandBus);
 
 
+        /*** Destructor
+          ** Description: Destroys the server
+          ** Receives:    Nothing
+          ***/
+        ~Server();
+
+
     public:
         /*** 'initialize' function
           ** Description: Initializes the server
@@ -84,6 +96,34 @@ class GEARSystem::Server {
         void stop();
 
 
+    public:
+        /*** 'shareWorld' function
+          ** Description: Publishes the world in a shared memory segment, rewritten after every change, so
+                          controllers on this host can read it without going through CORBA
+          ** Receives:    [key] The segment key (SharedWorld::defaultKey if not given)
+          ** Returns:     'true' if the segment was created, 'false' otherwise
+          ** Comments:    Each change builds a snapshot of the whole world and copies it into the segment. Values
+                          set one by one are written once per batch when the sensor has an ingest stage, but once
+                          per call without one, so fast sensors should use an ingest stage or frames
+          ***/
+        bool shareWorld();
+        bool shareWorld(const QString& key);
+
+        /*** 'unshareWorld' function
+          ** Description: Stops publishing the world and removes the segment
+          ** Receives:    Nothing
+          ** Returns:     Nothing
+          ***/
+        void unshareWorld();
+
+        /*** 'isWorldShared' function
+          ** Description: Verifies if the world is being published in a shared memory segment
+          ** Receives:    Nothing
+          ** Returns:     'true' if they are, 'false' otherwise
+          ***/
+        bool isWorldShared() const;
+
+
     public:
         /*** Info functions
           ** Description: Gets information about the server
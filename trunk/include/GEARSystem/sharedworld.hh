@@ -0,0 +1,226 @@
+/*** GEARSystem - SharedWorld class
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Prevents multiple definitions
+#ifndef GSSHAREDWORLD
+#define GSSHAREDWORLD
+
+
+// Includes GEARSystem
+#include <GEARSystem/namespace.hh>
+#include <GEARSystem/worldlistener.hh>
+#include <GEARSystem/worldsnapshot.hh>
+
+
+// Inlcudes Qt library
+#include <QtCore/QtCore>
+
+
+// Selects namespace
+using namespace GEARSystem;
+
+
+/*** 'SharedWorld' class
+  ** Description: This class holds the world in a shared memory segment, so clients on the server host can
+                  read it without going through CORBA. The server creates the segment and rewrites it after every
+                  change of the map (see 'WorldMap::addUpdateListener'); clients attach to it read-only
+  ** Comments:    This class is reentrant and thread-safe. The frame is guarded by a sequence counter
+                  (seqlock): the writer never waits for the readers, and readers retry if they raced a write.
+                  Only one process may write a segment. Worlds with more players than 'maxPlayers' don't fit,
+                  and the segment is marked as truncated until they do
+  ***/
+class GEARSystem::SharedWorld : public WorldListener {
+    public:
+        // Default segment key
+        static const char* const defaultKey;
+
+        // Segment limits (every team and ball number fits, players are limited in total)
+        static const int maxTeams      = 256;
+        static const int maxPlayers    = 256;
+        static const int maxBalls      = 256;
+        static const int maxNameLength = 32;
+
+
+    private:
+        // A position, velocity, angle or angular speed ('state' is 0 if invalid, 1 if unknown, 2 if known)
+        struct Value {
+            quint8  state;
+            float   v[3];
+            quint32 frameId;
+            double  captureTime;
+        };
+
+        struct Team {
+            quint8 teamNum;
+            char   name[maxNameLength];
+        };
+
+        struct Player {
+            quint8 teamNum;
+            quint8 playerNum;
+            quint8 ballPossession;
+            quint8 kickEnabled;
+            quint8 dribbleEnabled;
+            quint8 batteryCharge;
+            quint8 capacitorCharge;
+            Value  position;
+            Value  orientation;
+            Value  velocity;
+            Value  angularSpeed;
+        };
+
+        struct Ball {
+            quint8 ballNum;
+            Value  position;
+            Value  velocity;
+        };
+
+        // The frame data
+        struct Data {
+            quint64 version;
+            quint32 frameId;
+            double  captureTime;
+            quint32 nTeams;
+            quint32 nPlayers;
+            quint32 nBalls;
+            quint32 truncated;
+            Team    teams[maxTeams];
+            Player  players[maxPlayers];
+            Ball    balls[maxBalls];
+        };
+
+        // The segment layout ('sequence' is odd while the data is being written)
+        struct Frame {
+            quint32 magic;
+            QBasicAtomicInteger<quint32> sequence;
+            Data    data;
+        };
+
+
+    private:
+        // Segment
+        QSharedMemory* _memory;
+        Frame*         _frame;
+        bool           _isWriter;
+
+        // Local copy of the data, built before writing and copied before reading
+        mutable Data*            _localData;
+
+        // Last snapshot read, reused while the sequence doesn't change
+        mutable quint32          _cachedSequence;
+        mutable WorldSnapshotPtr _cachedSnapshot;
+
+        // Locks
+        mutable QMutex* _lock;
+
+
+    private:
+        /*** Conversion functions
+          ** Description: Convert the world types to and from the segment values
+          ** Receives:    [value] The value
+                          [other] The value to be set
+          ** Returns:     Nothing, or the converted value
+          ***/
+        static void toShared(const Position& value, Value* other);
+        static void toShared(const Angle& value, Value* other);
+        static void toShared(const Velocity& value, Value* other);
+        static void toShared(const AngularSpeed& value, Value* other);
+        static Position     positionFromShared(const Value& value);
+        static Angle        angleFromShared(const Value& value);
+        static Velocity     velocityFromShared(const Value& value);
+        static AngularSpeed angularSpeedFromShared(const Value& value);
+
+
+    public:
+        /*** Constructor
+          ** Description: Creates a detached shared world
+          ** Receives:    [key] The segment key
+          ***/
+        SharedWorld(const QString& key);
+
+        /*** Destructor
+          ** Description: Detaches from the segment and destroys the shared world
+          ** Receives:    Nothing
+          ***/
+        ~SharedWorld();
+
+
+    public:
+        /*** 'create' function
+          ** Description: Creates the segment, to be written by this process
+          ** Receives:    Nothing
+          ** Returns:     'true' if the segment was created, 'false' otherwise
+          ** Comments:    A segment left by a crashed server is removed and created again
+          ***/
+        bool create();
+
+        /*** 'attach' function
+          ** Description: Attaches to a segment created by the server, for reading
+          ** Receives:    Nothing
+          ** Returns:     'true' if the segment was found, 'false' otherwise
+          ***/
+        bool attach();
+
+        /*** 'detach' function
+          ** Description: Detaches from the segment
+          ** Receives:    Nothing
+          ** Returns:     Nothing
+          ***/
+        void detach();
+
+        /*** 'isAttached' function
+          ** Description: Verifies if the segment is attached
+          ** Receives:    Nothing
+          ** Returns:     'true' if it is attached, 'false' otherwise
+          ***/
+        bool isAttached() const;
+
+
+    public:
+        /*** 'write' function
+          ** Description: Writes a snapshot into the segment
+          ** Receives:    [snapshot] The snapshot
+          ** Returns:     Nothing
+          ** Comments:    Teams, players and balls over the segment limits are left out. Snapshots older than the
+                          one in the segment are ignored
+          ***/
+        void write(const WorldSnapshotPtr& snapshot);
+
+        /*** 'frameCommitted' function
+          ** Description: Writes each committed frame into the segment
+          ** Receives:    [snapshot] The world right after the frame was committed
+          ** Returns:     Nothing
+          ***/
+        void frameCommitted(const WorldSnapshotPtr& snapshot);
+
+        /*** 'worldUpdated' function
+          ** Description: Writes the world into the segment after each change
+          ** Receives:    [snapshot] The world right after the change
+          ** Returns:     Nothing
+          ***/
+        void worldUpdated(const WorldSnapshotPtr& snapshot);
+
+        /*** 'read' function
+          ** Description: Reads a consistent copy of the frame in the segment
+          ** Receives:    Nothing
+          ** Returns:     The frame (empty, version 0, if the segment isn't attached), or a null pointer if
+                          the world didn't fit in the segment. While the segment doesn't change, the same
+                          snapshot is returned without copying
+          ***/
+        WorldSnapshotPtr read() const;
+
+        /*** 'version' function
+          ** Description: Gets the version of the frame in the segment, without copying it
+          ** Receives:    Nothing
+          ** Returns:     The version (0 if the segment isn't attached)
+          ***/
+        quint64 version() const;
+};
+
+
+#endif
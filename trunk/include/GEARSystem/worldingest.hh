@@ -0,0 +1,258 @@
+/*** GEARSystem - WorldIngest class
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Prevents multiple definitions
+#ifndef GSWORLDINGEST
+#define GSWORLDINGEST
+
+
+// Includes GEARSystem
+#include <GEARSystem/namespace.hh>
+#include <GEARSystem/Types/types.hh>
+#include <GEARSystem/worldmap.hh>
+
+
+// Inlcudes Qt library
+#include <QtCore/QtCore>
+
+
+// Selects namespace
+using namespace GEARSystem;
+
+
+/*** 'WorldIngest' class
+  ** Description: This class queues the sensor updates of any number of threads and applies them to the world
+                  map from a single thread, in batches, so the sensor threads never wait for the map locks
+  ** Comments:    This class is reentrant and thread-safe. The queue is a bounded ring where producers claim
+                  slots with an atomic counter and the apply thread is the only consumer, so pushing takes no
+                  lock unless the apply thread is asleep. Updates of one thread are applied in the order they
+                  were pushed
+  ***/
+class GEARSystem::WorldIngest : public QThread {
+    public:
+        // Ingest metrics
+        struct Metrics {
+            int     depth;           // Items waiting in the queue
+            int     maxDepth;        // Highest depth seen by the apply thread
+            quint64 pushed;          // Items pushed (applied or waiting)
+            quint64 applied;         // Items applied
+            quint64 batches;         // Batches applied
+            quint64 stalls;          // Pushes that found the queue full and had to wait
+            double  lastLatency;     // Time from push to apply of the oldest item of the last batch, in seconds
+            double  maxLatency;      // Highest latency seen, in seconds
+            double  meanLatency;     // Mean latency of the applied items, in seconds
+            double  lastApplyTime;   // Time taken to apply the last batch, in seconds
+            double  maxApplyTime;    // Highest batch apply time, in seconds
+
+            /*** Constructor
+              ** Description: Creates empty metrics
+              ** Receives:    Nothing
+              ***/
+            Metrics();
+        };
+
+        // Default queue capacity and maximum number of items applied at once
+        static const int defaultCapacity = 4096;
+        static const int maxBatchSize    = 512;
+
+
+    private:
+        // Queued item types
+        enum ItemType {
+            Update,
+            FrameUpdate,
+            BeginFrame,
+            CommitFrame,
+            Frame
+        };
+
+        // A queued item
+        struct Item {
+            ItemType           type;
+            WorldUpdate        update;
+            QList<WorldUpdate> frame;
+            quint32            frameId;
+            double             captureTime;
+            qint64             pushTime;
+        };
+
+        // A ring slot ('sequence' tells if it is free or holds an item for the current lap)
+        struct Slot {
+            QAtomicInteger<quint32> sequence;
+            Item                    item;
+        };
+
+        // World map
+        WorldMap* _worldMap;
+
+        // Queue ring (the capacity is a power of two). Producers claim slots at the tail, the apply thread
+        // takes them at the head and moves the done position after applying them
+        Slot*                   _slots;
+        quint32                 _mask;
+        QAtomicInteger<quint32> _tail;
+        QAtomicInteger<quint32> _head;
+        QAtomicInteger<quint32> _done;
+
+        // Apply thread state
+        QAtomicInt      _running;
+        QAtomicInt      _sleeping;
+        QMutex*         _sleepLock;
+        QWaitCondition* _wakeCondition;
+
+        // Metrics (nanoseconds, measured on '_clock')
+        QElapsedTimer           _clock;
+        QAtomicInteger<quint64> _stalls;
+        QAtomicInteger<quint64> _applied;
+        QAtomicInteger<quint64> _batches;
+        QAtomicInt              _maxDepth;
+        QAtomicInteger<qint64>  _latencySum;
+        QAtomicInteger<qint64>  _lastLatency;
+        QAtomicInteger<qint64>  _maxLatency;
+        QAtomicInteger<qint64>  _lastApplyTime;
+        QAtomicInteger<qint64>  _maxApplyTime;
+
+
+    public:
+        /*** Constructors
+          ** Description: Creates the ingest stage and starts its thread
+          ** Receives:    [worldMap] The world map the updates are applied to
+                          [capacity] The queue capacity (rounded up to a power of two)
+          ***/
+        WorldIngest(WorldMap* worldMap);
+        WorldIngest(WorldMap* worldMap, int capacity);
+
+        /*** Destructor
+          ** Description: Applies the queued updates, stops the thread and destroys the ingest stage
+          ** Receives:    Nothing
+          ***/
+        ~WorldIngest();
+
+
+    public:
+        /*** 'push' functions
+          ** Description: Queues a ball or player update, applied right away or staged in a frame
+          ** Receives:    [frameId]     The number of the frame the update is staged in
+                          [worldUpdate] The update
+          ** Returns:     Nothing
+          ** Comments:    Waits for a free slot if the queue is full
+          ***/
+        void push(const WorldUpdate& worldUpdate);
+        void push(quint32 frameId, const WorldUpdate& worldUpdate);
+
+        /*** Frames handling functions
+          ** Description: Queues the opening or the commit of a frame
+          ** Receives:    [frameId]     The frame number
+                          [captureTime] The frame capture time, in seconds
+          ** Returns:     Nothing
+          ***/
+        void beginFrame(quint32 frameId, double captureTime);
+        void commitFrame(quint32 frameId);
+
+        /*** 'pushFrame' function
+          ** Description: Queues a whole frame, applied at once with 'WorldMap::applyFrame'
+          ** Receives:    [frameId]     The frame number
+                          [captureTime] The frame capture time, in seconds
+                          [updates]     The frame changes
+          ** Returns:     Nothing
+          ** Comments:    The frame takes a single slot, so updates of other threads never land inside it
+          ***/
+        void pushFrame(quint32 frameId, double captureTime, const QList<WorldUpdate>& updates);
+
+        /*** 'flush' function
+          ** Description: Waits until everything queued before the call is applied
+          ** Receives:    Nothing
+          ** Returns:     Nothing
+          ** Comments:    Used before changes that bypass the queue (teams, players and balls), so they keep
+                          their order with the queued updates
+          ***/
+        void flush();
+
+
+    public:
+        /*** 'capacity' function
+          ** Description: Gets the queue capacity
+          ** Receives:    Nothing
+          ** Returns:     The number of items the queue holds
+          ***/
+        int capacity() const;
+
+        /*** 'depth' function
+          ** Description: Gets the number of items waiting in the queue
+          ** Receives:    Nothing
+          ** Returns:     The queue depth
+          ***/
+        int depth() const;
+
+        /*** Metrics functions
+          ** Description: Gets or clears the queue and apply metrics
+          ** Receives:    Nothing
+          ** Returns:     The metrics, or nothing
+          ** Comments:    The counters are read one by one, so they may come from slightly different moments
+          ***/
+        Metrics metrics() const;
+        void    resetMetrics();
+
+
+    protected:
+        /*** 'run' function
+          ** Description: Applies the queued items until the ingest stage is destroyed
+          ** Receives:    Nothing
+          ** Returns:     Nothing
+          ***/
+        void run();
+
+
+    private:
+        /*** 'setup' function
+          ** Description: Creates the ring and starts the thread
+          ** Receives:    [worldMap] The world map the updates are applied to
+                          [capacity] The queue capacity
+          ** Returns:     Nothing
+          ***/
+        void setup(WorldMap* worldMap, int capacity);
+
+        /*** 'enqueue' function
+          ** Description: Stores an item in the ring and wakes the apply thread if it sleeps
+          ** Receives:    [item] The item
+          ** Returns:     Nothing
+          ***/
+        void enqueue(const Item& item);
+
+        /*** 'dequeue' function
+          ** Description: Takes the oldest item of the ring
+          ** Receives:    [item] Where the item will be stored
+          ** Returns:     'true' if an item was taken, 'false' if the ring is empty
+          ** Comments:    Only called by the apply thread
+          ***/
+        bool dequeue(Item* item);
+
+        /*** 'applyBatch' function
+          ** Description: Drains up to 'maxBatchSize' items into the world map
+          ** Receives:    Nothing
+          ** Returns:     The number of items applied
+          ***/
+        int applyBatch();
+
+        /*** 'waitForItems' function
+          ** Description: Sleeps until an item is pushed
+          ** Receives:    Nothing
+          ** Returns:     Nothing
+          ***/
+        void waitForItems();
+
+        /*** 'storeMax' function
+          ** Description: Raises an atomic maximum
+          ** Receives:    [maximum] The maximum
+                          [value]   The new value
+          ** Returns:     Nothing
+          ***/
+        static void storeMax(QAtomicInteger<qint64>& maximum, qint64 value);
+};
+
+
+#endif
@@ -0,0 +1,59 @@
+/*** GEARSystem - WorldListener class
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Prevents multiple definitions
+#ifndef GSWORLDLISTENER
+#define GSWORLDLISTENER
+
+
+// Includes GEARSystem
+#include <GEARSystem/namespace.hh>
+#include <GEARSystem/worldsnapshot.hh>
+
+
+// Selects namespace
+using namespace GEARSystem;
+
+
+/*** 'WorldListener' abstract class
+  ** Description: This class is notified of each committed frame, and must be inherited by objects that
+                  want frames pushed to them (from a WorldMap or from a subscribed Controller). Listeners
+                  registered with 'WorldMap::addUpdateListener' are also notified of every other change
+  ** Comments:    'frameCommitted' and 'worldUpdated' are called from the thread that made (or received) the
+                  change, so they should return quickly
+  ***/
+class GEARSystem::WorldListener {
+    public:
+        /*** Destructor
+          ** Description: Destroys the listener
+          ** Receives:    Nothing
+          ***/
+        virtual ~WorldListener();
+
+
+    public:
+        /*** 'frameCommitted' function
+          ** Description: Receives a committed frame
+          ** Receives:    [snapshot] The world right after the frame was committed
+          ** Returns:     Nothing
+          ***/
+        virtual void frameCommitted(const WorldSnapshotPtr& snapshot) = 0;
+
+        /*** 'worldUpdated' function
+          ** Description: Receives the world after any change (frames, values set one by one, roster, field and
+                          radio values)
+          ** Receives:    [snapshot] The world right after the change
+          ** Returns:     Nothing
+          ** Comments:    Does nothing by default. Concurrent changes may deliver an older world after a newer
+                          one; 'WorldSnapshot::version' tells them apart
+          ***/
+        virtual void worldUpdated(const WorldSnapshotPtr& snapshot);
+};
+
+
+#endif
@@ -13,7 +13,12 @@
 
 // Includes GEARSystem
 #include <GEARSystem/namespace.hh>
+#include <GEARSystem/lockpolicy.hh>
 #include <GEARSystem/Types/types.hh>
+#include <GEARSystem/worldsnapshot.hh>
+#include <GEARSystem/worldlistener.hh>
+#include <GEARSystem/motionmodel.hh>
+#include <GEARSystem/batchgeometry.hh>
 
 
 // Inlcudes Qt library
@@ -30,16 +35,22 @@ using namespace GEARSystem;
   ***/
 class GEARSystem::WorldMap {
     private:
-        // GEARSystemTeams info
+        // Entities capacity (team, player and ball numbers are 8-bit)
+        static const int _maxEntities = 256;
+
+        // GEARSystemTeams info (teams are indexed by number and taken from the pool)
         uint8 _nGEARSystemTeams;
-        QHash<uint8,bool> _validGEARSystemTeams;
-        QHash<uint8,GEARSystemTeam> _teams;
+        IdBitmap                 _validGEARSystemTeams;
+        GEARSystemTeam*          _teams[_maxEntities];
+        QVector<GEARSystemTeam*> _teamPool;
+        QAtomicInteger<quint64>  _teamAllocations;
+        QAtomicInteger<quint64>  _teamReuses;
 
-        // Balls info
+        // Balls info (indexed by number)
         uint8 _nBalls;
-        QHash<uint8,bool>      _validBalls;
-        QHash<uint8,Position*> _ballsPositions;
-        QHash<uint8,Velocity*> _ballsVelocities;
+        IdBitmap _validBalls;
+        Position _ballsPositions[_maxEntities];
+        Velocity _ballsVelocities[_maxEntities];
 
         // Invalid types
         Angle        _invalidAngle;
@@ -52,11 +63,169 @@ class GEARSystem::WorldMap {
         // Field info
         Field _field;
 
-        // Locks
-        //#ifdef GSTHREADSAFE
-        mutable QReadWriteLock* _ballsLock;
-        mutable QReadWriteLock* _teamsLock;
-        //#endif
+        // Published snapshot
+        bool                    _snapshotMode;
+        QAtomicInteger<quint64> _version;
+        WorldSnapshotPtr        _snapshot;
+
+        // Field version, bumped only when the field changes
+        QAtomicInteger<quint64> _geometryVersion;
+
+        // Roster version, bumped only when teams, players or balls are added or removed
+        QAtomicInteger<quint64> _rosterVersion;
+
+        // Frames info (the open frames are keyed by frame number and guarded by the frame lock)
+        struct OpenFrame {
+            double             captureTime;
+            qint64             openTime;
+            QList<WorldUpdate> updates;
+        };
+        QHash<quint32,OpenFrame> _openFrames;
+        QElapsedTimer            _frameClock;
+        int                      _frameTimeout;
+        quint32                  _frameId;      // Guarded by the balls lock
+        double                   _captureTime;  // Guarded by the balls lock
+
+        // Frame and update listeners (the count lets changes skip the lock while there are no update listeners)
+        mutable QList<WorldListener*> _listeners;
+        mutable QList<WorldListener*> _updateListeners;
+        mutable QAtomicInt            _nUpdateListeners;
+
+        // Samples history (players are keyed by team and player numbers)
+        int                              _historyLength;
+        QHash<uint8,TrajectoryHistory>   _ballsHistory;
+        QHash<quint16,TrajectoryHistory> _playersHistory;
+
+        // Predictions model
+        MotionModel* _motionModel;
+
+        // Spatial index (packed player positions of the indexed version)
+        mutable quint64          _indexVersion;
+        mutable QVector<float>   _indexX;
+        mutable QVector<float>   _indexY;
+        mutable QVector<quint16> _indexPlayers;
+        mutable QVector<float>   _indexDistances;
+
+        // State locks (of the build lock policy). The roster lock guards which teams and players exist and is
+        // only taken for writing when they change; the players of each team are guarded by the team stripe
+        mutable Lock _ballsLock;
+        mutable Lock _rosterLock;
+        mutable Lock _teamLocks[_maxEntities];
+        mutable Lock _historyLock;
+        mutable Lock _motionModelLock;
+
+        // Publishing and frames locks
+        mutable QMutex* _publishLock;
+        mutable QMutex* _frameLock;
+        mutable QMutex* _listenersLock;
+        mutable QMutex* _indexLock;
+
+
+    private:
+        /*** 'buildSnapshot' function
+          ** Description: Copies the current state into a new snapshot
+          ** Receives:    Nothing
+          ** Returns:     The snapshot
+          ***/
+        WorldSnapshotPtr buildSnapshot() const;
+
+        /*** Team stripes functions
+          ** Description: Locks or unlocks the stripes of a set of teams, in ascending team order so that
+                          threads locking several stripes never deadlock
+          ** Receives:    [teams] The teams
+          ** Returns:     Nothing
+          ** Comments:    Must be called with the roster lock held
+          ***/
+        void lockTeamsForRead(const IdBitmap& teams) const;
+        void lockTeamsForWrite(const IdBitmap& teams) const;
+        void unlockTeams(const IdBitmap& teams) const;
+
+        /*** 'changedTeams' function
+          ** Description: Gets the teams changed by a list of updates
+          ** Receives:    [updates] The updates
+          ** Returns:     The teams
+          ***/
+        static IdBitmap changedTeams(const QList<WorldUpdate>& updates);
+
+        /*** 'rosterTeams' function
+          ** Description: Gets the teams in the map
+          ** Receives:    Nothing
+          ** Returns:     The teams
+          ** Comments:    Must be called with the roster lock held
+          ***/
+        IdBitmap rosterTeams() const;
+
+        /*** 'newTeam' function
+          ** Description: Allocates a team for the pool
+          ** Receives:    Nothing
+          ** Returns:     The team, which doesn't lock itself since the roster lock and its team stripe guard it
+          ***/
+        static GEARSystemTeam* newTeam();
+
+        /*** Updated functions
+          ** Description: Bumps the map version (and the geometry version, for field changes), publishes the change
+                          in snapshot mode and notifies the update listeners
+          ** Receives:    Nothing
+          ** Returns:     Nothing
+          ** Comments:    Must be called with no lock held
+          ***/
+        void updated();
+        void geometryUpdated();
+
+        /*** 'apply' function
+          ** Description: Applies a change to the shared state
+          ** Receives:    [worldUpdate] The change
+          ** Returns:     Nothing
+          ** Comments:    Must be called with the roster lock and the write lock of the changed ball or team held
+          ***/
+        void apply(const WorldUpdate& worldUpdate);
+
+        /*** 'record' function
+          ** Description: Stores a sample of each ball and player changed by a committed frame
+          ** Receives:    [updates]     The frame updates
+                          [captureTime] The frame capture time
+          ** Returns:     Nothing
+          ** Comments:    Must be called with the roster lock and the changed teams and balls locks held
+          ***/
+        void record(const QList<WorldUpdate>& updates, double captureTime);
+
+        /*** 'expireFrames' function
+          ** Description: Drops the open frames that waited longer than the frame timeout for their commit
+          ** Receives:    Nothing
+          ** Returns:     Nothing
+          ** Comments:    Must be called with the frame lock held
+          ***/
+        void expireFrames();
+
+        /*** 'publishFrame' function
+          ** Description: Applies the updates of a frame at once, records them, publishes the world and notifies
+                          the listeners
+          ** Receives:    [updates]     The frame updates
+                          [frameId]     The frame number
+                          [captureTime] The frame capture time, in seconds
+          ** Returns:     Nothing
+          ** Comments:    Must be called with no lock held
+          ***/
+        void publishFrame(const QList<WorldUpdate>& updates, quint32 frameId, double captureTime);
+
+        /*** 'predictionInterval' function
+          ** Description: Calculates how far a value must be predicted
+          ** Receives:    [captureTime]     The value capture time (0 if it has none)
+                          [lastCaptureTime] The capture time of the last frame, used if the value has none
+                          [time]            The wanted time
+          ** Returns:     The interval, bounded by the motion model (0 if no frame was captured yet)
+          ** Comments:    Must be called with the motion model lock held
+          ***/
+        double predictionInterval(double captureTime, double lastCaptureTime, double time) const;
+
+        /*** 'updateIndex' function
+          ** Description: Packs the known player positions into the spatial index, if the map changed since the
+                          last call
+          ** Receives:    Nothing
+          ** Returns:     Nothing
+          ** Comments:    Must be called with the index lock held
+          ***/
+        void updateIndex() const;
 
 
     public:
@@ -94,6 +263,259 @@ class GEARSystem::WorldMap {
          uint8 teamNumber(const QString& name) const;
 
 
+    public:
+        /*** 'setSnapshotMode' function
+          ** Description: Enables the snapshot mode. In this mode, getters never lock: they read the last published
+                          snapshot, which is replaced by an atomic pointer swap after each change
+          ** Receives:    [enable] 'true' to read from snapshots, 'false' to read the shared state under locks
+          ** Returns:     Nothing
+          ** Comments:    Must be set before readers and writers are started
+          ***/
+        void setSnapshotMode(bool enable);
+        bool snapshotMode() const;
+
+        /*** 'version' function
+          ** Description: Gets the map version, bumped on every change
+          ** Receives:    Nothing
+          ** Returns:     The version
+          ***/
+        quint64 version() const;
+
+        /*** 'geometryVersion' function
+          ** Description: Gets the field version, bumped only when the field changes
+          ** Receives:    Nothing
+          ** Returns:     The version
+          ** Comments:    Lets clients keep the field until it changes, as the map version moves every frame
+          ***/
+        quint64 geometryVersion() const;
+
+        /*** 'snapshot' function
+          ** Description: Gets a consistent copy of the world. In snapshot mode this is the last published
+                          snapshot and the call never blocks a writer
+          ** Receives:    Nothing
+          ** Returns:     The snapshot
+          ***/
+        WorldSnapshotPtr snapshot() const;
+
+        /*** 'publishSnapshot' function
+          ** Description: Builds and publishes a snapshot of the current state
+          ** Receives:    Nothing
+          ** Returns:     Nothing
+          ***/
+        void publishSnapshot();
+
+
+    public:
+        // Default time an open frame waits for its commit, in milliseconds
+        static const int defaultFrameTimeout = 1000;
+
+        /*** Frames handling functions
+          ** Description: Groups the changes of a vision frame. Ball and player values staged in a frame between
+                          'beginFrame' and 'commitFrame' are applied at once, so readers only see complete frames
+          ** Receives:    [frameId]     The frame number
+                          [captureTime] The frame capture time, in seconds
+                          [worldUpdate] The change
+                          [updates]     The changes
+          ** Returns:     Nothing, or 'true' if the frame is open
+          ** Comments:    Frames are kept apart by number, so several sensors may fill their frames at once, and
+                          only 'stageUpdate' and 'stageUpdates' stage changes: the setters and 'applyUpdates' apply right away.
+                          Staged values that carry no capture info are stamped with the frame number and capture
+                          time, and values staged in a frame that isn't open are applied right away. A frame
+                          dropped with 'abandonFrame' or left open longer than the frame timeout is discarded
+          ***/
+        void beginFrame(quint32 frameId, double captureTime);
+        void stageUpdate(quint32 frameId, const WorldUpdate& worldUpdate);
+        void stageUpdates(quint32 frameId, const QList<WorldUpdate>& updates);
+        void commitFrame(quint32 frameId);
+        void abandonFrame(quint32 frameId);
+        bool inFrame(quint32 frameId) const;
+
+        /*** Frame timeout functions
+          ** Description: Handles how long an open frame waits for its commit, so the frames of a sensor that
+                          stopped are dropped
+          ** Receives:    [msecs] The timeout, in milliseconds (0 or less keeps the frames open)
+          ** Returns:     Nothing, or the timeout
+          ** Comments:    Expired frames are dropped when another frame begins
+          ***/
+        void setFrameTimeout(int msecs);
+        int  frameTimeout() const;
+
+        /*** Last frame info functions
+          ** Description: Gets the number and capture time of the last committed frame
+          ** Receives:    Nothing
+          ** Returns:     The frame number or capture time
+          ***/
+        quint32 frameId()     const;
+        double  captureTime() const;
+
+        /*** 'update' function
+          ** Description: Applies and publishes a change right away
+          ** Receives:    [worldUpdate] The change
+          ** Returns:     Nothing
+          ***/
+        void update(const WorldUpdate& worldUpdate);
+
+        /*** 'applyUpdates' function
+          ** Description: Applies and publishes all the changes at once
+          ** Receives:    [updates] The changes
+          ** Returns:     Nothing
+          ** Comments:    Takes each lock once for the whole list, so it is cheaper than setting the values one
+                          by one
+          ***/
+        void applyUpdates(const QList<WorldUpdate>& updates);
+
+        /*** 'applyFrame' function
+          ** Description: Applies a whole frame at once, as 'beginFrame', 'stageUpdate' and 'commitFrame' would
+          ** Receives:    [frameId]     The frame number
+                          [captureTime] The frame capture time, in seconds
+                          [updates]     The frame changes
+          ** Returns:     Nothing
+          ** Comments:    The frame isn't staged, so the frames opened with 'beginFrame' are left untouched
+          ***/
+        void applyFrame(quint32 frameId, double captureTime, const QList<WorldUpdate>& updates);
+
+        /*** Listeners handling functions
+          ** Description: Registers or unregisters an object notified after each 'commitFrame'
+          ** Receives:    [listener] The listener
+          ** Returns:     Nothing
+          ** Comments:    Listeners are called while a lock is held, so they must not register or unregister
+                          listeners themselves. After 'removeListener' returns, the listener is no longer called
+          ***/
+        void addListener(WorldListener* listener) const;
+        void removeListener(WorldListener* listener) const;
+
+        /*** Update listeners handling functions
+          ** Description: Registers or unregisters an object notified with 'worldUpdated' after every change
+          ** Receives:    [listener] The listener
+          ** Returns:     Nothing
+          ** Comments:    Same rules as the frame listeners. While none is registered, changes build no snapshot
+                          for them
+          ***/
+        void addUpdateListener(WorldListener* listener) const;
+        void removeUpdateListener(WorldListener* listener) const;
+
+
+    public:
+        // Default number of samples kept for each ball and player
+        static const int defaultHistoryLength = 120;
+
+        /*** History length functions
+          ** Description: Handles the number of samples kept for each ball and player
+          ** Receives:    [length] The number of samples (0 disables the history)
+          ** Returns:     Nothing, or the number of samples
+          ** Comments:    Samples are only stored by 'commitFrame', with the frame capture time
+          ***/
+        void setHistoryLength(int length);
+        int  historyLength() const;
+
+        /*** Positions at a time functions
+          ** Description: Gets a ball or player pose at a given capture time, interpolating the stored samples
+          ** Receives:    [ballNum]   The ball number
+                          [teamNum]   The team number
+                          [playerNum] The player number
+                          [time]      The capture time, in seconds
+          ** Returns:     The position or orientation (the latest one after the last frame, invalid if the time is
+                          older than the history)
+          ***/
+        const Position ballPositionAt(uint8 ballNum, double time) const;
+        const Position playerPositionAt(uint8 teamNum, uint8 playerNum, double time) const;
+        const Angle    playerOrientationAt(uint8 teamNum, uint8 playerNum, double time) const;
+
+        /*** Trajectory functions
+          ** Description: Gets the stored samples of a ball or player in a time interval
+          ** Receives:    [ballNum]   The ball number
+                          [teamNum]   The team number
+                          [playerNum] The player number
+                          [startTime] The interval start, in seconds
+                          [endTime]   The interval end, in seconds
+          ** Returns:     The samples, oldest first
+          ***/
+        QList<TrajectorySample> ballTrajectory(uint8 ballNum, double startTime, double endTime) const;
+        QList<TrajectorySample> playerTrajectory(uint8 teamNum, uint8 playerNum, double startTime, double endTime) const;
+
+
+    public:
+        /*** 'setMotionModel' function
+          ** Description: Sets the model used to predict the balls and players
+          ** Receives:    [model] The model (the map takes its ownership, and NULL restores the default model)
+          ** Returns:     Nothing
+          ***/
+        void setMotionModel(MotionModel* model);
+
+        /*** Prediction functions
+          ** Description: Predicts a ball position or a player pose at a given capture time, from the last known
+                          state and the motion model
+          ** Receives:    [ballNum]   The ball number
+                          [teamNum]   The team number
+                          [playerNum] The player number
+                          [time]      The capture time, in seconds (on the frames clock)
+          ** Returns:     The predicted position, or the predicted pose along with the last known velocity
+          ** Comments:    Times before the last capture return the last known state; use the history functions
+                          for past states
+          ***/
+        const Position   predictedBallPosition(uint8 ballNum, double time) const;
+        TrajectorySample predictedPlayerPose(uint8 teamNum, uint8 playerNum, double time) const;
+
+
+    public:
+        /*** Spatial query functions
+          ** Description: Finds the players closest to a point, within a radius of a point, or within a radius of a
+                          segment (a pass lane)
+          ** Receives:    [point]  The queried point
+                          [k]      The maximum number of players
+                          [radius] The search radius
+                          [a]      The segment start
+                          [b]      The segment end
+                          [teams]  The teams searched (an empty bitmap searches all teams)
+          ** Returns:     The players and their distances to the point or segment, closest first
+          ** Comments:    Players with unknown or invalid positions are never returned. An empty 'segmentClearance'
+                          list means the lane is clear
+          ***/
+        QList<PlayerDistance> nearestPlayers(const Position& point, int k) const;
+        QList<PlayerDistance> nearestPlayers(const Position& point, int k, const IdBitmap& teams) const;
+        QList<PlayerDistance> playersWithinRadius(const Position& point, float radius) const;
+        QList<PlayerDistance> playersWithinRadius(const Position& point, float radius, const IdBitmap& teams) const;
+        QList<PlayerDistance> segmentClearance(const Position& a, const Position& b, float radius) const;
+        QList<PlayerDistance> segmentClearance(const Position& a, const Position& b, float radius, const IdBitmap& teams) const;
+
+
+    public:
+        // Number of free teams the pool starts with
+        static const int defaultTeamPoolSize = 2;
+
+        /*** Entity pool functions
+          ** Description: Handles the pool the teams are taken from. Balls and players live in fixed slots of the
+                          map and of their teams, so adding, deleting or updating them never allocates
+          ** Receives:    [teams] The number of free teams the pool must hold
+          ** Returns:     Nothing, the number of free teams, or the number of teams allocated or reused since the
+                          map was created
+          ** Comments:    'addTeam' only allocates a team when the pool is empty, and 'delGEARSystemTeam' gives the
+                          team back to the pool
+          ***/
+        void    reserveTeams(int teams);
+        int     pooledTeams() const;
+        quint64 teamAllocations() const;
+        quint64 teamReuses() const;
+
+
+    public:
+        /*** Roster functions
+          ** Description: Gets which teams, players and balls exist, as bitmaps, and the roster version
+          ** Receives:    [teamNum]      The team number
+                          [sinceVersion] A roster version seen before
+          ** Returns:     The teams, players or balls bitmap, the roster version, or 'true' if the roster changed
+                          after 'sinceVersion'
+          ** Comments:    The version is bumped only when a team, player or ball is added or removed (or a team is
+                          replaced), so clients may keep their lists until it moves. The bitmaps are kept up to
+                          date as the roster changes, never rebuilt
+          ***/
+        IdBitmap teamsBitmap() const;
+        IdBitmap playersBitmap(uint8 teamNum) const;
+        IdBitmap ballsBitmap() const;
+        quint64  rosterVersion() const;
+        bool     rosterChanged(quint64 sinceVersion) const;
+
+
     public:
         /*** Balls handling functions
           ** Description: Handles the balls
@@ -150,18 +572,28 @@ class GEARSystem::WorldMap {
           ** Description: Gets the player pose, velocity and angular speed
           ** Receives:    [teamNum]   The team number
                           [playerNum] The player number
-          ** Returns:     The player position, orientation, velocity or angular speed
+          ** Returns:     The player position, orientation, velocity or angular speed (copies, never torn)
           ***/
-        const Position&     playerPosition(uint8 teamNum, uint8 playerNum)     const;
-        const Angle&        playerOrientation(uint8 teamNum, uint8 playerNum)  const;
-        const Velocity&     playerVelocity(uint8 teamNum, uint8 playerNum)     const;
-        const AngularSpeed& playerAngularSpeed(uint8 teamNum, uint8 playerNum) const;
+        const Position      playerPosition(uint8 teamNum, uint8 playerNum)     const;
+        const Angle         playerOrientation(uint8 teamNum, uint8 playerNum)  const;
+        const Velocity      playerVelocity(uint8 teamNum, uint8 playerNum)     const;
+        const AngularSpeed  playerAngularSpeed(uint8 teamNum, uint8 playerNum) const;
         bool                ballPossession(uint8 teamNum, uint8 playerNum)     const;
         bool                kickEnabled(uint8 teamNum, uint8 playerNum)        const;
         bool                dribbleEnabled(uint8 teamNum, uint8 playerNum)     const;
         unsigned char       batteryCharge(uint8 teamNum, uint8 playerNum)      const;
         unsigned char       capacitorCharge(uint8 teamNum, uint8 playerNum)    const;
 
+        /*** 'playerState' function
+          ** Description: Gets the whole player state at once
+          ** Receives:    [teamNum]   The team number
+                          [playerNum] The player number
+          ** Returns:     The player state, invalid if there is no such team or player
+          ** Comments:    The state is read under a single lock (or from a single snapshot), so its fields always come
+                          from the same update
+          ***/
+        PlayerState playerState(uint8 teamNum, uint8 playerNum) const;
+
         /*** 'setPlayerPosition' function
           ** Description: Sets the player position
           ** Receives:    [teamNum]   The team number
@@ -280,6 +712,15 @@ class GEARSystem::WorldMap {
         const Position& rightPenaltyMark() const;
 
         float fieldCenterRadius() const;
+
+        /*** Field geometry functions
+          ** Description: Replaces every field element at once, or gets a consistent copy of the whole field
+          ** Receives:    [field] The new field
+          ** Returns:     Nothing, or the field
+          ** Comments:    Setting the geometry bumps the geometry version only once
+          ***/
+        void        setFieldGeometry(const Field& field);
+        const Field fieldGeometry() const;
 };
 
 
@@ -0,0 +1,114 @@
+/*** GEARSystem - WorldPublisher class
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Prevents multiple definitions
+#ifndef GSWORLDPUBLISHER
+#define GSWORLDPUBLISHER
+
+
+// Includes GEARSystem
+#include <GEARSystem/namespace.hh>
+#include <GEARSystem/worldlistener.hh>
+#include <GEARSystem/worldsnapshot.hh>
+#include <GEARSystem/CORBAImplementations/corbainterfaces.hh>
+
+
+// Inlcudes Qt library
+#include <QtCore/QtCore>
+
+
+// Selects namespace
+using namespace GEARSystem;
+
+
+/*** 'WorldPublisher' class
+  ** Description: This class listens to a world map and pushes each committed frame to the subscribed
+                  remote listeners
+  ** Comments:    This class is reentrant and thread-safe. Frames are sent from the publisher thread, so
+                  committing a frame never waits for the network. If frames are committed faster than
+                  they can be sent, only the latest one is pushed
+  ***/
+class GEARSystem::WorldPublisher : public QThread, public WorldListener {
+    private:
+        // World map
+        const WorldMap* _worldMap;
+
+        // Subscribers
+        QHash<QString,CORBAInterfaces::WorldListener_var> _subscribers;
+
+        // Latest frame not yet pushed
+        WorldSnapshotPtr _pendingFrame;
+        bool             _running;
+
+        // Locks
+        mutable QMutex* _publisherLock;
+        QWaitCondition* _frameAvailable;
+
+
+    public:
+        /*** Constructor
+          ** Description: Creates the publisher, registers it at the world map and starts its thread
+          ** Receives:    [worldMap] The world map
+          ***/
+        WorldPublisher(const WorldMap* worldMap);
+
+        /*** Destructor
+          ** Description: Unregisters the publisher, stops its thread and destroys it
+          ** Receives:    Nothing
+          ***/
+        ~WorldPublisher();
+
+
+    public:
+        /*** Subscribers handling functions
+          ** Description: Adds or removes a remote listener
+          ** Receives:    [name]     The subscriber name
+                          [listener] The remote listener
+          ** Returns:     Nothing
+          ***/
+        void subscribe(const QString& name, const CORBAInterfaces::WorldListener_var& listener);
+        void unsubscribe(const QString& name);
+
+        /*** 'subscribers' function
+          ** Description: Gets the number of subscribers
+          ** Receives:    Nothing
+          ** Returns:     The number of subscribers
+          ***/
+        int subscribers() const;
+
+
+    public:
+        /*** 'frameCommitted' function
+          ** Description: Queues a committed frame to be pushed to the subscribers
+          ** Receives:    [snapshot] The world right after the frame was committed
+          ** Returns:     Nothing
+          ***/
+        void frameCommitted(const WorldSnapshotPtr& snapshot);
+
+
+    private:
+        /*** 'dropSubscriber' function
+          ** Description: Removes a subscriber that failed, unless it subscribed again meanwhile
+          ** Receives:    [name]     The subscriber name
+                          [listener] The remote listener that failed
+          ** Returns:     Nothing
+          ***/
+        void dropSubscriber(const QString& name, const CORBAInterfaces::WorldListener_var& listener);
+
+
+    protected:
+        /*** 'run' function
+          ** Description: Pushes the queued frames until the publisher is stopped
+          ** Receives:    Nothing
+          ** Returns:     Nothing
+          ***/
+        void run();
+};
+
+
+#endif
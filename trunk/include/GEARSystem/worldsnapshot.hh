@@ -0,0 +1,186 @@
+/*** GEARSystem - WorldSnapshot class
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Prevents multiple definitions
+#ifndef GSWORLDSNAPSHOT
+#define GSWORLDSNAPSHOT
+
+
+// Includes GEARSystem
+#include <GEARSystem/namespace.hh>
+#include <GEARSystem/Types/types.hh>
+#include <GEARSystem/CORBAImplementations/corbainterfaces.hh>
+
+
+// Inlcudes Qt library
+#include <QtCore/QtCore>
+
+// Includes shared pointers
+#include <memory>
+
+
+// Selects namespace
+using namespace GEARSystem;
+
+
+// Defines the shared snapshot handle
+namespace GEARSystem {
+    typedef std::shared_ptr<const WorldSnapshot> WorldSnapshotPtr;
+}
+
+
+/*** 'WorldSnapshot' class
+  ** Description: This class is an immutable, versioned copy of the game world
+  ** Comments:    This class is reentrant and, as it is never modified after being published, thread-safe
+  ***/
+class GEARSystem::WorldSnapshot {
+    // The world map and the shared world build the snapshots
+    friend class GEARSystem::WorldMap;
+    friend class GEARSystem::SharedWorld;
+
+    private:
+        // World version and last frame info
+        quint64 _version;
+        quint32 _frameId;
+        double  _captureTime;
+
+        // Teams info (only the players in each team are kept, in ascending player order)
+        struct TeamState {
+            QString              name;
+            QVector<PlayerState> players;
+        };
+        QHash<uint8,TeamState> _teams;
+
+        // Balls info
+        QHash<uint8,Position> _ballsPositions;
+        QHash<uint8,Velocity> _ballsVelocities;
+
+        // Field info
+        Field _field;
+
+        // Invalid types
+        Angle        _invalidAngle;
+        AngularSpeed _invalidAngularSpeed;
+        Position     _invalidPosition;
+        Velocity     _invalidVelocity;
+        QString      _invalidName;
+        static const uint8 _invalidNumber = -1;
+
+
+    private:
+        /*** 'findPlayer' function
+          ** Description: Finds the state of a player
+          ** Receives:    [teamNum]   The team number
+                          [playerNum] The player number
+          ** Returns:     The player state, or NULL if there is no such player
+          ***/
+        const PlayerState* findPlayer(uint8 teamNum, uint8 playerNum) const;
+
+        /*** 'playerIndex' function
+          ** Description: Finds where a player is, or would be, in the players of a team
+          ** Receives:    [players]   The players of the team, in ascending player order
+                          [playerNum] The player number
+          ** Returns:     The index of the first player whose number isn't lower than 'playerNum'
+          ***/
+        static int playerIndex(const QVector<PlayerState>& players, uint8 playerNum);
+
+
+    public:
+        /*** Constructor
+          ** Description: Creates an empty snapshot (version 0)
+          ** Receives:    Nothing
+          ***/
+        WorldSnapshot();
+
+        /*** Constructor
+          ** Description: Creates a snapshot from a CORBA WorldState
+          ** Receives:    [state] The CORBA WorldState
+          ***/
+        WorldSnapshot(const CORBATypes::WorldState& state);
+
+
+    public:
+        /*** 'toCORBA' function
+          ** Description: Copies the snapshot to a CORBA WorldState
+          ** Receives:    [other] The CORBA WorldState
+          ** Returns:     Nothing
+          ***/
+        void toCORBA(CORBATypes::WorldState* other) const;
+
+
+    public:
+        /*** 'version' function
+          ** Description: Gets the world map version this snapshot was taken at
+          ** Receives:    Nothing
+          ** Returns:     The version
+          ***/
+        quint64 version() const;
+
+        /*** Frame info functions
+          ** Description: Gets the number and capture time of the last frame committed before this snapshot
+          ** Receives:    Nothing
+          ** Returns:     The frame number or capture time
+          ***/
+        quint32 frameId()     const;
+        double  captureTime() const;
+
+
+    public:
+        /*** Teams info functions
+          ** Description: Gets the teams info
+          ** Receives:    [teamNum] The team number
+                          [name]    The team name
+          ** Returns:     The teams list (in ascending order), the team name or the team number
+          ***/
+        QList<uint8>   teams() const;
+        const QString& teamName(uint8 teamNum) const;
+        uint8          teamNumber(const QString& name) const;
+
+
+    public:
+        /*** Balls info functions
+          ** Description: Gets the balls info
+          ** Receives:    [ballNum] The ball number
+          ** Returns:     The balls list (in ascending order), the ball position or the ball velocity
+          ***/
+        QList<uint8>    balls() const;
+        const Position& ballPosition(uint8 ballNum) const;
+        const Velocity& ballVelocity(uint8 ballNum) const;
+
+
+    public:
+        /*** Players info functions
+          ** Description: Gets the player state
+          ** Receives:    [teamNum]   The team number
+                          [playerNum] The player number
+          ** Returns:     The players list (in ascending order) or the player pose, velocity, angular speed, flags and charges
+          ***/
+        QList<uint8>        players(uint8 teamNum) const;
+        const Position&     playerPosition(uint8 teamNum, uint8 playerNum)     const;
+        const Angle&        playerOrientation(uint8 teamNum, uint8 playerNum)  const;
+        const Velocity&     playerVelocity(uint8 teamNum, uint8 playerNum)     const;
+        const AngularSpeed& playerAngularSpeed(uint8 teamNum, uint8 playerNum) const;
+        bool                ballPossession(uint8 teamNum, uint8 playerNum)     const;
+        bool                kickEnabled(uint8 teamNum, uint8 playerNum)        const;
+        bool                dribbleEnabled(uint8 teamNum, uint8 playerNum)     const;
+        unsigned char       batteryCharge(uint8 teamNum, uint8 playerNum)      const;
+        unsigned char       capacitorCharge(uint8 teamNum, uint8 playerNum)    const;
+        PlayerState         playerState(uint8 teamNum, uint8 playerNum)        const;
+
+
+    public:
+        /*** 'field' function
+          ** Description: Gets the field info
+          ** Receives:    Nothing
+          ** Returns:     The field
+          ***/
+        const Field& field() const;
+};
+
+
+#endif
@@ -38,6 +38,7 @@ fi
 if [ -d /usr/include/GEARSystem ];
     then
         cp -rf include/GEARSystem/* /usr/include/GEARSystem
+        cp -f tmp/include/GEARSystem/lockconfig.hh /usr/include/GEARSystem
         echo ""
         echo ">> GEARSystem: Installation complete!!"
 
@@ -48,6 +48,16 @@ void CORBAImplementations::Actuator::setSpeed(Octet teamNum, Octet playerNum, Fl
     _actuator->setSpeed(teamNum, playerNum, x, y, theta);
 }
 
+/*** 'setSpeeds'
+  ** Description: Sets the speed of several players at once
+  ** Receives:    [commands] The speed commands
+  ** Returns:     Nothing
+  ***/
+void CORBAImplementations::Actuator::setSpeeds(const CORBATypes::RobotCommandSeq& commands) {
+    // Sends the commands via the actuator
+    _actuator->setSpeeds(RobotCommand::fromCORBA(commands));
+}
+
 /*** 'kick'
   ** Description: Activates the player kicking device
   ** Receives:    [teamNum]   The team number
@@ -112,3 +122,37 @@ void CORBAImplementations::Actuator::holdBall(Octet teamNum, Octet playerNum, Bo
     // Sends the command via the actuator
     _actuator->holdBall(teamNum, playerNum, enable);
 }
+
+
+/*** Asynchronous commands
+  ** Description: Oneway versions of the commands above; the caller doesn't wait for a reply
+  ** Receives:    The same arguments of the synchronous commands
+  ** Returns:     Nothing
+  ***/
+void CORBAImplementations::Actuator::setSpeedAsync(Octet teamNum, Octet playerNum, Float x, Float y, Float theta) {
+    setSpeed(teamNum, playerNum, x, y, theta);
+}
+
+void CORBAImplementations::Actuator::setSpeedsAsync(const CORBATypes::RobotCommandSeq& commands) {
+    setSpeeds(commands);
+}
+
+void CORBAImplementations::Actuator::kickAsync(Octet teamNum, Octet playerNum, Float power) {
+    kick(teamNum, playerNum, power);
+}
+
+void CORBAImplementations::Actuator::chipKickAsync(Octet teamNum, Octet playerNum, Float power) {
+    chipKick(teamNum, playerNum, power);
+}
+
+void CORBAImplementations::Actuator::kickOnTouchAsync(Octet teamNum, Octet playerNum, Boolean enable, Float power) {
+    kickOnTouch(teamNum, playerNum, enable, power);
+}
+
+void CORBAImplementations::Actuator::chipKickOnTouchAsync(Octet teamNum, Octet playerNum, Boolean enable, Float power) {
+    chipKickOnTouch(teamNum, playerNum, enable, power);
+}
+
+void CORBAImplementations::Actuator::holdBallAsync(Octet teamNum, Octet playerNum, Boolean enable) {
+    holdBall(teamNum, playerNum, enable);
+}
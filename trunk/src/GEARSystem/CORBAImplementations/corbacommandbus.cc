@@ -30,13 +30,14 @@ CORBAImplementations::CommandBus::CommandBus(GEARSystem::CommandBus* commandBus)
 
 /*** 'addActuator'
   ** Description: Adds an actuator to the command bus
-  ** Receives:    [name]    The actuator name
-                  [address] The actuator corba address
+  ** Receives:    [name]      The actuator name
+                  [address]   The actuator corba address
+                  [ownership] The teams and players the actuator drives
   ** Returns:     Nothing
   ***/
-void CORBAImplementations::CommandBus::addActuator(const char* name, const char* address) {
+void CORBAImplementations::CommandBus::addActuator(const char* name, const char* address, const CORBATypes::TeamOwnershipSeq& ownership) {
     // Adds the actuator to the command bus
-    _commandBus->addActuator(QString(name), QString(address));
+    _commandBus->addActuator(QString(name), QString(address), ActuatorOwnership(ownership));
 }
 
 /*** 'delActuator'
@@ -31,6 +31,27 @@ CORBAImplementations::Controller::Controller(const WorldMap* worldMap, const GEA
     // Sets the controller elements
     _worldMap   = worldMap;
     _commandBus = commandBus;
+
+    // Creates the frames publisher
+    _publisher = new WorldPublisher(worldMap);
+}
+
+/*** Destructor
+  ** Description: Destroys the controller
+  ** Receives:    Nothing
+  ***/
+CORBAImplementations::Controller::~Controller() {
+    delete _publisher;
+}
+
+
+/*** 'worldMap' function
+  ** Description: Gets the world map the controller reads from
+  ** Receives:    Nothing
+  ** Returns:     The world map
+  ***/
+const WorldMap* CORBAImplementations::Controller::worldMap() const {
+    return(_worldMap);
 }
 
 
@@ -61,116 +82,52 @@ void CORBAImplementations::Controller::teamNumber(const char* name, Octet& teamN
 
 /*** 'teams' function
   ** Description: Gets the created teams
-  ** Receives:    [teamsStr] A reference to where the stringfied teams list will be stored
-                  [nGEARSystemTeams]   A reference to where the number of teams will be stored
-                  [hasGEARSystemTeam0] A reference to where the GEARSystemTeam #0 flag will be stored
+  ** Receives:    [teams]         Where the teams bitmap will be stored
+                  [rosterVersion] A reference to where the roster version will be stored
   ** Returns:     Nothing
   ***/
-void CORBAImplementations::Controller::teams(String_out teamsStr, Octet& nGEARSystemTeams, Boolean& hasGEARSystemTeam0) {
-    // Gets the teams list
-    QList<uint8> list(_worldMap->teams());
-    QListIterator<uint8> it(list);
-
-    // Stringfies it
-    hasGEARSystemTeam0 = false;
-
-    char* str = new char[list.size()+1];
-    str[list.size()-1] = '\0';
-    str[list.size()]   = '\0';
-
-    uint16 i;
-    uint8  number;
-    for (i = 0; it.hasNext(); i++) {
-        number = it.next();
-        if (number != 0) {
-            str[i] = number;
-        }
-        else {
-            hasGEARSystemTeam0 = true;
-            i--;
-        }
-    }
-
-    // Returns the stringfied list
-    nGEARSystemTeams = list.size();
-    teamsStr = CORBA::string_dup(str);
+void CORBAImplementations::Controller::teams(CORBATypes::IdBitmap teams, CORBA::ULongLong& rosterVersion) {
+    // Reads the version first, so the bitmap is at least as new as it
+    rosterVersion = _worldMap->rosterVersion();
+    _worldMap->teamsBitmap().toCORBA(teams);
 }
 
 
 /*** 'players' function
   ** Description: Gets the created players
-  ** Receives:    [teamNum]    The team number
-                  [playersStr] A reference to where the stringfied players list will be stored
-                  [nPlayers]   A reference to where the number of players will be stored
-                  [hasPlayer0] A reference to where the Player #0 flag will be stored
+  ** Receives:    [teamNum]       The team number
+                  [players]       Where the players bitmap will be stored
+                  [rosterVersion] A reference to where the roster version will be stored
   ** Returns:     Nothing
   ***/
-void CORBAImplementations::Controller::players(Octet teamNum, String_out playersStr, Octet& nPlayers, Boolean& hasPlayer0) {
-    // Gets the players list
-    QList<uint8> list(_worldMap->players(teamNum));
-    QListIterator<uint8> it(list);
-
-    // Stringfies it
-    hasPlayer0 = false;
-
-    char* str = new char[list.size()+1];
-    str[list.size()-1] = '\0';
-    str[list.size()]   = '\0';
-
-    uint16 i;
-    uint8  number;
-    for (i = 0; it.hasNext(); i++) {
-        number = it.next();
-        if (number != 0) {
-            str[i] = number;
-        }
-        else {
-            hasPlayer0 = true;
-            i--;
-        }
-    }
-
-    // Returns the stringfied list
-    nPlayers = list.size();
-    playersStr = CORBA::string_dup(str);
+void CORBAImplementations::Controller::players(Octet teamNum, CORBATypes::IdBitmap players, CORBA::ULongLong& rosterVersion) {
+    // Reads the version first, so the bitmap is at least as new as it
+    rosterVersion = _worldMap->rosterVersion();
+    _worldMap->playersBitmap(teamNum).toCORBA(players);
 }
 
 
 /*** 'balls' function
   ** Description: Gets the created balls
-  ** Receives:    [ballsStr] A reference to where the stringfied balls list will be stored
-                  [nBalls]   A reference to where the number of balls will be stored
-                  [hasBall0] A reference to where the Ball #0 flag will be stored
+  ** Receives:    [balls]         Where the balls bitmap will be stored
+                  [rosterVersion] A reference to where the roster version will be stored
   ** Returns:     Nothing
   ***/
-void CORBAImplementations::Controller::balls(String_out ballsStr, Octet& nBalls, Boolean& hasBall0) {
-    // Gets the balls list
-    QList<uint8> list(_worldMap->balls());
-    QListIterator<uint8> it(list);
-
-    // Stringfies it
-    hasBall0 = false;
-
-    char* str = new char[list.size()+1];
-    str[list.size()-1] = '\0';
-    str[list.size()]   = '\0';
-
-    uint16 i;
-    uint8  number;
-    for (i = 0; it.hasNext(); i++) {
-        number = it.next();
-        if (number != 0) {
-            str[i] = number;
-        }
-        else {
-            hasBall0 = true;
-            i--;
-        }
-    }
+void CORBAImplementations::Controller::balls(CORBATypes::IdBitmap balls, CORBA::ULongLong& rosterVersion) {
+    // Reads the version first, so the bitmap is at least as new as it
+    rosterVersion = _worldMap->rosterVersion();
+    _worldMap->ballsBitmap().toCORBA(balls);
+}
 
-    // Returns the stringfied list
-    nBalls = list.size();
-    ballsStr = CORBA::string_dup(str);
+/*** 'rosterChanged' function
+  ** Description: Verifies if teams, players or balls were added or removed after a roster version
+  ** Receives:    [sinceVersion]  The roster version the client has seen
+                  [rosterVersion] A reference to where the current roster version will be stored
+  ** Returns:     'true' if the roster changed, 'false' otherwise
+  ***/
+Boolean CORBAImplementations::Controller::rosterChanged(CORBA::ULongLong sinceVersion, CORBA::ULongLong& rosterVersion) {
+    rosterVersion = _worldMap->rosterVersion();
+    return(rosterVersion > sinceVersion);
 }
 
 
@@ -306,6 +263,114 @@ void CORBAImplementations::Controller::capacitorCharge(Octet teamNum, Octet play
     charge = _worldMap->capacitorCharge(teamNum, playerNum);
 }
 
+/*** 'playerState' function
+  ** Description: Gets the whole player state in a single call
+  ** Receives:    [teamNum]   The team number
+                  [playerNum] The player number
+                  [state]     The player state
+  ** Returns:     'true' if the player exists, 'false' otherwise
+  ***/
+Boolean CORBAImplementations::Controller::playerState(Octet teamNum, Octet playerNum, CORBATypes::PlayerState& state) {
+    // Returns the state, read at once
+    const PlayerState playerState = _worldMap->playerState(teamNum, playerNum);
+    playerState.toCORBA(&state);
+    return(playerState.isValid());
+}
+
+
+/*** Positions at a time functions
+  ** Description: Gets a ball or player pose at a given capture time, interpolated from the history
+  ** Receives:    [ballNum]     The ball number
+                  [teamNum]     The team number
+                  [playerNum]   The player number
+                  [time]        The capture time, in seconds
+                  [position]    A reference to where the position will be stored
+                  [orientation] A reference to where the orientation will be stored
+  ** Returns:     Nothing
+  ***/
+void CORBAImplementations::Controller::ballPositionAt(Octet ballNum, CORBA::Double time, CORBATypes::Position& position) {
+    _worldMap->ballPositionAt(ballNum, time).toCORBA(&position);
+}
+
+void CORBAImplementations::Controller::playerPositionAt(Octet teamNum, Octet playerNum, CORBA::Double time, CORBATypes::Position& position) {
+    _worldMap->playerPositionAt(teamNum, playerNum, time).toCORBA(&position);
+}
+
+void CORBAImplementations::Controller::playerOrientationAt(Octet teamNum, Octet playerNum, CORBA::Double time, CORBATypes::Angle& orientation) {
+    _worldMap->playerOrientationAt(teamNum, playerNum, time).toCORBA(&orientation);
+}
+
+/*** Trajectory functions
+  ** Description: Gets the stored samples of a ball or player in a time interval
+  ** Receives:    [ballNum]   The ball number
+                  [teamNum]   The team number
+                  [playerNum] The player number
+                  [startTime] The interval start, in seconds
+                  [endTime]   The interval end, in seconds
+                  [samples]   A reference to where the samples will be stored
+  ** Returns:     Nothing
+  ***/
+void CORBAImplementations::Controller::ballTrajectory(Octet ballNum, CORBA::Double startTime, CORBA::Double endTime, CORBATypes::TrajectorySampleSeq_out samples) {
+    CORBATypes::TrajectorySampleSeq* corbaSamples = new CORBATypes::TrajectorySampleSeq();
+    TrajectorySample::toCORBA(_worldMap->ballTrajectory(ballNum, startTime, endTime), corbaSamples);
+    samples = corbaSamples;
+}
+
+void CORBAImplementations::Controller::playerTrajectory(Octet teamNum, Octet playerNum, CORBA::Double startTime, CORBA::Double endTime, CORBATypes::TrajectorySampleSeq_out samples) {
+    CORBATypes::TrajectorySampleSeq* corbaSamples = new CORBATypes::TrajectorySampleSeq();
+    TrajectorySample::toCORBA(_worldMap->playerTrajectory(teamNum, playerNum, startTime, endTime), corbaSamples);
+    samples = corbaSamples;
+}
+
+/*** Prediction functions
+  ** Description: Predicts a ball position or a player pose at a given capture time
+  ** Receives:    [ballNum]   The ball number
+                  [teamNum]   The team number
+                  [playerNum] The player number
+                  [time]      The capture time, in seconds
+                  [position]  A reference to where the position will be stored
+                  [pose]      A reference to where the pose will be stored
+  ** Returns:     Nothing
+  ***/
+void CORBAImplementations::Controller::predictedBallPosition(Octet ballNum, CORBA::Double time, CORBATypes::Position& position) {
+    _worldMap->predictedBallPosition(ballNum, time).toCORBA(&position);
+}
+
+void CORBAImplementations::Controller::predictedPlayerPose(Octet teamNum, Octet playerNum, CORBA::Double time, CORBATypes::TrajectorySample& pose) {
+    _worldMap->predictedPlayerPose(teamNum, playerNum, time).toCORBA(&pose);
+}
+
+
+/*** Spatial query functions
+  ** Description: Finds the players closest to a point, within a radius of a point, or within a radius of a
+                  segment
+  ** Receives:    [point]   The queried point
+                  [k]       The maximum number of players
+                  [radius]  The search radius
+                  [a]       The segment start
+                  [b]       The segment end
+                  [teams]   The teams searched (an empty bitmap searches all teams)
+                  [players] A reference to where the players will be stored
+  ** Returns:     Nothing
+  ***/
+void CORBAImplementations::Controller::nearestPlayers(const CORBATypes::Position& point, CORBA::UShort k, const CORBATypes::IdBitmap teams, CORBATypes::PlayerDistanceSeq_out players) {
+    CORBATypes::PlayerDistanceSeq* corbaPlayers = new CORBATypes::PlayerDistanceSeq();
+    PlayerDistance::toCORBA(_worldMap->nearestPlayers(Position(point), k, IdBitmap(teams)), corbaPlayers);
+    players = corbaPlayers;
+}
+
+void CORBAImplementations::Controller::playersWithinRadius(const CORBATypes::Position& point, CORBA::Float radius, const CORBATypes::IdBitmap teams, CORBATypes::PlayerDistanceSeq_out players) {
+    CORBATypes::PlayerDistanceSeq* corbaPlayers = new CORBATypes::PlayerDistanceSeq();
+    PlayerDistance::toCORBA(_worldMap->playersWithinRadius(Position(point), radius, IdBitmap(teams)), corbaPlayers);
+    players = corbaPlayers;
+}
+
+void CORBAImplementations::Controller::segmentClearance(const CORBATypes::Position& a, const CORBATypes::Position& b, CORBA::Float radius, const CORBATypes::IdBitmap teams, CORBATypes::PlayerDistanceSeq_out players) {
+    CORBATypes::PlayerDistanceSeq* corbaPlayers = new CORBATypes::PlayerDistanceSeq();
+    PlayerDistance::toCORBA(_worldMap->segmentClearance(Position(a), Position(b), radius, IdBitmap(teams)), corbaPlayers);
+    players = corbaPlayers;
+}
+
 /*** 'setSpeed'
   ** Description: Sets a player speed
   ** Receives:    [teamNum]   The team number
@@ -320,6 +385,16 @@ void CORBAImplementations::Controller::setSpeed(Octet teamNum, Octet playerNum,
     _commandBus->setSpeed(teamNum, playerNum, x, y, theta);
 }
 
+/*** 'setSpeeds'
+  ** Description: Sets the speed of several players at once
+  ** Receives:    [commands] The speed commands
+  ** Returns:     Nothing
+  ***/
+void CORBAImplementations::Controller::setSpeeds(const CORBATypes::RobotCommandSeq& commands) {
+    // Sends the commands via the command bus
+    _commandBus->setSpeeds(RobotCommand::fromCORBA(commands));
+}
+
 /*** 'kick'
   ** Description: Activates the player kicking device
   ** Receives:    [teamNum]   The team number
@@ -386,6 +461,40 @@ void CORBAImplementations::Controller::holdBall(Octet teamNum, Octet playerNum,
 }
 
 
+/*** Asynchronous commands
+  ** Description: Oneway versions of the commands above; the caller doesn't wait for a reply
+  ** Receives:    The same arguments of the synchronous commands
+  ** Returns:     Nothing
+  ***/
+void CORBAImplementations::Controller::setSpeedAsync(Octet teamNum, Octet playerNum, Float x, Float y, Float theta) {
+    setSpeed(teamNum, playerNum, x, y, theta);
+}
+
+void CORBAImplementations::Controller::setSpeedsAsync(const CORBATypes::RobotCommandSeq& commands) {
+    setSpeeds(commands);
+}
+
+void CORBAImplementations::Controller::kickAsync(Octet teamNum, Octet playerNum, Float power) {
+    kick(teamNum, playerNum, power);
+}
+
+void CORBAImplementations::Controller::chipKickAsync(Octet teamNum, Octet playerNum, Float power) {
+    chipKick(teamNum, playerNum, power);
+}
+
+void CORBAImplementations::Controller::kickOnTouchAsync(Octet teamNum, Octet playerNum, Boolean enable, Float power) {
+    kickOnTouch(teamNum, playerNum, enable, power);
+}
+
+void CORBAImplementations::Controller::chipKickOnTouchAsync(Octet teamNum, Octet playerNum, Boolean enable, Float power) {
+    chipKickOnTouch(teamNum, playerNum, enable, power);
+}
+
+void CORBAImplementations::Controller::holdBallAsync(Octet teamNum, Octet playerNum, Boolean enable) {
+    holdBall(teamNum, playerNum, enable);
+}
+
+
 /*** Field handling functions
   ** Description: Handles field info
   ***/
@@ -453,3 +562,57 @@ void CORBAImplementations::Controller::fieldCenterRadius(CORBA::Float &centerRad
     // Returns field center radius
     centerRadius = _worldMap->fieldCenterRadius();
 }
+
+/*** 'fieldGeometry' function
+  ** Description: Gets every field element and the geometry version in a single call
+  ** Receives:    [geometry] A reference to where the field geometry will be stored
+  ** Returns:     Nothing
+  ***/
+void CORBAImplementations::Controller::fieldGeometry(CORBATypes::FieldGeometry& geometry) {
+    // Reads the version first: a change made meanwhile leaves an older version, so clients fetch it again
+    geometry.version = _worldMap->geometryVersion();
+    _worldMap->fieldGeometry().toCORBA(&geometry);
+}
+
+
+/*** 'worldState' function
+  ** Description: Gets every team, player and ball of the last published snapshot in a single call
+  ** Receives:    [state] A reference to where the world state will be stored
+  ** Returns:     Nothing
+  ***/
+void CORBAImplementations::Controller::worldState(CORBATypes::WorldState_out state) {
+    // Copies a consistent snapshot
+    CORBATypes::WorldState* corbaState = new CORBATypes::WorldState();
+    _worldMap->snapshot()->toCORBA(corbaState);
+
+    // Returns the state
+    state = corbaState;
+}
+
+/*** 'versions' function
+  ** Description: Gets the world and field versions, so clients can tell if their copies are outdated
+  ** Receives:    [worldVersion]    A reference to where the world map version will be stored
+                  [geometryVersion] A reference to where the field version will be stored
+  ** Returns:     Nothing
+  ***/
+void CORBAImplementations::Controller::versions(CORBA::ULongLong& worldVersion, CORBA::ULongLong& geometryVersion) {
+    // Reads the geometry version first, as the field setters bump it before the world version
+    geometryVersion = _worldMap->geometryVersion();
+    worldVersion    = _worldMap->version();
+}
+
+
+/*** Subscription functions
+  ** Description: Adds or removes a remote listener that receives every committed frame
+  ** Receives:    [name]     The subscriber name
+                  [listener] The remote listener
+  ** Returns:     Nothing
+  ***/
+void CORBAImplementations::Controller::subscribe(const char* name, CORBAInterfaces::WorldListener_ptr listener) {
+    // Keeps its own reference to the listener
+    _publisher->subscribe(QString(name), CORBAInterfaces::WorldListener::_duplicate(listener));
+}
+
+void CORBAImplementations::Controller::unsubscribe(const char* name) {
+    _publisher->unsubscribe(QString(name));
+}
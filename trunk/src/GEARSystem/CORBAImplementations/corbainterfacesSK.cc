@@ -1,5000 +0,0 @@
-// This file is generated by omniidl (C++ backend)- omniORB_4_2. Do not edit.
-
-#include <GEARSystem/CORBAImplementations/corbainterfaces.hh>
-#include <omniORB4/IOP_S.h>
-#include <omniORB4/IOP_C.h>
-#include <omniORB4/callDescriptor.h>
-#include <omniORB4/callHandle.h>
-#include <omniORB4/objTracker.h>
-
-
-OMNI_USING_NAMESPACE(omni)
-
-static const char* _0RL_library_version = omniORB_4_2;
-
-
-
-void
-GEARSystem::CORBATypes::Angle::operator>>= (cdrStream &_n) const
-{
-  _n.marshalBoolean(isValid);
-  _n.marshalBoolean(isUnknown);
-  value >>= _n;
-
-}
-
-void
-GEARSystem::CORBATypes::Angle::operator<<= (cdrStream &_n)
-{
-  isValid = _n.unmarshalBoolean();
-  isUnknown = _n.unmarshalBoolean();
-  (::CORBA::Float&)value <<= _n;
-
-}
-
-void
-GEARSystem::CORBATypes::Position::operator>>= (cdrStream &_n) const
-{
-  _n.marshalBoolean(isValid);
-  _n.marshalBoolean(isUnknown);
-  x >>= _n;
-  y >>= _n;
-  z >>= _n;
-
-}
-
-void
-GEARSystem::CORBATypes::Position::operator<<= (cdrStream &_n)
-{
-  isValid = _n.unmarshalBoolean();
-  isUnknown = _n.unmarshalBoolean();
-  (::CORBA::Float&)x <<= _n;
-  (::CORBA::Float&)y <<= _n;
-  (::CORBA::Float&)z <<= _n;
-
-}
-
-void
-GEARSystem::CORBATypes::Velocity::operator>>= (cdrStream &_n) const
-{
-  _n.marshalBoolean(isValid);
-  _n.marshalBoolean(isUnknown);
-  x >>= _n;
-  y >>= _n;
-
-}
-
-void
-GEARSystem::CORBATypes::Velocity::operator<<= (cdrStream &_n)
-{
-  isValid = _n.unmarshalBoolean();
-  isUnknown = _n.unmarshalBoolean();
-  (::CORBA::Float&)x <<= _n;
-  (::CORBA::Float&)y <<= _n;
-
-}
-
-void
-GEARSystem::CORBATypes::AngularSpeed::operator>>= (cdrStream &_n) const
-{
-  _n.marshalBoolean(isValid);
-  _n.marshalBoolean(isUnknown);
-  value >>= _n;
-
-}
-
-void
-GEARSystem::CORBATypes::AngularSpeed::operator<<= (cdrStream &_n)
-{
-  isValid = _n.unmarshalBoolean();
-  isUnknown = _n.unmarshalBoolean();
-  (::CORBA::Float&)value <<= _n;
-
-}
-
-GEARSystem::CORBAInterfaces::Actuator_ptr GEARSystem::CORBAInterfaces::Actuator_Helper::_nil() {
-  return ::GEARSystem::CORBAInterfaces::Actuator::_nil();
-}
-
-::CORBA::Boolean GEARSystem::CORBAInterfaces::Actuator_Helper::is_nil(::GEARSystem::CORBAInterfaces::Actuator_ptr p) {
-  return ::CORBA::is_nil(p);
-
-}
-
-void GEARSystem::CORBAInterfaces::Actuator_Helper::release(::GEARSystem::CORBAInterfaces::Actuator_ptr p) {
-  ::CORBA::release(p);
-}
-
-void GEARSystem::CORBAInterfaces::Actuator_Helper::marshalObjRef(::GEARSystem::CORBAInterfaces::Actuator_ptr obj, cdrStream& s) {
-  ::GEARSystem::CORBAInterfaces::Actuator::_marshalObjRef(obj, s);
-}
-
-GEARSystem::CORBAInterfaces::Actuator_ptr GEARSystem::CORBAInterfaces::Actuator_Helper::unmarshalObjRef(cdrStream& s) {
-  return ::GEARSystem::CORBAInterfaces::Actuator::_unmarshalObjRef(s);
-}
-
-void GEARSystem::CORBAInterfaces::Actuator_Helper::duplicate(::GEARSystem::CORBAInterfaces::Actuator_ptr obj) {
-  if (obj && !obj->_NP_is_nil())  omni::duplicateObjRef(obj);
-}
-
-GEARSystem::CORBAInterfaces::Actuator_ptr
-GEARSystem::CORBAInterfaces::Actuator::_duplicate(::GEARSystem::CORBAInterfaces::Actuator_ptr obj)
-{
-  if (obj && !obj->_NP_is_nil())  omni::duplicateObjRef(obj);
-  return obj;
-}
-
-GEARSystem::CORBAInterfaces::Actuator_ptr
-GEARSystem::CORBAInterfaces::Actuator::_narrow(::CORBA::Object_ptr obj)
-{
-  if (!obj || obj->_NP_is_nil() || obj->_NP_is_pseudo()) return _nil();
-  _ptr_type e = (_ptr_type) obj->_PR_getobj()->_realNarrow(_PD_repoId);
-  return e ? e : _nil();
-}
-
-
-GEARSystem::CORBAInterfaces::Actuator_ptr
-GEARSystem::CORBAInterfaces::Actuator::_unchecked_narrow(::CORBA::Object_ptr obj)
-{
-  if (!obj || obj->_NP_is_nil() || obj->_NP_is_pseudo()) return _nil();
-  _ptr_type e = (_ptr_type) obj->_PR_getobj()->_uncheckedNarrow(_PD_repoId);
-  return e ? e : _nil();
-}
-
-GEARSystem::CORBAInterfaces::Actuator_ptr
-GEARSystem::CORBAInterfaces::Actuator::_nil()
-{
-#ifdef OMNI_UNLOADABLE_STUBS
-  static _objref_Actuator _the_nil_obj;
-  return &_the_nil_obj;
-#else
-  static _objref_Actuator* _the_nil_ptr = 0;
-  if (!_the_nil_ptr) {
-    omni::nilRefLock().lock();
-    if (!_the_nil_ptr) {
-      _the_nil_ptr = new _objref_Actuator;
-      registerNilCorbaObject(_the_nil_ptr);
-    }
-    omni::nilRefLock().unlock();
-  }
-  return _the_nil_ptr;
-#endif
-}
-
-const char* GEARSystem::CORBAInterfaces::Actuator::_PD_repoId = "IDL:GEARSystem/CORBAInterfaces/Actuator:1.0";
-
-
-GEARSystem::CORBAInterfaces::_objref_Actuator::~_objref_Actuator() {
-  
-}
-
-
-GEARSystem::CORBAInterfaces::_objref_Actuator::_objref_Actuator(omniIOR* ior, omniIdentity* id) :
-   omniObjRef(::GEARSystem::CORBAInterfaces::Actuator::_PD_repoId, ior, id, 1)
-   
-   
-{
-  _PR_setobj(this);
-}
-
-void*
-GEARSystem::CORBAInterfaces::_objref_Actuator::_ptrToObjRef(const char* id)
-{
-  if (id == ::GEARSystem::CORBAInterfaces::Actuator::_PD_repoId)
-    return (::GEARSystem::CORBAInterfaces::Actuator_ptr) this;
-  
-  if (id == ::CORBA::Object::_PD_repoId)
-    return (::CORBA::Object_ptr) this;
-
-  if (omni::strMatch(id, ::GEARSystem::CORBAInterfaces::Actuator::_PD_repoId))
-    return (::GEARSystem::CORBAInterfaces::Actuator_ptr) this;
-  
-  if (omni::strMatch(id, ::CORBA::Object::_PD_repoId))
-    return (::CORBA::Object_ptr) this;
-
-  return 0;
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Actuator::setSpeed
-
-// Proxy call descriptor class. Mangled signature:
-//  void_i_coctet_i_coctet_i_cfloat_i_cfloat_i_cfloat
-class _0RL_cd_f9ba7d5cd2d6498c_00000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_00000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  void marshalArguments(cdrStream&);
-  void unmarshalArguments(cdrStream&);
-
-    
-  
-  static const char* const _user_exns[];
-
-  ::CORBA::Octet arg_0;
-  ::CORBA::Octet arg_1;
-  ::CORBA::Float arg_2;
-  ::CORBA::Float arg_3;
-  ::CORBA::Float arg_4;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_00000000::marshalArguments(cdrStream& _n)
-{
-  _n.marshalOctet(arg_0);
-  _n.marshalOctet(arg_1);
-  arg_2 >>= _n;
-  arg_3 >>= _n;
-  arg_4 >>= _n;
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_00000000::unmarshalArguments(cdrStream& _n)
-{
-  arg_0 = _n.unmarshalOctet();
-  arg_1 = _n.unmarshalOctet();
-  (::CORBA::Float&)arg_2 <<= _n;
-  (::CORBA::Float&)arg_3 <<= _n;
-  (::CORBA::Float&)arg_4 <<= _n;
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_00000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_10000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_00000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_00000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Actuator* impl = (GEARSystem::CORBAInterfaces::_impl_Actuator*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Actuator::_PD_repoId);
-  impl->setSpeed(tcd->arg_0, tcd->arg_1, tcd->arg_2, tcd->arg_3, tcd->arg_4);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Actuator::setSpeed(::CORBA::Octet teamNum, ::CORBA::Octet playerNum, ::CORBA::Float x, ::CORBA::Float y, ::CORBA::Float theta)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_00000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_10000000, "setSpeed", 9);
-  _call_desc.arg_0 = teamNum;
-  _call_desc.arg_1 = playerNum;
-  _call_desc.arg_2 = x;
-  _call_desc.arg_3 = y;
-  _call_desc.arg_4 = theta;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Actuator::kick
-
-// Proxy call descriptor class. Mangled signature:
-//  void_i_coctet_i_coctet_i_cfloat
-class _0RL_cd_f9ba7d5cd2d6498c_20000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_20000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  void marshalArguments(cdrStream&);
-  void unmarshalArguments(cdrStream&);
-
-    
-  
-  static const char* const _user_exns[];
-
-  ::CORBA::Octet arg_0;
-  ::CORBA::Octet arg_1;
-  ::CORBA::Float arg_2;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_20000000::marshalArguments(cdrStream& _n)
-{
-  _n.marshalOctet(arg_0);
-  _n.marshalOctet(arg_1);
-  arg_2 >>= _n;
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_20000000::unmarshalArguments(cdrStream& _n)
-{
-  arg_0 = _n.unmarshalOctet();
-  arg_1 = _n.unmarshalOctet();
-  (::CORBA::Float&)arg_2 <<= _n;
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_20000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_30000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_20000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_20000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Actuator* impl = (GEARSystem::CORBAInterfaces::_impl_Actuator*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Actuator::_PD_repoId);
-  impl->kick(tcd->arg_0, tcd->arg_1, tcd->arg_2);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Actuator::kick(::CORBA::Octet teamNum, ::CORBA::Octet playerNum, ::CORBA::Float power)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_20000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_30000000, "kick", 5);
-  _call_desc.arg_0 = teamNum;
-  _call_desc.arg_1 = playerNum;
-  _call_desc.arg_2 = power;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Actuator::chipKick
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_40000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_20000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_20000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Actuator* impl = (GEARSystem::CORBAInterfaces::_impl_Actuator*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Actuator::_PD_repoId);
-  impl->chipKick(tcd->arg_0, tcd->arg_1, tcd->arg_2);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Actuator::chipKick(::CORBA::Octet teamNum, ::CORBA::Octet playerNum, ::CORBA::Float power)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_20000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_40000000, "chipKick", 9);
-  _call_desc.arg_0 = teamNum;
-  _call_desc.arg_1 = playerNum;
-  _call_desc.arg_2 = power;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Actuator::kickOnTouch
-
-// Proxy call descriptor class. Mangled signature:
-//  void_i_coctet_i_coctet_i_cboolean_i_cfloat
-class _0RL_cd_f9ba7d5cd2d6498c_50000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_50000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  void marshalArguments(cdrStream&);
-  void unmarshalArguments(cdrStream&);
-
-    
-  
-  static const char* const _user_exns[];
-
-  ::CORBA::Octet arg_0;
-  ::CORBA::Octet arg_1;
-  ::CORBA::Boolean arg_2;
-  ::CORBA::Float arg_3;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_50000000::marshalArguments(cdrStream& _n)
-{
-  _n.marshalOctet(arg_0);
-  _n.marshalOctet(arg_1);
-  _n.marshalBoolean(arg_2);
-  arg_3 >>= _n;
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_50000000::unmarshalArguments(cdrStream& _n)
-{
-  arg_0 = _n.unmarshalOctet();
-  arg_1 = _n.unmarshalOctet();
-  arg_2 = _n.unmarshalBoolean();
-  (::CORBA::Float&)arg_3 <<= _n;
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_50000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_60000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_50000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_50000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Actuator* impl = (GEARSystem::CORBAInterfaces::_impl_Actuator*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Actuator::_PD_repoId);
-  impl->kickOnTouch(tcd->arg_0, tcd->arg_1, tcd->arg_2, tcd->arg_3);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Actuator::kickOnTouch(::CORBA::Octet teamNum, ::CORBA::Octet playerNum, ::CORBA::Boolean enable, ::CORBA::Float power)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_50000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_60000000, "kickOnTouch", 12);
-  _call_desc.arg_0 = teamNum;
-  _call_desc.arg_1 = playerNum;
-  _call_desc.arg_2 = enable;
-  _call_desc.arg_3 = power;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Actuator::chipKickOnTouch
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_70000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_50000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_50000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Actuator* impl = (GEARSystem::CORBAInterfaces::_impl_Actuator*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Actuator::_PD_repoId);
-  impl->chipKickOnTouch(tcd->arg_0, tcd->arg_1, tcd->arg_2, tcd->arg_3);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Actuator::chipKickOnTouch(::CORBA::Octet teamNum, ::CORBA::Octet playerNum, ::CORBA::Boolean enable, ::CORBA::Float power)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_50000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_70000000, "chipKickOnTouch", 16);
-  _call_desc.arg_0 = teamNum;
-  _call_desc.arg_1 = playerNum;
-  _call_desc.arg_2 = enable;
-  _call_desc.arg_3 = power;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Actuator::holdBall
-
-// Proxy call descriptor class. Mangled signature:
-//  void_i_coctet_i_coctet_i_cboolean
-class _0RL_cd_f9ba7d5cd2d6498c_80000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_80000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  void marshalArguments(cdrStream&);
-  void unmarshalArguments(cdrStream&);
-
-    
-  
-  static const char* const _user_exns[];
-
-  ::CORBA::Octet arg_0;
-  ::CORBA::Octet arg_1;
-  ::CORBA::Boolean arg_2;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_80000000::marshalArguments(cdrStream& _n)
-{
-  _n.marshalOctet(arg_0);
-  _n.marshalOctet(arg_1);
-  _n.marshalBoolean(arg_2);
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_80000000::unmarshalArguments(cdrStream& _n)
-{
-  arg_0 = _n.unmarshalOctet();
-  arg_1 = _n.unmarshalOctet();
-  arg_2 = _n.unmarshalBoolean();
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_80000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_90000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_80000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_80000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Actuator* impl = (GEARSystem::CORBAInterfaces::_impl_Actuator*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Actuator::_PD_repoId);
-  impl->holdBall(tcd->arg_0, tcd->arg_1, tcd->arg_2);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Actuator::holdBall(::CORBA::Octet teamNum, ::CORBA::Octet playerNum, ::CORBA::Boolean enable)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_80000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_90000000, "holdBall", 9);
-  _call_desc.arg_0 = teamNum;
-  _call_desc.arg_1 = playerNum;
-  _call_desc.arg_2 = enable;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-GEARSystem::CORBAInterfaces::_pof_Actuator::~_pof_Actuator() {}
-
-
-omniObjRef*
-GEARSystem::CORBAInterfaces::_pof_Actuator::newObjRef(omniIOR* ior, omniIdentity* id)
-{
-  return new ::GEARSystem::CORBAInterfaces::_objref_Actuator(ior, id);
-}
-
-
-::CORBA::Boolean
-GEARSystem::CORBAInterfaces::_pof_Actuator::is_a(const char* id) const
-{
-  if (omni::ptrStrMatch(id, ::GEARSystem::CORBAInterfaces::Actuator::_PD_repoId))
-    return 1;
-  
-  return 0;
-}
-
-const GEARSystem::CORBAInterfaces::_pof_Actuator _the_pof_GEARSystem_mCORBAInterfaces_mActuator;
-
-GEARSystem::CORBAInterfaces::_impl_Actuator::~_impl_Actuator() {}
-
-
-::CORBA::Boolean
-GEARSystem::CORBAInterfaces::_impl_Actuator::_dispatch(omniCallHandle& _handle)
-{
-  const char* op = _handle.operation_name();
-
-  if (omni::strMatch(op, "setSpeed")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_00000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_10000000, "setSpeed", 9, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "kick")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_20000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_30000000, "kick", 5, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "chipKick")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_20000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_40000000, "chipKick", 9, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "kickOnTouch")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_50000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_60000000, "kickOnTouch", 12, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "chipKickOnTouch")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_50000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_70000000, "chipKickOnTouch", 16, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "holdBall")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_80000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_90000000, "holdBall", 9, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-
-  return 0;
-}
-
-void*
-GEARSystem::CORBAInterfaces::_impl_Actuator::_ptrToInterface(const char* id)
-{
-  if (id == ::GEARSystem::CORBAInterfaces::Actuator::_PD_repoId)
-    return (::GEARSystem::CORBAInterfaces::_impl_Actuator*) this;
-  
-  if (id == ::CORBA::Object::_PD_repoId)
-    return (void*) 1;
-
-  if (omni::strMatch(id, ::GEARSystem::CORBAInterfaces::Actuator::_PD_repoId))
-    return (::GEARSystem::CORBAInterfaces::_impl_Actuator*) this;
-  
-  if (omni::strMatch(id, ::CORBA::Object::_PD_repoId))
-    return (void*) 1;
-  return 0;
-}
-
-const char*
-GEARSystem::CORBAInterfaces::_impl_Actuator::_mostDerivedRepoId()
-{
-  return ::GEARSystem::CORBAInterfaces::Actuator::_PD_repoId;
-}
-
-GEARSystem::CORBAInterfaces::Controller_ptr GEARSystem::CORBAInterfaces::Controller_Helper::_nil() {
-  return ::GEARSystem::CORBAInterfaces::Controller::_nil();
-}
-
-::CORBA::Boolean GEARSystem::CORBAInterfaces::Controller_Helper::is_nil(::GEARSystem::CORBAInterfaces::Controller_ptr p) {
-  return ::CORBA::is_nil(p);
-
-}
-
-void GEARSystem::CORBAInterfaces::Controller_Helper::release(::GEARSystem::CORBAInterfaces::Controller_ptr p) {
-  ::CORBA::release(p);
-}
-
-void GEARSystem::CORBAInterfaces::Controller_Helper::marshalObjRef(::GEARSystem::CORBAInterfaces::Controller_ptr obj, cdrStream& s) {
-  ::GEARSystem::CORBAInterfaces::Controller::_marshalObjRef(obj, s);
-}
-
-GEARSystem::CORBAInterfaces::Controller_ptr GEARSystem::CORBAInterfaces::Controller_Helper::unmarshalObjRef(cdrStream& s) {
-  return ::GEARSystem::CORBAInterfaces::Controller::_unmarshalObjRef(s);
-}
-
-void GEARSystem::CORBAInterfaces::Controller_Helper::duplicate(::GEARSystem::CORBAInterfaces::Controller_ptr obj) {
-  if (obj && !obj->_NP_is_nil())  omni::duplicateObjRef(obj);
-}
-
-GEARSystem::CORBAInterfaces::Controller_ptr
-GEARSystem::CORBAInterfaces::Controller::_duplicate(::GEARSystem::CORBAInterfaces::Controller_ptr obj)
-{
-  if (obj && !obj->_NP_is_nil())  omni::duplicateObjRef(obj);
-  return obj;
-}
-
-GEARSystem::CORBAInterfaces::Controller_ptr
-GEARSystem::CORBAInterfaces::Controller::_narrow(::CORBA::Object_ptr obj)
-{
-  if (!obj || obj->_NP_is_nil() || obj->_NP_is_pseudo()) return _nil();
-  _ptr_type e = (_ptr_type) obj->_PR_getobj()->_realNarrow(_PD_repoId);
-  return e ? e : _nil();
-}
-
-
-GEARSystem::CORBAInterfaces::Controller_ptr
-GEARSystem::CORBAInterfaces::Controller::_unchecked_narrow(::CORBA::Object_ptr obj)
-{
-  if (!obj || obj->_NP_is_nil() || obj->_NP_is_pseudo()) return _nil();
-  _ptr_type e = (_ptr_type) obj->_PR_getobj()->_uncheckedNarrow(_PD_repoId);
-  return e ? e : _nil();
-}
-
-GEARSystem::CORBAInterfaces::Controller_ptr
-GEARSystem::CORBAInterfaces::Controller::_nil()
-{
-#ifdef OMNI_UNLOADABLE_STUBS
-  static _objref_Controller _the_nil_obj;
-  return &_the_nil_obj;
-#else
-  static _objref_Controller* _the_nil_ptr = 0;
-  if (!_the_nil_ptr) {
-    omni::nilRefLock().lock();
-    if (!_the_nil_ptr) {
-      _the_nil_ptr = new _objref_Controller;
-      registerNilCorbaObject(_the_nil_ptr);
-    }
-    omni::nilRefLock().unlock();
-  }
-  return _the_nil_ptr;
-#endif
-}
-
-const char* GEARSystem::CORBAInterfaces::Controller::_PD_repoId = "IDL:GEARSystem/CORBAInterfaces/Controller:1.0";
-
-
-GEARSystem::CORBAInterfaces::_objref_Controller::~_objref_Controller() {
-  
-}
-
-
-GEARSystem::CORBAInterfaces::_objref_Controller::_objref_Controller(omniIOR* ior, omniIdentity* id) :
-   omniObjRef(::GEARSystem::CORBAInterfaces::Controller::_PD_repoId, ior, id, 1)
-   
-   
-{
-  _PR_setobj(this);
-}
-
-void*
-GEARSystem::CORBAInterfaces::_objref_Controller::_ptrToObjRef(const char* id)
-{
-  if (id == ::GEARSystem::CORBAInterfaces::Controller::_PD_repoId)
-    return (::GEARSystem::CORBAInterfaces::Controller_ptr) this;
-  
-  if (id == ::CORBA::Object::_PD_repoId)
-    return (::CORBA::Object_ptr) this;
-
-  if (omni::strMatch(id, ::GEARSystem::CORBAInterfaces::Controller::_PD_repoId))
-    return (::GEARSystem::CORBAInterfaces::Controller_ptr) this;
-  
-  if (omni::strMatch(id, ::CORBA::Object::_PD_repoId))
-    return (::CORBA::Object_ptr) this;
-
-  return 0;
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Controller::teamName
-
-// Proxy call descriptor class. Mangled signature:
-//  void_i_coctet_o_cstring
-class _0RL_cd_f9ba7d5cd2d6498c_a0000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_a0000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  void marshalArguments(cdrStream&);
-  void unmarshalArguments(cdrStream&);
-
-  void unmarshalReturnedValues(cdrStream&);
-  void marshalReturnedValues(cdrStream&);
-  
-  
-  static const char* const _user_exns[];
-
-  ::CORBA::Octet arg_0;
-  ::CORBA::String_var arg_1;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_a0000000::marshalArguments(cdrStream& _n)
-{
-  _n.marshalOctet(arg_0);
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_a0000000::unmarshalArguments(cdrStream& _n)
-{
-  arg_0 = _n.unmarshalOctet();
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_a0000000::marshalReturnedValues(cdrStream& _n)
-{
-  _n.marshalString(arg_1,0);
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_a0000000::unmarshalReturnedValues(cdrStream& _n)
-{
-  arg_1 = _n.unmarshalString(0);
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_a0000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_b0000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_a0000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_a0000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Controller* impl = (GEARSystem::CORBAInterfaces::_impl_Controller*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Controller::_PD_repoId);
-  impl->teamName(tcd->arg_0, tcd->arg_1.out());
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Controller::teamName(::CORBA::Octet teamNum, ::CORBA::String_out name)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_a0000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_b0000000, "teamName", 9);
-  _call_desc.arg_0 = teamNum;
-
-  _invoke(_call_desc);
-  name = _call_desc.arg_1._retn();
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Controller::teamNumber
-
-// Proxy call descriptor class. Mangled signature:
-//  void_i_cstring_o_coctet
-class _0RL_cd_f9ba7d5cd2d6498c_c0000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_c0000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  void marshalArguments(cdrStream&);
-  void unmarshalArguments(cdrStream&);
-
-  void unmarshalReturnedValues(cdrStream&);
-  void marshalReturnedValues(cdrStream&);
-  
-  
-  static const char* const _user_exns[];
-
-  ::CORBA::String_var arg_0_;
-  const char* arg_0;
-  ::CORBA::Octet arg_1;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_c0000000::marshalArguments(cdrStream& _n)
-{
-  _n.marshalString(arg_0,0);
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_c0000000::unmarshalArguments(cdrStream& _n)
-{
-  arg_0_ = _n.unmarshalString(0);
-  arg_0 = arg_0_.in();
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_c0000000::marshalReturnedValues(cdrStream& _n)
-{
-  _n.marshalOctet(arg_1);
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_c0000000::unmarshalReturnedValues(cdrStream& _n)
-{
-  arg_1 = _n.unmarshalOctet();
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_c0000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_d0000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_c0000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_c0000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Controller* impl = (GEARSystem::CORBAInterfaces::_impl_Controller*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Controller::_PD_repoId);
-  impl->teamNumber(tcd->arg_0, tcd->arg_1);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Controller::teamNumber(const char* name, ::CORBA::Octet& teamNum)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_c0000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_d0000000, "teamNumber", 11);
-  _call_desc.arg_0 = name;
-
-  _invoke(_call_desc);
-  teamNum = _call_desc.arg_1;
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Controller::teams
-
-// Proxy call descriptor class. Mangled signature:
-//  void_o_cstring_o_coctet_o_cboolean
-class _0RL_cd_f9ba7d5cd2d6498c_e0000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_e0000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  
-  void unmarshalReturnedValues(cdrStream&);
-  void marshalReturnedValues(cdrStream&);
-  
-  
-  static const char* const _user_exns[];
-
-  ::CORBA::String_var arg_0;
-  ::CORBA::Octet arg_1;
-  ::CORBA::Boolean arg_2;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_e0000000::marshalReturnedValues(cdrStream& _n)
-{
-  _n.marshalString(arg_0,0);
-  _n.marshalOctet(arg_1);
-  _n.marshalBoolean(arg_2);
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_e0000000::unmarshalReturnedValues(cdrStream& _n)
-{
-  arg_0 = _n.unmarshalString(0);
-  arg_1 = _n.unmarshalOctet();
-  arg_2 = _n.unmarshalBoolean();
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_e0000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_f0000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_e0000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_e0000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Controller* impl = (GEARSystem::CORBAInterfaces::_impl_Controller*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Controller::_PD_repoId);
-  impl->teams(tcd->arg_0.out(), tcd->arg_1, tcd->arg_2);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Controller::teams(::CORBA::String_out teamsStr, ::CORBA::Octet& nGEARSystemTeams, ::CORBA::Boolean& hasGEARSystemTeam0)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_e0000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_f0000000, "teams", 6);
-
-
-  _invoke(_call_desc);
-  teamsStr = _call_desc.arg_0._retn();
-  nGEARSystemTeams = _call_desc.arg_1;
-  hasGEARSystemTeam0 = _call_desc.arg_2;
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Controller::players
-
-// Proxy call descriptor class. Mangled signature:
-//  void_i_coctet_o_cstring_o_coctet_o_cboolean
-class _0RL_cd_f9ba7d5cd2d6498c_01000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_01000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  void marshalArguments(cdrStream&);
-  void unmarshalArguments(cdrStream&);
-
-  void unmarshalReturnedValues(cdrStream&);
-  void marshalReturnedValues(cdrStream&);
-  
-  
-  static const char* const _user_exns[];
-
-  ::CORBA::Octet arg_0;
-  ::CORBA::String_var arg_1;
-  ::CORBA::Octet arg_2;
-  ::CORBA::Boolean arg_3;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_01000000::marshalArguments(cdrStream& _n)
-{
-  _n.marshalOctet(arg_0);
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_01000000::unmarshalArguments(cdrStream& _n)
-{
-  arg_0 = _n.unmarshalOctet();
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_01000000::marshalReturnedValues(cdrStream& _n)
-{
-  _n.marshalString(arg_1,0);
-  _n.marshalOctet(arg_2);
-  _n.marshalBoolean(arg_3);
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_01000000::unmarshalReturnedValues(cdrStream& _n)
-{
-  arg_1 = _n.unmarshalString(0);
-  arg_2 = _n.unmarshalOctet();
-  arg_3 = _n.unmarshalBoolean();
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_01000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_11000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_01000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_01000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Controller* impl = (GEARSystem::CORBAInterfaces::_impl_Controller*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Controller::_PD_repoId);
-  impl->players(tcd->arg_0, tcd->arg_1.out(), tcd->arg_2, tcd->arg_3);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Controller::players(::CORBA::Octet teamNum, ::CORBA::String_out playersStr, ::CORBA::Octet& nPlayers, ::CORBA::Boolean& hasPlayer0)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_01000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_11000000, "players", 8);
-  _call_desc.arg_0 = teamNum;
-
-  _invoke(_call_desc);
-  playersStr = _call_desc.arg_1._retn();
-  nPlayers = _call_desc.arg_2;
-  hasPlayer0 = _call_desc.arg_3;
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Controller::balls
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_21000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_e0000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_e0000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Controller* impl = (GEARSystem::CORBAInterfaces::_impl_Controller*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Controller::_PD_repoId);
-  impl->balls(tcd->arg_0.out(), tcd->arg_1, tcd->arg_2);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Controller::balls(::CORBA::String_out ballsStr, ::CORBA::Octet& nBalls, ::CORBA::Boolean& hasBall0)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_e0000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_21000000, "balls", 6);
-
-
-  _invoke(_call_desc);
-  ballsStr = _call_desc.arg_0._retn();
-  nBalls = _call_desc.arg_1;
-  hasBall0 = _call_desc.arg_2;
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Controller::ballPosition
-
-// Proxy call descriptor class. Mangled signature:
-//  void_i_coctet_o_cGEARSystem_mCORBATypes_mPosition
-class _0RL_cd_f9ba7d5cd2d6498c_31000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_31000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  void marshalArguments(cdrStream&);
-  void unmarshalArguments(cdrStream&);
-
-  void unmarshalReturnedValues(cdrStream&);
-  void marshalReturnedValues(cdrStream&);
-  
-  
-  static const char* const _user_exns[];
-
-  ::CORBA::Octet arg_0;
-  GEARSystem::CORBATypes::Position arg_1_;
-  GEARSystem::CORBATypes::Position* arg_1;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_31000000::marshalArguments(cdrStream& _n)
-{
-  _n.marshalOctet(arg_0);
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_31000000::unmarshalArguments(cdrStream& _n)
-{
-  arg_0 = _n.unmarshalOctet();
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_31000000::marshalReturnedValues(cdrStream& _n)
-{
-  (const GEARSystem::CORBATypes::Position&) *arg_1 >>= _n;
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_31000000::unmarshalReturnedValues(cdrStream& _n)
-{
-  (GEARSystem::CORBATypes::Position&)*arg_1 <<= _n;
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_31000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_41000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_31000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_31000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Controller* impl = (GEARSystem::CORBAInterfaces::_impl_Controller*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Controller::_PD_repoId);
-  impl->ballPosition(tcd->arg_0, *tcd->arg_1);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Controller::ballPosition(::CORBA::Octet ballNum, ::GEARSystem::CORBATypes::Position& position)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_31000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_41000000, "ballPosition", 13);
-  _call_desc.arg_0 = ballNum;
-  _call_desc.arg_1 = &(::GEARSystem::CORBATypes::Position&) position;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Controller::ballVelocity
-
-// Proxy call descriptor class. Mangled signature:
-//  void_i_coctet_o_cGEARSystem_mCORBATypes_mVelocity
-class _0RL_cd_f9ba7d5cd2d6498c_51000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_51000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  void marshalArguments(cdrStream&);
-  void unmarshalArguments(cdrStream&);
-
-  void unmarshalReturnedValues(cdrStream&);
-  void marshalReturnedValues(cdrStream&);
-  
-  
-  static const char* const _user_exns[];
-
-  ::CORBA::Octet arg_0;
-  GEARSystem::CORBATypes::Velocity arg_1_;
-  GEARSystem::CORBATypes::Velocity* arg_1;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_51000000::marshalArguments(cdrStream& _n)
-{
-  _n.marshalOctet(arg_0);
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_51000000::unmarshalArguments(cdrStream& _n)
-{
-  arg_0 = _n.unmarshalOctet();
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_51000000::marshalReturnedValues(cdrStream& _n)
-{
-  (const GEARSystem::CORBATypes::Velocity&) *arg_1 >>= _n;
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_51000000::unmarshalReturnedValues(cdrStream& _n)
-{
-  (GEARSystem::CORBATypes::Velocity&)*arg_1 <<= _n;
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_51000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_61000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_51000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_51000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Controller* impl = (GEARSystem::CORBAInterfaces::_impl_Controller*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Controller::_PD_repoId);
-  impl->ballVelocity(tcd->arg_0, *tcd->arg_1);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Controller::ballVelocity(::CORBA::Octet ballNum, ::GEARSystem::CORBATypes::Velocity& velocity)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_51000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_61000000, "ballVelocity", 13);
-  _call_desc.arg_0 = ballNum;
-  _call_desc.arg_1 = &(::GEARSystem::CORBATypes::Velocity&) velocity;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Controller::playerPosition
-
-// Proxy call descriptor class. Mangled signature:
-//  void_i_coctet_i_coctet_o_cGEARSystem_mCORBATypes_mPosition
-class _0RL_cd_f9ba7d5cd2d6498c_71000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_71000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  void marshalArguments(cdrStream&);
-  void unmarshalArguments(cdrStream&);
-
-  void unmarshalReturnedValues(cdrStream&);
-  void marshalReturnedValues(cdrStream&);
-  
-  
-  static const char* const _user_exns[];
-
-  ::CORBA::Octet arg_0;
-  ::CORBA::Octet arg_1;
-  GEARSystem::CORBATypes::Position arg_2_;
-  GEARSystem::CORBATypes::Position* arg_2;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_71000000::marshalArguments(cdrStream& _n)
-{
-  _n.marshalOctet(arg_0);
-  _n.marshalOctet(arg_1);
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_71000000::unmarshalArguments(cdrStream& _n)
-{
-  arg_0 = _n.unmarshalOctet();
-  arg_1 = _n.unmarshalOctet();
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_71000000::marshalReturnedValues(cdrStream& _n)
-{
-  (const GEARSystem::CORBATypes::Position&) *arg_2 >>= _n;
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_71000000::unmarshalReturnedValues(cdrStream& _n)
-{
-  (GEARSystem::CORBATypes::Position&)*arg_2 <<= _n;
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_71000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_81000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_71000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_71000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Controller* impl = (GEARSystem::CORBAInterfaces::_impl_Controller*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Controller::_PD_repoId);
-  impl->playerPosition(tcd->arg_0, tcd->arg_1, *tcd->arg_2);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Controller::playerPosition(::CORBA::Octet teamNum, ::CORBA::Octet playerNum, ::GEARSystem::CORBATypes::Position& position)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_71000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_81000000, "playerPosition", 15);
-  _call_desc.arg_0 = teamNum;
-  _call_desc.arg_1 = playerNum;
-  _call_desc.arg_2 = &(::GEARSystem::CORBATypes::Position&) position;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Controller::playerOrientation
-
-// Proxy call descriptor class. Mangled signature:
-//  void_i_coctet_i_coctet_o_cGEARSystem_mCORBATypes_mAngle
-class _0RL_cd_f9ba7d5cd2d6498c_91000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_91000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  void marshalArguments(cdrStream&);
-  void unmarshalArguments(cdrStream&);
-
-  void unmarshalReturnedValues(cdrStream&);
-  void marshalReturnedValues(cdrStream&);
-  
-  
-  static const char* const _user_exns[];
-
-  ::CORBA::Octet arg_0;
-  ::CORBA::Octet arg_1;
-  GEARSystem::CORBATypes::Angle arg_2_;
-  GEARSystem::CORBATypes::Angle* arg_2;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_91000000::marshalArguments(cdrStream& _n)
-{
-  _n.marshalOctet(arg_0);
-  _n.marshalOctet(arg_1);
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_91000000::unmarshalArguments(cdrStream& _n)
-{
-  arg_0 = _n.unmarshalOctet();
-  arg_1 = _n.unmarshalOctet();
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_91000000::marshalReturnedValues(cdrStream& _n)
-{
-  (const GEARSystem::CORBATypes::Angle&) *arg_2 >>= _n;
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_91000000::unmarshalReturnedValues(cdrStream& _n)
-{
-  (GEARSystem::CORBATypes::Angle&)*arg_2 <<= _n;
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_91000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_a1000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_91000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_91000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Controller* impl = (GEARSystem::CORBAInterfaces::_impl_Controller*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Controller::_PD_repoId);
-  impl->playerOrientation(tcd->arg_0, tcd->arg_1, *tcd->arg_2);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Controller::playerOrientation(::CORBA::Octet teamNum, ::CORBA::Octet playerNum, ::GEARSystem::CORBATypes::Angle& orientation)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_91000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_a1000000, "playerOrientation", 18);
-  _call_desc.arg_0 = teamNum;
-  _call_desc.arg_1 = playerNum;
-  _call_desc.arg_2 = &(::GEARSystem::CORBATypes::Angle&) orientation;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Controller::playerVelocity
-
-// Proxy call descriptor class. Mangled signature:
-//  void_i_coctet_i_coctet_o_cGEARSystem_mCORBATypes_mVelocity
-class _0RL_cd_f9ba7d5cd2d6498c_b1000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_b1000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  void marshalArguments(cdrStream&);
-  void unmarshalArguments(cdrStream&);
-
-  void unmarshalReturnedValues(cdrStream&);
-  void marshalReturnedValues(cdrStream&);
-  
-  
-  static const char* const _user_exns[];
-
-  ::CORBA::Octet arg_0;
-  ::CORBA::Octet arg_1;
-  GEARSystem::CORBATypes::Velocity arg_2_;
-  GEARSystem::CORBATypes::Velocity* arg_2;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_b1000000::marshalArguments(cdrStream& _n)
-{
-  _n.marshalOctet(arg_0);
-  _n.marshalOctet(arg_1);
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_b1000000::unmarshalArguments(cdrStream& _n)
-{
-  arg_0 = _n.unmarshalOctet();
-  arg_1 = _n.unmarshalOctet();
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_b1000000::marshalReturnedValues(cdrStream& _n)
-{
-  (const GEARSystem::CORBATypes::Velocity&) *arg_2 >>= _n;
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_b1000000::unmarshalReturnedValues(cdrStream& _n)
-{
-  (GEARSystem::CORBATypes::Velocity&)*arg_2 <<= _n;
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_b1000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_c1000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_b1000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_b1000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Controller* impl = (GEARSystem::CORBAInterfaces::_impl_Controller*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Controller::_PD_repoId);
-  impl->playerVelocity(tcd->arg_0, tcd->arg_1, *tcd->arg_2);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Controller::playerVelocity(::CORBA::Octet teamNum, ::CORBA::Octet playerNum, ::GEARSystem::CORBATypes::Velocity& velocity)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_b1000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_c1000000, "playerVelocity", 15);
-  _call_desc.arg_0 = teamNum;
-  _call_desc.arg_1 = playerNum;
-  _call_desc.arg_2 = &(::GEARSystem::CORBATypes::Velocity&) velocity;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Controller::playerAngularSpeed
-
-// Proxy call descriptor class. Mangled signature:
-//  void_i_coctet_i_coctet_o_cGEARSystem_mCORBATypes_mAngularSpeed
-class _0RL_cd_f9ba7d5cd2d6498c_d1000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_d1000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  void marshalArguments(cdrStream&);
-  void unmarshalArguments(cdrStream&);
-
-  void unmarshalReturnedValues(cdrStream&);
-  void marshalReturnedValues(cdrStream&);
-  
-  
-  static const char* const _user_exns[];
-
-  ::CORBA::Octet arg_0;
-  ::CORBA::Octet arg_1;
-  GEARSystem::CORBATypes::AngularSpeed arg_2_;
-  GEARSystem::CORBATypes::AngularSpeed* arg_2;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_d1000000::marshalArguments(cdrStream& _n)
-{
-  _n.marshalOctet(arg_0);
-  _n.marshalOctet(arg_1);
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_d1000000::unmarshalArguments(cdrStream& _n)
-{
-  arg_0 = _n.unmarshalOctet();
-  arg_1 = _n.unmarshalOctet();
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_d1000000::marshalReturnedValues(cdrStream& _n)
-{
-  (const GEARSystem::CORBATypes::AngularSpeed&) *arg_2 >>= _n;
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_d1000000::unmarshalReturnedValues(cdrStream& _n)
-{
-  (GEARSystem::CORBATypes::AngularSpeed&)*arg_2 <<= _n;
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_d1000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_e1000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_d1000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_d1000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Controller* impl = (GEARSystem::CORBAInterfaces::_impl_Controller*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Controller::_PD_repoId);
-  impl->playerAngularSpeed(tcd->arg_0, tcd->arg_1, *tcd->arg_2);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Controller::playerAngularSpeed(::CORBA::Octet teamNum, ::CORBA::Octet playerNum, ::GEARSystem::CORBATypes::AngularSpeed& angularSpeed)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_d1000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_e1000000, "playerAngularSpeed", 19);
-  _call_desc.arg_0 = teamNum;
-  _call_desc.arg_1 = playerNum;
-  _call_desc.arg_2 = &(::GEARSystem::CORBATypes::AngularSpeed&) angularSpeed;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Controller::ballPossession
-
-// Proxy call descriptor class. Mangled signature:
-//  void_i_coctet_i_coctet_o_cboolean
-class _0RL_cd_f9ba7d5cd2d6498c_f1000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_f1000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  void marshalArguments(cdrStream&);
-  void unmarshalArguments(cdrStream&);
-
-  void unmarshalReturnedValues(cdrStream&);
-  void marshalReturnedValues(cdrStream&);
-  
-  
-  static const char* const _user_exns[];
-
-  ::CORBA::Octet arg_0;
-  ::CORBA::Octet arg_1;
-  ::CORBA::Boolean arg_2;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_f1000000::marshalArguments(cdrStream& _n)
-{
-  _n.marshalOctet(arg_0);
-  _n.marshalOctet(arg_1);
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_f1000000::unmarshalArguments(cdrStream& _n)
-{
-  arg_0 = _n.unmarshalOctet();
-  arg_1 = _n.unmarshalOctet();
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_f1000000::marshalReturnedValues(cdrStream& _n)
-{
-  _n.marshalBoolean(arg_2);
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_f1000000::unmarshalReturnedValues(cdrStream& _n)
-{
-  arg_2 = _n.unmarshalBoolean();
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_f1000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_02000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_f1000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_f1000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Controller* impl = (GEARSystem::CORBAInterfaces::_impl_Controller*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Controller::_PD_repoId);
-  impl->ballPossession(tcd->arg_0, tcd->arg_1, tcd->arg_2);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Controller::ballPossession(::CORBA::Octet teamNum, ::CORBA::Octet playerNum, ::CORBA::Boolean& possession)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_f1000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_02000000, "ballPossession", 15);
-  _call_desc.arg_0 = teamNum;
-  _call_desc.arg_1 = playerNum;
-
-  _invoke(_call_desc);
-  possession = _call_desc.arg_2;
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Controller::kickEnabled
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_12000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_f1000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_f1000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Controller* impl = (GEARSystem::CORBAInterfaces::_impl_Controller*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Controller::_PD_repoId);
-  impl->kickEnabled(tcd->arg_0, tcd->arg_1, tcd->arg_2);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Controller::kickEnabled(::CORBA::Octet teamNum, ::CORBA::Octet playerNum, ::CORBA::Boolean& status)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_f1000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_12000000, "kickEnabled", 12);
-  _call_desc.arg_0 = teamNum;
-  _call_desc.arg_1 = playerNum;
-
-  _invoke(_call_desc);
-  status = _call_desc.arg_2;
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Controller::dribbleEnabled
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_22000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_f1000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_f1000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Controller* impl = (GEARSystem::CORBAInterfaces::_impl_Controller*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Controller::_PD_repoId);
-  impl->dribbleEnabled(tcd->arg_0, tcd->arg_1, tcd->arg_2);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Controller::dribbleEnabled(::CORBA::Octet teamNum, ::CORBA::Octet playerNum, ::CORBA::Boolean& status)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_f1000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_22000000, "dribbleEnabled", 15);
-  _call_desc.arg_0 = teamNum;
-  _call_desc.arg_1 = playerNum;
-
-  _invoke(_call_desc);
-  status = _call_desc.arg_2;
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Controller::batteryCharge
-
-// Proxy call descriptor class. Mangled signature:
-//  void_i_coctet_i_coctet_o_cchar
-class _0RL_cd_f9ba7d5cd2d6498c_32000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_32000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  void marshalArguments(cdrStream&);
-  void unmarshalArguments(cdrStream&);
-
-  void unmarshalReturnedValues(cdrStream&);
-  void marshalReturnedValues(cdrStream&);
-  
-  
-  static const char* const _user_exns[];
-
-  ::CORBA::Octet arg_0;
-  ::CORBA::Octet arg_1;
-  ::CORBA::Char arg_2;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_32000000::marshalArguments(cdrStream& _n)
-{
-  _n.marshalOctet(arg_0);
-  _n.marshalOctet(arg_1);
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_32000000::unmarshalArguments(cdrStream& _n)
-{
-  arg_0 = _n.unmarshalOctet();
-  arg_1 = _n.unmarshalOctet();
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_32000000::marshalReturnedValues(cdrStream& _n)
-{
-  _n.marshalChar(arg_2);
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_32000000::unmarshalReturnedValues(cdrStream& _n)
-{
-  arg_2 = _n.unmarshalChar();
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_32000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_42000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_32000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_32000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Controller* impl = (GEARSystem::CORBAInterfaces::_impl_Controller*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Controller::_PD_repoId);
-  impl->batteryCharge(tcd->arg_0, tcd->arg_1, tcd->arg_2);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Controller::batteryCharge(::CORBA::Octet teamNum, ::CORBA::Octet playerNum, ::CORBA::Char& charge)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_32000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_42000000, "batteryCharge", 14);
-  _call_desc.arg_0 = teamNum;
-  _call_desc.arg_1 = playerNum;
-
-  _invoke(_call_desc);
-  charge = _call_desc.arg_2;
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Controller::capacitorCharge
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_52000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_32000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_32000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Controller* impl = (GEARSystem::CORBAInterfaces::_impl_Controller*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Controller::_PD_repoId);
-  impl->capacitorCharge(tcd->arg_0, tcd->arg_1, tcd->arg_2);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Controller::capacitorCharge(::CORBA::Octet teamNum, ::CORBA::Octet playerNum, ::CORBA::Char& charge)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_32000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_52000000, "capacitorCharge", 16);
-  _call_desc.arg_0 = teamNum;
-  _call_desc.arg_1 = playerNum;
-
-  _invoke(_call_desc);
-  charge = _call_desc.arg_2;
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Controller::setSpeed
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_62000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_00000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_00000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Controller* impl = (GEARSystem::CORBAInterfaces::_impl_Controller*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Controller::_PD_repoId);
-  impl->setSpeed(tcd->arg_0, tcd->arg_1, tcd->arg_2, tcd->arg_3, tcd->arg_4);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Controller::setSpeed(::CORBA::Octet teamNum, ::CORBA::Octet playerNum, ::CORBA::Float x, ::CORBA::Float y, ::CORBA::Float theta)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_00000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_62000000, "setSpeed", 9);
-  _call_desc.arg_0 = teamNum;
-  _call_desc.arg_1 = playerNum;
-  _call_desc.arg_2 = x;
-  _call_desc.arg_3 = y;
-  _call_desc.arg_4 = theta;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Controller::kick
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_72000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_20000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_20000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Controller* impl = (GEARSystem::CORBAInterfaces::_impl_Controller*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Controller::_PD_repoId);
-  impl->kick(tcd->arg_0, tcd->arg_1, tcd->arg_2);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Controller::kick(::CORBA::Octet teamNum, ::CORBA::Octet playerNum, ::CORBA::Float power)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_20000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_72000000, "kick", 5);
-  _call_desc.arg_0 = teamNum;
-  _call_desc.arg_1 = playerNum;
-  _call_desc.arg_2 = power;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Controller::chipKick
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_82000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_20000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_20000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Controller* impl = (GEARSystem::CORBAInterfaces::_impl_Controller*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Controller::_PD_repoId);
-  impl->chipKick(tcd->arg_0, tcd->arg_1, tcd->arg_2);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Controller::chipKick(::CORBA::Octet teamNum, ::CORBA::Octet playerNum, ::CORBA::Float power)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_20000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_82000000, "chipKick", 9);
-  _call_desc.arg_0 = teamNum;
-  _call_desc.arg_1 = playerNum;
-  _call_desc.arg_2 = power;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Controller::kickOnTouch
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_92000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_50000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_50000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Controller* impl = (GEARSystem::CORBAInterfaces::_impl_Controller*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Controller::_PD_repoId);
-  impl->kickOnTouch(tcd->arg_0, tcd->arg_1, tcd->arg_2, tcd->arg_3);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Controller::kickOnTouch(::CORBA::Octet teamNum, ::CORBA::Octet playerNum, ::CORBA::Boolean enable, ::CORBA::Float power)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_50000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_92000000, "kickOnTouch", 12);
-  _call_desc.arg_0 = teamNum;
-  _call_desc.arg_1 = playerNum;
-  _call_desc.arg_2 = enable;
-  _call_desc.arg_3 = power;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Controller::chipKickOnTouch
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_a2000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_50000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_50000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Controller* impl = (GEARSystem::CORBAInterfaces::_impl_Controller*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Controller::_PD_repoId);
-  impl->chipKickOnTouch(tcd->arg_0, tcd->arg_1, tcd->arg_2, tcd->arg_3);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Controller::chipKickOnTouch(::CORBA::Octet teamNum, ::CORBA::Octet playerNum, ::CORBA::Boolean enable, ::CORBA::Float power)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_50000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_a2000000, "chipKickOnTouch", 16);
-  _call_desc.arg_0 = teamNum;
-  _call_desc.arg_1 = playerNum;
-  _call_desc.arg_2 = enable;
-  _call_desc.arg_3 = power;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Controller::holdBall
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_b2000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_80000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_80000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Controller* impl = (GEARSystem::CORBAInterfaces::_impl_Controller*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Controller::_PD_repoId);
-  impl->holdBall(tcd->arg_0, tcd->arg_1, tcd->arg_2);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Controller::holdBall(::CORBA::Octet teamNum, ::CORBA::Octet playerNum, ::CORBA::Boolean enable)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_80000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_b2000000, "holdBall", 9);
-  _call_desc.arg_0 = teamNum;
-  _call_desc.arg_1 = playerNum;
-  _call_desc.arg_2 = enable;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Controller::fieldTopRightCorner
-
-// Proxy call descriptor class. Mangled signature:
-//  void_o_cGEARSystem_mCORBATypes_mPosition
-class _0RL_cd_f9ba7d5cd2d6498c_c2000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_c2000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  
-  void unmarshalReturnedValues(cdrStream&);
-  void marshalReturnedValues(cdrStream&);
-  
-  
-  static const char* const _user_exns[];
-
-  GEARSystem::CORBATypes::Position arg_0_;
-  GEARSystem::CORBATypes::Position* arg_0;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_c2000000::marshalReturnedValues(cdrStream& _n)
-{
-  (const GEARSystem::CORBATypes::Position&) *arg_0 >>= _n;
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_c2000000::unmarshalReturnedValues(cdrStream& _n)
-{
-  (GEARSystem::CORBATypes::Position&)*arg_0 <<= _n;
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_c2000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_d2000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_c2000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_c2000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Controller* impl = (GEARSystem::CORBAInterfaces::_impl_Controller*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Controller::_PD_repoId);
-  impl->fieldTopRightCorner(*tcd->arg_0);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Controller::fieldTopRightCorner(::GEARSystem::CORBATypes::Position& position)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_c2000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_d2000000, "fieldTopRightCorner", 20);
-  _call_desc.arg_0 = &(::GEARSystem::CORBATypes::Position&) position;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Controller::fieldTopLeftCorner
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_e2000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_c2000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_c2000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Controller* impl = (GEARSystem::CORBAInterfaces::_impl_Controller*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Controller::_PD_repoId);
-  impl->fieldTopLeftCorner(*tcd->arg_0);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Controller::fieldTopLeftCorner(::GEARSystem::CORBATypes::Position& position)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_c2000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_e2000000, "fieldTopLeftCorner", 19);
-  _call_desc.arg_0 = &(::GEARSystem::CORBATypes::Position&) position;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Controller::fieldBottomLeftCorner
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_f2000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_c2000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_c2000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Controller* impl = (GEARSystem::CORBAInterfaces::_impl_Controller*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Controller::_PD_repoId);
-  impl->fieldBottomLeftCorner(*tcd->arg_0);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Controller::fieldBottomLeftCorner(::GEARSystem::CORBATypes::Position& position)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_c2000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_f2000000, "fieldBottomLeftCorner", 22);
-  _call_desc.arg_0 = &(::GEARSystem::CORBATypes::Position&) position;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Controller::fieldBottomRightCorner
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_03000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_c2000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_c2000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Controller* impl = (GEARSystem::CORBAInterfaces::_impl_Controller*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Controller::_PD_repoId);
-  impl->fieldBottomRightCorner(*tcd->arg_0);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Controller::fieldBottomRightCorner(::GEARSystem::CORBATypes::Position& position)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_c2000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_03000000, "fieldBottomRightCorner", 23);
-  _call_desc.arg_0 = &(::GEARSystem::CORBATypes::Position&) position;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Controller::fieldCenter
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_13000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_c2000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_c2000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Controller* impl = (GEARSystem::CORBAInterfaces::_impl_Controller*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Controller::_PD_repoId);
-  impl->fieldCenter(*tcd->arg_0);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Controller::fieldCenter(::GEARSystem::CORBATypes::Position& position)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_c2000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_13000000, "fieldCenter", 12);
-  _call_desc.arg_0 = &(::GEARSystem::CORBATypes::Position&) position;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Controller::leftGoal
-
-// Proxy call descriptor class. Mangled signature:
-//  void_o_cGEARSystem_mCORBATypes_mPosition_o_cGEARSystem_mCORBATypes_mPosition_o_cfloat_o_cfloat_o_cfloat_o_cfloat
-class _0RL_cd_f9ba7d5cd2d6498c_23000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_23000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  
-  void unmarshalReturnedValues(cdrStream&);
-  void marshalReturnedValues(cdrStream&);
-  
-  
-  static const char* const _user_exns[];
-
-  GEARSystem::CORBATypes::Position arg_0_;
-  GEARSystem::CORBATypes::Position* arg_0;
-  GEARSystem::CORBATypes::Position arg_1_;
-  GEARSystem::CORBATypes::Position* arg_1;
-  ::CORBA::Float arg_2;
-  ::CORBA::Float arg_3;
-  ::CORBA::Float arg_4;
-  ::CORBA::Float arg_5;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_23000000::marshalReturnedValues(cdrStream& _n)
-{
-  (const GEARSystem::CORBATypes::Position&) *arg_0 >>= _n;
-  (const GEARSystem::CORBATypes::Position&) *arg_1 >>= _n;
-  arg_2 >>= _n;
-  arg_3 >>= _n;
-  arg_4 >>= _n;
-  arg_5 >>= _n;
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_23000000::unmarshalReturnedValues(cdrStream& _n)
-{
-  (GEARSystem::CORBATypes::Position&)*arg_0 <<= _n;
-  (GEARSystem::CORBATypes::Position&)*arg_1 <<= _n;
-  (::CORBA::Float&)arg_2 <<= _n;
-  (::CORBA::Float&)arg_3 <<= _n;
-  (::CORBA::Float&)arg_4 <<= _n;
-  (::CORBA::Float&)arg_5 <<= _n;
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_23000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_33000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_23000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_23000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Controller* impl = (GEARSystem::CORBAInterfaces::_impl_Controller*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Controller::_PD_repoId);
-  impl->leftGoal(*tcd->arg_0, *tcd->arg_1, tcd->arg_2, tcd->arg_3, tcd->arg_4, tcd->arg_5);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Controller::leftGoal(::GEARSystem::CORBATypes::Position& left, ::GEARSystem::CORBATypes::Position& right, ::CORBA::Float& depth, ::CORBA::Float& areaLength, ::CORBA::Float& areaWidth, ::CORBA::Float& areaRoundedRadius)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_23000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_33000000, "leftGoal", 9);
-  _call_desc.arg_0 = &(::GEARSystem::CORBATypes::Position&) left;
-  _call_desc.arg_1 = &(::GEARSystem::CORBATypes::Position&) right;
-
-  _invoke(_call_desc);
-  depth = _call_desc.arg_2;
-  areaLength = _call_desc.arg_3;
-  areaWidth = _call_desc.arg_4;
-  areaRoundedRadius = _call_desc.arg_5;
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Controller::rightGoal
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_43000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_23000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_23000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Controller* impl = (GEARSystem::CORBAInterfaces::_impl_Controller*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Controller::_PD_repoId);
-  impl->rightGoal(*tcd->arg_0, *tcd->arg_1, tcd->arg_2, tcd->arg_3, tcd->arg_4, tcd->arg_5);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Controller::rightGoal(::GEARSystem::CORBATypes::Position& left, ::GEARSystem::CORBATypes::Position& right, ::CORBA::Float& depth, ::CORBA::Float& areaLength, ::CORBA::Float& areaWidth, ::CORBA::Float& areaRoundedRadius)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_23000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_43000000, "rightGoal", 10);
-  _call_desc.arg_0 = &(::GEARSystem::CORBATypes::Position&) left;
-  _call_desc.arg_1 = &(::GEARSystem::CORBATypes::Position&) right;
-
-  _invoke(_call_desc);
-  depth = _call_desc.arg_2;
-  areaLength = _call_desc.arg_3;
-  areaWidth = _call_desc.arg_4;
-  areaRoundedRadius = _call_desc.arg_5;
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Controller::leftPenaltyMark
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_53000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_c2000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_c2000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Controller* impl = (GEARSystem::CORBAInterfaces::_impl_Controller*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Controller::_PD_repoId);
-  impl->leftPenaltyMark(*tcd->arg_0);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Controller::leftPenaltyMark(::GEARSystem::CORBATypes::Position& position)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_c2000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_53000000, "leftPenaltyMark", 16);
-  _call_desc.arg_0 = &(::GEARSystem::CORBATypes::Position&) position;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Controller::rightPenaltyMark
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_63000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_c2000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_c2000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Controller* impl = (GEARSystem::CORBAInterfaces::_impl_Controller*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Controller::_PD_repoId);
-  impl->rightPenaltyMark(*tcd->arg_0);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Controller::rightPenaltyMark(::GEARSystem::CORBATypes::Position& position)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_c2000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_63000000, "rightPenaltyMark", 17);
-  _call_desc.arg_0 = &(::GEARSystem::CORBATypes::Position&) position;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Controller::fieldCenterRadius
-
-// Proxy call descriptor class. Mangled signature:
-//  void_o_cfloat
-class _0RL_cd_f9ba7d5cd2d6498c_73000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_73000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  
-  void unmarshalReturnedValues(cdrStream&);
-  void marshalReturnedValues(cdrStream&);
-  
-  
-  static const char* const _user_exns[];
-
-  ::CORBA::Float arg_0;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_73000000::marshalReturnedValues(cdrStream& _n)
-{
-  arg_0 >>= _n;
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_73000000::unmarshalReturnedValues(cdrStream& _n)
-{
-  (::CORBA::Float&)arg_0 <<= _n;
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_73000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_83000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_73000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_73000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Controller* impl = (GEARSystem::CORBAInterfaces::_impl_Controller*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Controller::_PD_repoId);
-  impl->fieldCenterRadius(tcd->arg_0);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Controller::fieldCenterRadius(::CORBA::Float& centerRadius)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_73000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_83000000, "fieldCenterRadius", 18);
-
-
-  _invoke(_call_desc);
-  centerRadius = _call_desc.arg_0;
-
-
-}
-
-GEARSystem::CORBAInterfaces::_pof_Controller::~_pof_Controller() {}
-
-
-omniObjRef*
-GEARSystem::CORBAInterfaces::_pof_Controller::newObjRef(omniIOR* ior, omniIdentity* id)
-{
-  return new ::GEARSystem::CORBAInterfaces::_objref_Controller(ior, id);
-}
-
-
-::CORBA::Boolean
-GEARSystem::CORBAInterfaces::_pof_Controller::is_a(const char* id) const
-{
-  if (omni::ptrStrMatch(id, ::GEARSystem::CORBAInterfaces::Controller::_PD_repoId))
-    return 1;
-  
-  return 0;
-}
-
-const GEARSystem::CORBAInterfaces::_pof_Controller _the_pof_GEARSystem_mCORBAInterfaces_mController;
-
-GEARSystem::CORBAInterfaces::_impl_Controller::~_impl_Controller() {}
-
-
-::CORBA::Boolean
-GEARSystem::CORBAInterfaces::_impl_Controller::_dispatch(omniCallHandle& _handle)
-{
-  const char* op = _handle.operation_name();
-
-  if (omni::strMatch(op, "teamName")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_a0000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_b0000000, "teamName", 9, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "teamNumber")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_c0000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_d0000000, "teamNumber", 11, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "teams")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_e0000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_f0000000, "teams", 6, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "players")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_01000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_11000000, "players", 8, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "balls")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_e0000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_21000000, "balls", 6, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "ballPosition")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_31000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_41000000, "ballPosition", 13, 1);
-    _call_desc.arg_1 = &_call_desc.arg_1_;
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "ballVelocity")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_51000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_61000000, "ballVelocity", 13, 1);
-    _call_desc.arg_1 = &_call_desc.arg_1_;
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "playerPosition")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_71000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_81000000, "playerPosition", 15, 1);
-    _call_desc.arg_2 = &_call_desc.arg_2_;
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "playerOrientation")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_91000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_a1000000, "playerOrientation", 18, 1);
-    _call_desc.arg_2 = &_call_desc.arg_2_;
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "playerVelocity")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_b1000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_c1000000, "playerVelocity", 15, 1);
-    _call_desc.arg_2 = &_call_desc.arg_2_;
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "playerAngularSpeed")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_d1000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_e1000000, "playerAngularSpeed", 19, 1);
-    _call_desc.arg_2 = &_call_desc.arg_2_;
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "ballPossession")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_f1000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_02000000, "ballPossession", 15, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "kickEnabled")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_f1000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_12000000, "kickEnabled", 12, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "dribbleEnabled")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_f1000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_22000000, "dribbleEnabled", 15, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "batteryCharge")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_32000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_42000000, "batteryCharge", 14, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "capacitorCharge")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_32000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_52000000, "capacitorCharge", 16, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "setSpeed")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_00000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_62000000, "setSpeed", 9, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "kick")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_20000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_72000000, "kick", 5, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "chipKick")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_20000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_82000000, "chipKick", 9, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "kickOnTouch")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_50000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_92000000, "kickOnTouch", 12, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "chipKickOnTouch")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_50000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_a2000000, "chipKickOnTouch", 16, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "holdBall")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_80000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_b2000000, "holdBall", 9, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "fieldTopRightCorner")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_c2000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_d2000000, "fieldTopRightCorner", 20, 1);
-    _call_desc.arg_0 = &_call_desc.arg_0_;
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "fieldTopLeftCorner")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_c2000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_e2000000, "fieldTopLeftCorner", 19, 1);
-    _call_desc.arg_0 = &_call_desc.arg_0_;
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "fieldBottomLeftCorner")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_c2000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_f2000000, "fieldBottomLeftCorner", 22, 1);
-    _call_desc.arg_0 = &_call_desc.arg_0_;
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "fieldBottomRightCorner")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_c2000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_03000000, "fieldBottomRightCorner", 23, 1);
-    _call_desc.arg_0 = &_call_desc.arg_0_;
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "fieldCenter")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_c2000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_13000000, "fieldCenter", 12, 1);
-    _call_desc.arg_0 = &_call_desc.arg_0_;
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "leftGoal")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_23000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_33000000, "leftGoal", 9, 1);
-    _call_desc.arg_0 = &_call_desc.arg_0_;
-    _call_desc.arg_1 = &_call_desc.arg_1_;
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "rightGoal")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_23000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_43000000, "rightGoal", 10, 1);
-    _call_desc.arg_0 = &_call_desc.arg_0_;
-    _call_desc.arg_1 = &_call_desc.arg_1_;
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "leftPenaltyMark")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_c2000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_53000000, "leftPenaltyMark", 16, 1);
-    _call_desc.arg_0 = &_call_desc.arg_0_;
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "rightPenaltyMark")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_c2000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_63000000, "rightPenaltyMark", 17, 1);
-    _call_desc.arg_0 = &_call_desc.arg_0_;
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "fieldCenterRadius")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_73000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_83000000, "fieldCenterRadius", 18, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-
-  return 0;
-}
-
-void*
-GEARSystem::CORBAInterfaces::_impl_Controller::_ptrToInterface(const char* id)
-{
-  if (id == ::GEARSystem::CORBAInterfaces::Controller::_PD_repoId)
-    return (::GEARSystem::CORBAInterfaces::_impl_Controller*) this;
-  
-  if (id == ::CORBA::Object::_PD_repoId)
-    return (void*) 1;
-
-  if (omni::strMatch(id, ::GEARSystem::CORBAInterfaces::Controller::_PD_repoId))
-    return (::GEARSystem::CORBAInterfaces::_impl_Controller*) this;
-  
-  if (omni::strMatch(id, ::CORBA::Object::_PD_repoId))
-    return (void*) 1;
-  return 0;
-}
-
-const char*
-GEARSystem::CORBAInterfaces::_impl_Controller::_mostDerivedRepoId()
-{
-  return ::GEARSystem::CORBAInterfaces::Controller::_PD_repoId;
-}
-
-GEARSystem::CORBAInterfaces::Sensor_ptr GEARSystem::CORBAInterfaces::Sensor_Helper::_nil() {
-  return ::GEARSystem::CORBAInterfaces::Sensor::_nil();
-}
-
-::CORBA::Boolean GEARSystem::CORBAInterfaces::Sensor_Helper::is_nil(::GEARSystem::CORBAInterfaces::Sensor_ptr p) {
-  return ::CORBA::is_nil(p);
-
-}
-
-void GEARSystem::CORBAInterfaces::Sensor_Helper::release(::GEARSystem::CORBAInterfaces::Sensor_ptr p) {
-  ::CORBA::release(p);
-}
-
-void GEARSystem::CORBAInterfaces::Sensor_Helper::marshalObjRef(::GEARSystem::CORBAInterfaces::Sensor_ptr obj, cdrStream& s) {
-  ::GEARSystem::CORBAInterfaces::Sensor::_marshalObjRef(obj, s);
-}
-
-GEARSystem::CORBAInterfaces::Sensor_ptr GEARSystem::CORBAInterfaces::Sensor_Helper::unmarshalObjRef(cdrStream& s) {
-  return ::GEARSystem::CORBAInterfaces::Sensor::_unmarshalObjRef(s);
-}
-
-void GEARSystem::CORBAInterfaces::Sensor_Helper::duplicate(::GEARSystem::CORBAInterfaces::Sensor_ptr obj) {
-  if (obj && !obj->_NP_is_nil())  omni::duplicateObjRef(obj);
-}
-
-GEARSystem::CORBAInterfaces::Sensor_ptr
-GEARSystem::CORBAInterfaces::Sensor::_duplicate(::GEARSystem::CORBAInterfaces::Sensor_ptr obj)
-{
-  if (obj && !obj->_NP_is_nil())  omni::duplicateObjRef(obj);
-  return obj;
-}
-
-GEARSystem::CORBAInterfaces::Sensor_ptr
-GEARSystem::CORBAInterfaces::Sensor::_narrow(::CORBA::Object_ptr obj)
-{
-  if (!obj || obj->_NP_is_nil() || obj->_NP_is_pseudo()) return _nil();
-  _ptr_type e = (_ptr_type) obj->_PR_getobj()->_realNarrow(_PD_repoId);
-  return e ? e : _nil();
-}
-
-
-GEARSystem::CORBAInterfaces::Sensor_ptr
-GEARSystem::CORBAInterfaces::Sensor::_unchecked_narrow(::CORBA::Object_ptr obj)
-{
-  if (!obj || obj->_NP_is_nil() || obj->_NP_is_pseudo()) return _nil();
-  _ptr_type e = (_ptr_type) obj->_PR_getobj()->_uncheckedNarrow(_PD_repoId);
-  return e ? e : _nil();
-}
-
-GEARSystem::CORBAInterfaces::Sensor_ptr
-GEARSystem::CORBAInterfaces::Sensor::_nil()
-{
-#ifdef OMNI_UNLOADABLE_STUBS
-  static _objref_Sensor _the_nil_obj;
-  return &_the_nil_obj;
-#else
-  static _objref_Sensor* _the_nil_ptr = 0;
-  if (!_the_nil_ptr) {
-    omni::nilRefLock().lock();
-    if (!_the_nil_ptr) {
-      _the_nil_ptr = new _objref_Sensor;
-      registerNilCorbaObject(_the_nil_ptr);
-    }
-    omni::nilRefLock().unlock();
-  }
-  return _the_nil_ptr;
-#endif
-}
-
-const char* GEARSystem::CORBAInterfaces::Sensor::_PD_repoId = "IDL:GEARSystem/CORBAInterfaces/Sensor:1.0";
-
-
-GEARSystem::CORBAInterfaces::_objref_Sensor::~_objref_Sensor() {
-  
-}
-
-
-GEARSystem::CORBAInterfaces::_objref_Sensor::_objref_Sensor(omniIOR* ior, omniIdentity* id) :
-   omniObjRef(::GEARSystem::CORBAInterfaces::Sensor::_PD_repoId, ior, id, 1)
-   
-   
-{
-  _PR_setobj(this);
-}
-
-void*
-GEARSystem::CORBAInterfaces::_objref_Sensor::_ptrToObjRef(const char* id)
-{
-  if (id == ::GEARSystem::CORBAInterfaces::Sensor::_PD_repoId)
-    return (::GEARSystem::CORBAInterfaces::Sensor_ptr) this;
-  
-  if (id == ::CORBA::Object::_PD_repoId)
-    return (::CORBA::Object_ptr) this;
-
-  if (omni::strMatch(id, ::GEARSystem::CORBAInterfaces::Sensor::_PD_repoId))
-    return (::GEARSystem::CORBAInterfaces::Sensor_ptr) this;
-  
-  if (omni::strMatch(id, ::CORBA::Object::_PD_repoId))
-    return (::CORBA::Object_ptr) this;
-
-  return 0;
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Sensor::addTeam
-
-// Proxy call descriptor class. Mangled signature:
-//  void_i_coctet_i_cstring
-class _0RL_cd_f9ba7d5cd2d6498c_93000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_93000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  void marshalArguments(cdrStream&);
-  void unmarshalArguments(cdrStream&);
-
-    
-  
-  static const char* const _user_exns[];
-
-  ::CORBA::Octet arg_0;
-  ::CORBA::String_var arg_1_;
-  const char* arg_1;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_93000000::marshalArguments(cdrStream& _n)
-{
-  _n.marshalOctet(arg_0);
-  _n.marshalString(arg_1,0);
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_93000000::unmarshalArguments(cdrStream& _n)
-{
-  arg_0 = _n.unmarshalOctet();
-  arg_1_ = _n.unmarshalString(0);
-  arg_1 = arg_1_.in();
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_93000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_a3000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_93000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_93000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Sensor* impl = (GEARSystem::CORBAInterfaces::_impl_Sensor*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Sensor::_PD_repoId);
-  impl->addTeam(tcd->arg_0, tcd->arg_1);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Sensor::addTeam(::CORBA::Octet teamNum, const char* teamName)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_93000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_a3000000, "addTeam", 8);
-  _call_desc.arg_0 = teamNum;
-  _call_desc.arg_1 = teamName;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Sensor::delGEARSystemTeam
-
-// Proxy call descriptor class. Mangled signature:
-//  void_i_coctet
-class _0RL_cd_f9ba7d5cd2d6498c_b3000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_b3000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  void marshalArguments(cdrStream&);
-  void unmarshalArguments(cdrStream&);
-
-    
-  
-  static const char* const _user_exns[];
-
-  ::CORBA::Octet arg_0;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_b3000000::marshalArguments(cdrStream& _n)
-{
-  _n.marshalOctet(arg_0);
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_b3000000::unmarshalArguments(cdrStream& _n)
-{
-  arg_0 = _n.unmarshalOctet();
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_b3000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_c3000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_b3000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_b3000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Sensor* impl = (GEARSystem::CORBAInterfaces::_impl_Sensor*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Sensor::_PD_repoId);
-  impl->delGEARSystemTeam(tcd->arg_0);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Sensor::delGEARSystemTeam(::CORBA::Octet teamNum)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_b3000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_c3000000, "delGEARSystemTeam", 18);
-  _call_desc.arg_0 = teamNum;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Sensor::addBall
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_d3000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_b3000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_b3000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Sensor* impl = (GEARSystem::CORBAInterfaces::_impl_Sensor*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Sensor::_PD_repoId);
-  impl->addBall(tcd->arg_0);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Sensor::addBall(::CORBA::Octet ballNum)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_b3000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_d3000000, "addBall", 8);
-  _call_desc.arg_0 = ballNum;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Sensor::delBall
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_e3000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_b3000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_b3000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Sensor* impl = (GEARSystem::CORBAInterfaces::_impl_Sensor*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Sensor::_PD_repoId);
-  impl->delBall(tcd->arg_0);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Sensor::delBall(::CORBA::Octet ballNum)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_b3000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_e3000000, "delBall", 8);
-  _call_desc.arg_0 = ballNum;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Sensor::setBallPosition
-
-// Proxy call descriptor class. Mangled signature:
-//  void_i_coctet_i_cGEARSystem_mCORBATypes_mPosition
-class _0RL_cd_f9ba7d5cd2d6498c_f3000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_f3000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  void marshalArguments(cdrStream&);
-  void unmarshalArguments(cdrStream&);
-
-    
-  
-  static const char* const _user_exns[];
-
-  ::CORBA::Octet arg_0;
-  GEARSystem::CORBATypes::Position arg_1_;
-  const GEARSystem::CORBATypes::Position* arg_1;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_f3000000::marshalArguments(cdrStream& _n)
-{
-  _n.marshalOctet(arg_0);
-  (const GEARSystem::CORBATypes::Position&) *arg_1 >>= _n;
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_f3000000::unmarshalArguments(cdrStream& _n)
-{
-  arg_0 = _n.unmarshalOctet();
-  (GEARSystem::CORBATypes::Position&)arg_1_ <<= _n;
-  arg_1 = &arg_1_;
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_f3000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_04000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_f3000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_f3000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Sensor* impl = (GEARSystem::CORBAInterfaces::_impl_Sensor*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Sensor::_PD_repoId);
-  impl->setBallPosition(tcd->arg_0, *tcd->arg_1);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Sensor::setBallPosition(::CORBA::Octet ballNum, const ::GEARSystem::CORBATypes::Position& position)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_f3000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_04000000, "setBallPosition", 16);
-  _call_desc.arg_0 = ballNum;
-  _call_desc.arg_1 = &(::GEARSystem::CORBATypes::Position&) position;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Sensor::setBallVelocity
-
-// Proxy call descriptor class. Mangled signature:
-//  void_i_coctet_i_cGEARSystem_mCORBATypes_mVelocity
-class _0RL_cd_f9ba7d5cd2d6498c_14000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_14000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  void marshalArguments(cdrStream&);
-  void unmarshalArguments(cdrStream&);
-
-    
-  
-  static const char* const _user_exns[];
-
-  ::CORBA::Octet arg_0;
-  GEARSystem::CORBATypes::Velocity arg_1_;
-  const GEARSystem::CORBATypes::Velocity* arg_1;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_14000000::marshalArguments(cdrStream& _n)
-{
-  _n.marshalOctet(arg_0);
-  (const GEARSystem::CORBATypes::Velocity&) *arg_1 >>= _n;
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_14000000::unmarshalArguments(cdrStream& _n)
-{
-  arg_0 = _n.unmarshalOctet();
-  (GEARSystem::CORBATypes::Velocity&)arg_1_ <<= _n;
-  arg_1 = &arg_1_;
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_14000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_24000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_14000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_14000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Sensor* impl = (GEARSystem::CORBAInterfaces::_impl_Sensor*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Sensor::_PD_repoId);
-  impl->setBallVelocity(tcd->arg_0, *tcd->arg_1);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Sensor::setBallVelocity(::CORBA::Octet ballNum, const ::GEARSystem::CORBATypes::Velocity& velocity)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_14000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_24000000, "setBallVelocity", 16);
-  _call_desc.arg_0 = ballNum;
-  _call_desc.arg_1 = &(::GEARSystem::CORBATypes::Velocity&) velocity;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Sensor::addPlayer
-
-// Proxy call descriptor class. Mangled signature:
-//  void_i_coctet_i_coctet
-class _0RL_cd_f9ba7d5cd2d6498c_34000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_34000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  void marshalArguments(cdrStream&);
-  void unmarshalArguments(cdrStream&);
-
-    
-  
-  static const char* const _user_exns[];
-
-  ::CORBA::Octet arg_0;
-  ::CORBA::Octet arg_1;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_34000000::marshalArguments(cdrStream& _n)
-{
-  _n.marshalOctet(arg_0);
-  _n.marshalOctet(arg_1);
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_34000000::unmarshalArguments(cdrStream& _n)
-{
-  arg_0 = _n.unmarshalOctet();
-  arg_1 = _n.unmarshalOctet();
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_34000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_44000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_34000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_34000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Sensor* impl = (GEARSystem::CORBAInterfaces::_impl_Sensor*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Sensor::_PD_repoId);
-  impl->addPlayer(tcd->arg_0, tcd->arg_1);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Sensor::addPlayer(::CORBA::Octet teamNum, ::CORBA::Octet playerNum)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_34000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_44000000, "addPlayer", 10);
-  _call_desc.arg_0 = teamNum;
-  _call_desc.arg_1 = playerNum;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Sensor::delPlayer
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_54000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_34000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_34000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Sensor* impl = (GEARSystem::CORBAInterfaces::_impl_Sensor*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Sensor::_PD_repoId);
-  impl->delPlayer(tcd->arg_0, tcd->arg_1);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Sensor::delPlayer(::CORBA::Octet teamNum, ::CORBA::Octet playerNum)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_34000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_54000000, "delPlayer", 10);
-  _call_desc.arg_0 = teamNum;
-  _call_desc.arg_1 = playerNum;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Sensor::setPlayerPosition
-
-// Proxy call descriptor class. Mangled signature:
-//  void_i_coctet_i_coctet_i_cGEARSystem_mCORBATypes_mPosition
-class _0RL_cd_f9ba7d5cd2d6498c_64000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_64000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  void marshalArguments(cdrStream&);
-  void unmarshalArguments(cdrStream&);
-
-    
-  
-  static const char* const _user_exns[];
-
-  ::CORBA::Octet arg_0;
-  ::CORBA::Octet arg_1;
-  GEARSystem::CORBATypes::Position arg_2_;
-  const GEARSystem::CORBATypes::Position* arg_2;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_64000000::marshalArguments(cdrStream& _n)
-{
-  _n.marshalOctet(arg_0);
-  _n.marshalOctet(arg_1);
-  (const GEARSystem::CORBATypes::Position&) *arg_2 >>= _n;
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_64000000::unmarshalArguments(cdrStream& _n)
-{
-  arg_0 = _n.unmarshalOctet();
-  arg_1 = _n.unmarshalOctet();
-  (GEARSystem::CORBATypes::Position&)arg_2_ <<= _n;
-  arg_2 = &arg_2_;
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_64000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_74000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_64000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_64000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Sensor* impl = (GEARSystem::CORBAInterfaces::_impl_Sensor*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Sensor::_PD_repoId);
-  impl->setPlayerPosition(tcd->arg_0, tcd->arg_1, *tcd->arg_2);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Sensor::setPlayerPosition(::CORBA::Octet teamNum, ::CORBA::Octet playerNum, const ::GEARSystem::CORBATypes::Position& position)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_64000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_74000000, "setPlayerPosition", 18);
-  _call_desc.arg_0 = teamNum;
-  _call_desc.arg_1 = playerNum;
-  _call_desc.arg_2 = &(::GEARSystem::CORBATypes::Position&) position;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Sensor::setPlayerOrientation
-
-// Proxy call descriptor class. Mangled signature:
-//  void_i_coctet_i_coctet_i_cGEARSystem_mCORBATypes_mAngle
-class _0RL_cd_f9ba7d5cd2d6498c_84000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_84000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  void marshalArguments(cdrStream&);
-  void unmarshalArguments(cdrStream&);
-
-    
-  
-  static const char* const _user_exns[];
-
-  ::CORBA::Octet arg_0;
-  ::CORBA::Octet arg_1;
-  GEARSystem::CORBATypes::Angle arg_2_;
-  const GEARSystem::CORBATypes::Angle* arg_2;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_84000000::marshalArguments(cdrStream& _n)
-{
-  _n.marshalOctet(arg_0);
-  _n.marshalOctet(arg_1);
-  (const GEARSystem::CORBATypes::Angle&) *arg_2 >>= _n;
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_84000000::unmarshalArguments(cdrStream& _n)
-{
-  arg_0 = _n.unmarshalOctet();
-  arg_1 = _n.unmarshalOctet();
-  (GEARSystem::CORBATypes::Angle&)arg_2_ <<= _n;
-  arg_2 = &arg_2_;
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_84000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_94000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_84000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_84000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Sensor* impl = (GEARSystem::CORBAInterfaces::_impl_Sensor*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Sensor::_PD_repoId);
-  impl->setPlayerOrientation(tcd->arg_0, tcd->arg_1, *tcd->arg_2);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Sensor::setPlayerOrientation(::CORBA::Octet teamNum, ::CORBA::Octet playerNum, const ::GEARSystem::CORBATypes::Angle& orientation)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_84000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_94000000, "setPlayerOrientation", 21);
-  _call_desc.arg_0 = teamNum;
-  _call_desc.arg_1 = playerNum;
-  _call_desc.arg_2 = &(::GEARSystem::CORBATypes::Angle&) orientation;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Sensor::setPlayerVelocity
-
-// Proxy call descriptor class. Mangled signature:
-//  void_i_coctet_i_coctet_i_cGEARSystem_mCORBATypes_mVelocity
-class _0RL_cd_f9ba7d5cd2d6498c_a4000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_a4000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  void marshalArguments(cdrStream&);
-  void unmarshalArguments(cdrStream&);
-
-    
-  
-  static const char* const _user_exns[];
-
-  ::CORBA::Octet arg_0;
-  ::CORBA::Octet arg_1;
-  GEARSystem::CORBATypes::Velocity arg_2_;
-  const GEARSystem::CORBATypes::Velocity* arg_2;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_a4000000::marshalArguments(cdrStream& _n)
-{
-  _n.marshalOctet(arg_0);
-  _n.marshalOctet(arg_1);
-  (const GEARSystem::CORBATypes::Velocity&) *arg_2 >>= _n;
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_a4000000::unmarshalArguments(cdrStream& _n)
-{
-  arg_0 = _n.unmarshalOctet();
-  arg_1 = _n.unmarshalOctet();
-  (GEARSystem::CORBATypes::Velocity&)arg_2_ <<= _n;
-  arg_2 = &arg_2_;
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_a4000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_b4000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_a4000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_a4000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Sensor* impl = (GEARSystem::CORBAInterfaces::_impl_Sensor*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Sensor::_PD_repoId);
-  impl->setPlayerVelocity(tcd->arg_0, tcd->arg_1, *tcd->arg_2);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Sensor::setPlayerVelocity(::CORBA::Octet teamNum, ::CORBA::Octet playerNum, const ::GEARSystem::CORBATypes::Velocity& velocity)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_a4000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_b4000000, "setPlayerVelocity", 18);
-  _call_desc.arg_0 = teamNum;
-  _call_desc.arg_1 = playerNum;
-  _call_desc.arg_2 = &(::GEARSystem::CORBATypes::Velocity&) velocity;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Sensor::setPlayerAngularSpeed
-
-// Proxy call descriptor class. Mangled signature:
-//  void_i_coctet_i_coctet_i_cGEARSystem_mCORBATypes_mAngularSpeed
-class _0RL_cd_f9ba7d5cd2d6498c_c4000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_c4000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  void marshalArguments(cdrStream&);
-  void unmarshalArguments(cdrStream&);
-
-    
-  
-  static const char* const _user_exns[];
-
-  ::CORBA::Octet arg_0;
-  ::CORBA::Octet arg_1;
-  GEARSystem::CORBATypes::AngularSpeed arg_2_;
-  const GEARSystem::CORBATypes::AngularSpeed* arg_2;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_c4000000::marshalArguments(cdrStream& _n)
-{
-  _n.marshalOctet(arg_0);
-  _n.marshalOctet(arg_1);
-  (const GEARSystem::CORBATypes::AngularSpeed&) *arg_2 >>= _n;
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_c4000000::unmarshalArguments(cdrStream& _n)
-{
-  arg_0 = _n.unmarshalOctet();
-  arg_1 = _n.unmarshalOctet();
-  (GEARSystem::CORBATypes::AngularSpeed&)arg_2_ <<= _n;
-  arg_2 = &arg_2_;
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_c4000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_d4000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_c4000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_c4000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Sensor* impl = (GEARSystem::CORBAInterfaces::_impl_Sensor*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Sensor::_PD_repoId);
-  impl->setPlayerAngularSpeed(tcd->arg_0, tcd->arg_1, *tcd->arg_2);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Sensor::setPlayerAngularSpeed(::CORBA::Octet teamNum, ::CORBA::Octet playerNum, const ::GEARSystem::CORBATypes::AngularSpeed& angularSpeed)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_c4000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_d4000000, "setPlayerAngularSpeed", 22);
-  _call_desc.arg_0 = teamNum;
-  _call_desc.arg_1 = playerNum;
-  _call_desc.arg_2 = &(::GEARSystem::CORBATypes::AngularSpeed&) angularSpeed;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Sensor::setBallPossession
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_e4000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_80000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_80000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Sensor* impl = (GEARSystem::CORBAInterfaces::_impl_Sensor*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Sensor::_PD_repoId);
-  impl->setBallPossession(tcd->arg_0, tcd->arg_1, tcd->arg_2);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Sensor::setBallPossession(::CORBA::Octet teamNum, ::CORBA::Octet playerNum, ::CORBA::Boolean possession)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_80000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_e4000000, "setBallPossession", 18);
-  _call_desc.arg_0 = teamNum;
-  _call_desc.arg_1 = playerNum;
-  _call_desc.arg_2 = possession;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Sensor::setFieldTopRightCorner
-
-// Proxy call descriptor class. Mangled signature:
-//  void_i_cGEARSystem_mCORBATypes_mPosition
-class _0RL_cd_f9ba7d5cd2d6498c_f4000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_f4000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  void marshalArguments(cdrStream&);
-  void unmarshalArguments(cdrStream&);
-
-    
-  
-  static const char* const _user_exns[];
-
-  GEARSystem::CORBATypes::Position arg_0_;
-  const GEARSystem::CORBATypes::Position* arg_0;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_f4000000::marshalArguments(cdrStream& _n)
-{
-  (const GEARSystem::CORBATypes::Position&) *arg_0 >>= _n;
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_f4000000::unmarshalArguments(cdrStream& _n)
-{
-  (GEARSystem::CORBATypes::Position&)arg_0_ <<= _n;
-  arg_0 = &arg_0_;
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_f4000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_05000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_f4000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_f4000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Sensor* impl = (GEARSystem::CORBAInterfaces::_impl_Sensor*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Sensor::_PD_repoId);
-  impl->setFieldTopRightCorner(*tcd->arg_0);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Sensor::setFieldTopRightCorner(const ::GEARSystem::CORBATypes::Position& position)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_f4000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_05000000, "setFieldTopRightCorner", 23);
-  _call_desc.arg_0 = &(::GEARSystem::CORBATypes::Position&) position;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Sensor::setFieldTopLeftCorner
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_15000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_f4000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_f4000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Sensor* impl = (GEARSystem::CORBAInterfaces::_impl_Sensor*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Sensor::_PD_repoId);
-  impl->setFieldTopLeftCorner(*tcd->arg_0);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Sensor::setFieldTopLeftCorner(const ::GEARSystem::CORBATypes::Position& position)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_f4000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_15000000, "setFieldTopLeftCorner", 22);
-  _call_desc.arg_0 = &(::GEARSystem::CORBATypes::Position&) position;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Sensor::setFieldBottomLeftCorner
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_25000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_f4000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_f4000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Sensor* impl = (GEARSystem::CORBAInterfaces::_impl_Sensor*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Sensor::_PD_repoId);
-  impl->setFieldBottomLeftCorner(*tcd->arg_0);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Sensor::setFieldBottomLeftCorner(const ::GEARSystem::CORBATypes::Position& position)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_f4000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_25000000, "setFieldBottomLeftCorner", 25);
-  _call_desc.arg_0 = &(::GEARSystem::CORBATypes::Position&) position;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Sensor::setFieldBottomRightCorner
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_35000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_f4000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_f4000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Sensor* impl = (GEARSystem::CORBAInterfaces::_impl_Sensor*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Sensor::_PD_repoId);
-  impl->setFieldBottomRightCorner(*tcd->arg_0);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Sensor::setFieldBottomRightCorner(const ::GEARSystem::CORBATypes::Position& position)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_f4000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_35000000, "setFieldBottomRightCorner", 26);
-  _call_desc.arg_0 = &(::GEARSystem::CORBATypes::Position&) position;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Sensor::setFieldCenter
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_45000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_f4000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_f4000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Sensor* impl = (GEARSystem::CORBAInterfaces::_impl_Sensor*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Sensor::_PD_repoId);
-  impl->setFieldCenter(*tcd->arg_0);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Sensor::setFieldCenter(const ::GEARSystem::CORBATypes::Position& position)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_f4000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_45000000, "setFieldCenter", 15);
-  _call_desc.arg_0 = &(::GEARSystem::CORBATypes::Position&) position;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Sensor::setLeftGoalPosts
-
-// Proxy call descriptor class. Mangled signature:
-//  void_i_cGEARSystem_mCORBATypes_mPosition_i_cGEARSystem_mCORBATypes_mPosition
-class _0RL_cd_f9ba7d5cd2d6498c_55000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_55000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  void marshalArguments(cdrStream&);
-  void unmarshalArguments(cdrStream&);
-
-    
-  
-  static const char* const _user_exns[];
-
-  GEARSystem::CORBATypes::Position arg_0_;
-  const GEARSystem::CORBATypes::Position* arg_0;
-  GEARSystem::CORBATypes::Position arg_1_;
-  const GEARSystem::CORBATypes::Position* arg_1;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_55000000::marshalArguments(cdrStream& _n)
-{
-  (const GEARSystem::CORBATypes::Position&) *arg_0 >>= _n;
-  (const GEARSystem::CORBATypes::Position&) *arg_1 >>= _n;
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_55000000::unmarshalArguments(cdrStream& _n)
-{
-  (GEARSystem::CORBATypes::Position&)arg_0_ <<= _n;
-  arg_0 = &arg_0_;
-  (GEARSystem::CORBATypes::Position&)arg_1_ <<= _n;
-  arg_1 = &arg_1_;
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_55000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_65000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_55000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_55000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Sensor* impl = (GEARSystem::CORBAInterfaces::_impl_Sensor*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Sensor::_PD_repoId);
-  impl->setLeftGoalPosts(*tcd->arg_0, *tcd->arg_1);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Sensor::setLeftGoalPosts(const ::GEARSystem::CORBATypes::Position& left, const ::GEARSystem::CORBATypes::Position& right)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_55000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_65000000, "setLeftGoalPosts", 17);
-  _call_desc.arg_0 = &(::GEARSystem::CORBATypes::Position&) left;
-  _call_desc.arg_1 = &(::GEARSystem::CORBATypes::Position&) right;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Sensor::setRightGoalPosts
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_75000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_55000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_55000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Sensor* impl = (GEARSystem::CORBAInterfaces::_impl_Sensor*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Sensor::_PD_repoId);
-  impl->setRightGoalPosts(*tcd->arg_0, *tcd->arg_1);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Sensor::setRightGoalPosts(const ::GEARSystem::CORBATypes::Position& left, const ::GEARSystem::CORBATypes::Position& right)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_55000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_75000000, "setRightGoalPosts", 18);
-  _call_desc.arg_0 = &(::GEARSystem::CORBATypes::Position&) left;
-  _call_desc.arg_1 = &(::GEARSystem::CORBATypes::Position&) right;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Sensor::setGoalArea
-
-// Proxy call descriptor class. Mangled signature:
-//  void_i_cfloat_i_cfloat_i_cfloat
-class _0RL_cd_f9ba7d5cd2d6498c_85000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_85000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  void marshalArguments(cdrStream&);
-  void unmarshalArguments(cdrStream&);
-
-    
-  
-  static const char* const _user_exns[];
-
-  ::CORBA::Float arg_0;
-  ::CORBA::Float arg_1;
-  ::CORBA::Float arg_2;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_85000000::marshalArguments(cdrStream& _n)
-{
-  arg_0 >>= _n;
-  arg_1 >>= _n;
-  arg_2 >>= _n;
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_85000000::unmarshalArguments(cdrStream& _n)
-{
-  (::CORBA::Float&)arg_0 <<= _n;
-  (::CORBA::Float&)arg_1 <<= _n;
-  (::CORBA::Float&)arg_2 <<= _n;
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_85000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_95000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_85000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_85000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Sensor* impl = (GEARSystem::CORBAInterfaces::_impl_Sensor*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Sensor::_PD_repoId);
-  impl->setGoalArea(tcd->arg_0, tcd->arg_1, tcd->arg_2);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Sensor::setGoalArea(::CORBA::Float length, ::CORBA::Float width, ::CORBA::Float roundedRadius)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_85000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_95000000, "setGoalArea", 12);
-  _call_desc.arg_0 = length;
-  _call_desc.arg_1 = width;
-  _call_desc.arg_2 = roundedRadius;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Sensor::setGoalDepth
-
-// Proxy call descriptor class. Mangled signature:
-//  void_i_cfloat
-class _0RL_cd_f9ba7d5cd2d6498c_a5000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_a5000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  void marshalArguments(cdrStream&);
-  void unmarshalArguments(cdrStream&);
-
-    
-  
-  static const char* const _user_exns[];
-
-  ::CORBA::Float arg_0;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_a5000000::marshalArguments(cdrStream& _n)
-{
-  arg_0 >>= _n;
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_a5000000::unmarshalArguments(cdrStream& _n)
-{
-  (::CORBA::Float&)arg_0 <<= _n;
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_a5000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_b5000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_a5000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_a5000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Sensor* impl = (GEARSystem::CORBAInterfaces::_impl_Sensor*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Sensor::_PD_repoId);
-  impl->setGoalDepth(tcd->arg_0);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Sensor::setGoalDepth(::CORBA::Float depth)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_a5000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_b5000000, "setGoalDepth", 13);
-  _call_desc.arg_0 = depth;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Sensor::setLeftPenaltyMark
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_c5000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_f4000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_f4000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Sensor* impl = (GEARSystem::CORBAInterfaces::_impl_Sensor*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Sensor::_PD_repoId);
-  impl->setLeftPenaltyMark(*tcd->arg_0);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Sensor::setLeftPenaltyMark(const ::GEARSystem::CORBATypes::Position& position)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_f4000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_c5000000, "setLeftPenaltyMark", 19);
-  _call_desc.arg_0 = &(::GEARSystem::CORBATypes::Position&) position;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Sensor::setRightPenaltyMark
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_d5000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_f4000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_f4000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Sensor* impl = (GEARSystem::CORBAInterfaces::_impl_Sensor*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Sensor::_PD_repoId);
-  impl->setRightPenaltyMark(*tcd->arg_0);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Sensor::setRightPenaltyMark(const ::GEARSystem::CORBATypes::Position& position)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_f4000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_d5000000, "setRightPenaltyMark", 20);
-  _call_desc.arg_0 = &(::GEARSystem::CORBATypes::Position&) position;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::Sensor::setFieldCenterRadius
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_e5000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_a5000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_a5000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_Sensor* impl = (GEARSystem::CORBAInterfaces::_impl_Sensor*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::Sensor::_PD_repoId);
-  impl->setFieldCenterRadius(tcd->arg_0);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_Sensor::setFieldCenterRadius(::CORBA::Float centerRadius)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_a5000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_e5000000, "setFieldCenterRadius", 21);
-  _call_desc.arg_0 = centerRadius;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-GEARSystem::CORBAInterfaces::_pof_Sensor::~_pof_Sensor() {}
-
-
-omniObjRef*
-GEARSystem::CORBAInterfaces::_pof_Sensor::newObjRef(omniIOR* ior, omniIdentity* id)
-{
-  return new ::GEARSystem::CORBAInterfaces::_objref_Sensor(ior, id);
-}
-
-
-::CORBA::Boolean
-GEARSystem::CORBAInterfaces::_pof_Sensor::is_a(const char* id) const
-{
-  if (omni::ptrStrMatch(id, ::GEARSystem::CORBAInterfaces::Sensor::_PD_repoId))
-    return 1;
-  
-  return 0;
-}
-
-const GEARSystem::CORBAInterfaces::_pof_Sensor _the_pof_GEARSystem_mCORBAInterfaces_mSensor;
-
-GEARSystem::CORBAInterfaces::_impl_Sensor::~_impl_Sensor() {}
-
-
-::CORBA::Boolean
-GEARSystem::CORBAInterfaces::_impl_Sensor::_dispatch(omniCallHandle& _handle)
-{
-  const char* op = _handle.operation_name();
-
-  if (omni::strMatch(op, "addTeam")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_93000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_a3000000, "addTeam", 8, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "delGEARSystemTeam")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_b3000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_c3000000, "delGEARSystemTeam", 18, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "addBall")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_b3000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_d3000000, "addBall", 8, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "delBall")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_b3000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_e3000000, "delBall", 8, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "setBallPosition")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_f3000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_04000000, "setBallPosition", 16, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "setBallVelocity")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_14000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_24000000, "setBallVelocity", 16, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "addPlayer")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_34000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_44000000, "addPlayer", 10, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "delPlayer")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_34000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_54000000, "delPlayer", 10, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "setPlayerPosition")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_64000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_74000000, "setPlayerPosition", 18, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "setPlayerOrientation")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_84000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_94000000, "setPlayerOrientation", 21, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "setPlayerVelocity")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_a4000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_b4000000, "setPlayerVelocity", 18, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "setPlayerAngularSpeed")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_c4000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_d4000000, "setPlayerAngularSpeed", 22, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "setBallPossession")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_80000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_e4000000, "setBallPossession", 18, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "setFieldTopRightCorner")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_f4000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_05000000, "setFieldTopRightCorner", 23, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "setFieldTopLeftCorner")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_f4000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_15000000, "setFieldTopLeftCorner", 22, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "setFieldBottomLeftCorner")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_f4000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_25000000, "setFieldBottomLeftCorner", 25, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "setFieldBottomRightCorner")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_f4000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_35000000, "setFieldBottomRightCorner", 26, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "setFieldCenter")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_f4000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_45000000, "setFieldCenter", 15, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "setLeftGoalPosts")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_55000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_65000000, "setLeftGoalPosts", 17, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "setRightGoalPosts")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_55000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_75000000, "setRightGoalPosts", 18, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "setGoalArea")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_85000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_95000000, "setGoalArea", 12, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "setGoalDepth")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_a5000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_b5000000, "setGoalDepth", 13, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "setLeftPenaltyMark")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_f4000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_c5000000, "setLeftPenaltyMark", 19, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "setRightPenaltyMark")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_f4000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_d5000000, "setRightPenaltyMark", 20, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "setFieldCenterRadius")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_a5000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_e5000000, "setFieldCenterRadius", 21, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-
-  return 0;
-}
-
-void*
-GEARSystem::CORBAInterfaces::_impl_Sensor::_ptrToInterface(const char* id)
-{
-  if (id == ::GEARSystem::CORBAInterfaces::Sensor::_PD_repoId)
-    return (::GEARSystem::CORBAInterfaces::_impl_Sensor*) this;
-  
-  if (id == ::CORBA::Object::_PD_repoId)
-    return (void*) 1;
-
-  if (omni::strMatch(id, ::GEARSystem::CORBAInterfaces::Sensor::_PD_repoId))
-    return (::GEARSystem::CORBAInterfaces::_impl_Sensor*) this;
-  
-  if (omni::strMatch(id, ::CORBA::Object::_PD_repoId))
-    return (void*) 1;
-  return 0;
-}
-
-const char*
-GEARSystem::CORBAInterfaces::_impl_Sensor::_mostDerivedRepoId()
-{
-  return ::GEARSystem::CORBAInterfaces::Sensor::_PD_repoId;
-}
-
-GEARSystem::CORBAInterfaces::RadioSensor_ptr GEARSystem::CORBAInterfaces::RadioSensor_Helper::_nil() {
-  return ::GEARSystem::CORBAInterfaces::RadioSensor::_nil();
-}
-
-::CORBA::Boolean GEARSystem::CORBAInterfaces::RadioSensor_Helper::is_nil(::GEARSystem::CORBAInterfaces::RadioSensor_ptr p) {
-  return ::CORBA::is_nil(p);
-
-}
-
-void GEARSystem::CORBAInterfaces::RadioSensor_Helper::release(::GEARSystem::CORBAInterfaces::RadioSensor_ptr p) {
-  ::CORBA::release(p);
-}
-
-void GEARSystem::CORBAInterfaces::RadioSensor_Helper::marshalObjRef(::GEARSystem::CORBAInterfaces::RadioSensor_ptr obj, cdrStream& s) {
-  ::GEARSystem::CORBAInterfaces::RadioSensor::_marshalObjRef(obj, s);
-}
-
-GEARSystem::CORBAInterfaces::RadioSensor_ptr GEARSystem::CORBAInterfaces::RadioSensor_Helper::unmarshalObjRef(cdrStream& s) {
-  return ::GEARSystem::CORBAInterfaces::RadioSensor::_unmarshalObjRef(s);
-}
-
-void GEARSystem::CORBAInterfaces::RadioSensor_Helper::duplicate(::GEARSystem::CORBAInterfaces::RadioSensor_ptr obj) {
-  if (obj && !obj->_NP_is_nil())  omni::duplicateObjRef(obj);
-}
-
-GEARSystem::CORBAInterfaces::RadioSensor_ptr
-GEARSystem::CORBAInterfaces::RadioSensor::_duplicate(::GEARSystem::CORBAInterfaces::RadioSensor_ptr obj)
-{
-  if (obj && !obj->_NP_is_nil())  omni::duplicateObjRef(obj);
-  return obj;
-}
-
-GEARSystem::CORBAInterfaces::RadioSensor_ptr
-GEARSystem::CORBAInterfaces::RadioSensor::_narrow(::CORBA::Object_ptr obj)
-{
-  if (!obj || obj->_NP_is_nil() || obj->_NP_is_pseudo()) return _nil();
-  _ptr_type e = (_ptr_type) obj->_PR_getobj()->_realNarrow(_PD_repoId);
-  return e ? e : _nil();
-}
-
-
-GEARSystem::CORBAInterfaces::RadioSensor_ptr
-GEARSystem::CORBAInterfaces::RadioSensor::_unchecked_narrow(::CORBA::Object_ptr obj)
-{
-  if (!obj || obj->_NP_is_nil() || obj->_NP_is_pseudo()) return _nil();
-  _ptr_type e = (_ptr_type) obj->_PR_getobj()->_uncheckedNarrow(_PD_repoId);
-  return e ? e : _nil();
-}
-
-GEARSystem::CORBAInterfaces::RadioSensor_ptr
-GEARSystem::CORBAInterfaces::RadioSensor::_nil()
-{
-#ifdef OMNI_UNLOADABLE_STUBS
-  static _objref_RadioSensor _the_nil_obj;
-  return &_the_nil_obj;
-#else
-  static _objref_RadioSensor* _the_nil_ptr = 0;
-  if (!_the_nil_ptr) {
-    omni::nilRefLock().lock();
-    if (!_the_nil_ptr) {
-      _the_nil_ptr = new _objref_RadioSensor;
-      registerNilCorbaObject(_the_nil_ptr);
-    }
-    omni::nilRefLock().unlock();
-  }
-  return _the_nil_ptr;
-#endif
-}
-
-const char* GEARSystem::CORBAInterfaces::RadioSensor::_PD_repoId = "IDL:GEARSystem/CORBAInterfaces/RadioSensor:1.0";
-
-
-GEARSystem::CORBAInterfaces::_objref_RadioSensor::~_objref_RadioSensor() {
-  
-}
-
-
-GEARSystem::CORBAInterfaces::_objref_RadioSensor::_objref_RadioSensor(omniIOR* ior, omniIdentity* id) :
-   omniObjRef(::GEARSystem::CORBAInterfaces::RadioSensor::_PD_repoId, ior, id, 1)
-   
-   
-{
-  _PR_setobj(this);
-}
-
-void*
-GEARSystem::CORBAInterfaces::_objref_RadioSensor::_ptrToObjRef(const char* id)
-{
-  if (id == ::GEARSystem::CORBAInterfaces::RadioSensor::_PD_repoId)
-    return (::GEARSystem::CORBAInterfaces::RadioSensor_ptr) this;
-  
-  if (id == ::CORBA::Object::_PD_repoId)
-    return (::CORBA::Object_ptr) this;
-
-  if (omni::strMatch(id, ::GEARSystem::CORBAInterfaces::RadioSensor::_PD_repoId))
-    return (::GEARSystem::CORBAInterfaces::RadioSensor_ptr) this;
-  
-  if (omni::strMatch(id, ::CORBA::Object::_PD_repoId))
-    return (::CORBA::Object_ptr) this;
-
-  return 0;
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::RadioSensor::setPlayerBatteryCharge
-
-// Proxy call descriptor class. Mangled signature:
-//  void_i_coctet_i_coctet_i_cchar
-class _0RL_cd_f9ba7d5cd2d6498c_f5000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_f5000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  void marshalArguments(cdrStream&);
-  void unmarshalArguments(cdrStream&);
-
-    
-  
-  static const char* const _user_exns[];
-
-  ::CORBA::Octet arg_0;
-  ::CORBA::Octet arg_1;
-  ::CORBA::Char arg_2;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_f5000000::marshalArguments(cdrStream& _n)
-{
-  _n.marshalOctet(arg_0);
-  _n.marshalOctet(arg_1);
-  _n.marshalChar(arg_2);
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_f5000000::unmarshalArguments(cdrStream& _n)
-{
-  arg_0 = _n.unmarshalOctet();
-  arg_1 = _n.unmarshalOctet();
-  arg_2 = _n.unmarshalChar();
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_f5000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_06000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_f5000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_f5000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_RadioSensor* impl = (GEARSystem::CORBAInterfaces::_impl_RadioSensor*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::RadioSensor::_PD_repoId);
-  impl->setPlayerBatteryCharge(tcd->arg_0, tcd->arg_1, tcd->arg_2);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_RadioSensor::setPlayerBatteryCharge(::CORBA::Octet teamNum, ::CORBA::Octet playerNum, ::CORBA::Char charge)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_f5000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_06000000, "setPlayerBatteryCharge", 23);
-  _call_desc.arg_0 = teamNum;
-  _call_desc.arg_1 = playerNum;
-  _call_desc.arg_2 = charge;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::RadioSensor::setPlayerCapacitorCharge
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_16000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_f5000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_f5000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_RadioSensor* impl = (GEARSystem::CORBAInterfaces::_impl_RadioSensor*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::RadioSensor::_PD_repoId);
-  impl->setPlayerCapacitorCharge(tcd->arg_0, tcd->arg_1, tcd->arg_2);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_RadioSensor::setPlayerCapacitorCharge(::CORBA::Octet teamNum, ::CORBA::Octet playerNum, ::CORBA::Char charge)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_f5000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_16000000, "setPlayerCapacitorCharge", 25);
-  _call_desc.arg_0 = teamNum;
-  _call_desc.arg_1 = playerNum;
-  _call_desc.arg_2 = charge;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::RadioSensor::setPlayerDribbleStatus
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_26000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_80000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_80000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_RadioSensor* impl = (GEARSystem::CORBAInterfaces::_impl_RadioSensor*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::RadioSensor::_PD_repoId);
-  impl->setPlayerDribbleStatus(tcd->arg_0, tcd->arg_1, tcd->arg_2);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_RadioSensor::setPlayerDribbleStatus(::CORBA::Octet teamNum, ::CORBA::Octet playerNum, ::CORBA::Boolean status)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_80000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_26000000, "setPlayerDribbleStatus", 23);
-  _call_desc.arg_0 = teamNum;
-  _call_desc.arg_1 = playerNum;
-  _call_desc.arg_2 = status;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::RadioSensor::setPlayerKickStatus
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_36000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_80000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_80000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_RadioSensor* impl = (GEARSystem::CORBAInterfaces::_impl_RadioSensor*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::RadioSensor::_PD_repoId);
-  impl->setPlayerKickStatus(tcd->arg_0, tcd->arg_1, tcd->arg_2);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_RadioSensor::setPlayerKickStatus(::CORBA::Octet teamNum, ::CORBA::Octet playerNum, ::CORBA::Boolean status)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_80000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_36000000, "setPlayerKickStatus", 20);
-  _call_desc.arg_0 = teamNum;
-  _call_desc.arg_1 = playerNum;
-  _call_desc.arg_2 = status;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-GEARSystem::CORBAInterfaces::_pof_RadioSensor::~_pof_RadioSensor() {}
-
-
-omniObjRef*
-GEARSystem::CORBAInterfaces::_pof_RadioSensor::newObjRef(omniIOR* ior, omniIdentity* id)
-{
-  return new ::GEARSystem::CORBAInterfaces::_objref_RadioSensor(ior, id);
-}
-
-
-::CORBA::Boolean
-GEARSystem::CORBAInterfaces::_pof_RadioSensor::is_a(const char* id) const
-{
-  if (omni::ptrStrMatch(id, ::GEARSystem::CORBAInterfaces::RadioSensor::_PD_repoId))
-    return 1;
-  
-  return 0;
-}
-
-const GEARSystem::CORBAInterfaces::_pof_RadioSensor _the_pof_GEARSystem_mCORBAInterfaces_mRadioSensor;
-
-GEARSystem::CORBAInterfaces::_impl_RadioSensor::~_impl_RadioSensor() {}
-
-
-::CORBA::Boolean
-GEARSystem::CORBAInterfaces::_impl_RadioSensor::_dispatch(omniCallHandle& _handle)
-{
-  const char* op = _handle.operation_name();
-
-  if (omni::strMatch(op, "setPlayerBatteryCharge")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_f5000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_06000000, "setPlayerBatteryCharge", 23, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "setPlayerCapacitorCharge")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_f5000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_16000000, "setPlayerCapacitorCharge", 25, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "setPlayerDribbleStatus")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_80000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_26000000, "setPlayerDribbleStatus", 23, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "setPlayerKickStatus")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_80000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_36000000, "setPlayerKickStatus", 20, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-
-  return 0;
-}
-
-void*
-GEARSystem::CORBAInterfaces::_impl_RadioSensor::_ptrToInterface(const char* id)
-{
-  if (id == ::GEARSystem::CORBAInterfaces::RadioSensor::_PD_repoId)
-    return (::GEARSystem::CORBAInterfaces::_impl_RadioSensor*) this;
-  
-  if (id == ::CORBA::Object::_PD_repoId)
-    return (void*) 1;
-
-  if (omni::strMatch(id, ::GEARSystem::CORBAInterfaces::RadioSensor::_PD_repoId))
-    return (::GEARSystem::CORBAInterfaces::_impl_RadioSensor*) this;
-  
-  if (omni::strMatch(id, ::CORBA::Object::_PD_repoId))
-    return (void*) 1;
-  return 0;
-}
-
-const char*
-GEARSystem::CORBAInterfaces::_impl_RadioSensor::_mostDerivedRepoId()
-{
-  return ::GEARSystem::CORBAInterfaces::RadioSensor::_PD_repoId;
-}
-
-GEARSystem::CORBAInterfaces::CommandBus_ptr GEARSystem::CORBAInterfaces::CommandBus_Helper::_nil() {
-  return ::GEARSystem::CORBAInterfaces::CommandBus::_nil();
-}
-
-::CORBA::Boolean GEARSystem::CORBAInterfaces::CommandBus_Helper::is_nil(::GEARSystem::CORBAInterfaces::CommandBus_ptr p) {
-  return ::CORBA::is_nil(p);
-
-}
-
-void GEARSystem::CORBAInterfaces::CommandBus_Helper::release(::GEARSystem::CORBAInterfaces::CommandBus_ptr p) {
-  ::CORBA::release(p);
-}
-
-void GEARSystem::CORBAInterfaces::CommandBus_Helper::marshalObjRef(::GEARSystem::CORBAInterfaces::CommandBus_ptr obj, cdrStream& s) {
-  ::GEARSystem::CORBAInterfaces::CommandBus::_marshalObjRef(obj, s);
-}
-
-GEARSystem::CORBAInterfaces::CommandBus_ptr GEARSystem::CORBAInterfaces::CommandBus_Helper::unmarshalObjRef(cdrStream& s) {
-  return ::GEARSystem::CORBAInterfaces::CommandBus::_unmarshalObjRef(s);
-}
-
-void GEARSystem::CORBAInterfaces::CommandBus_Helper::duplicate(::GEARSystem::CORBAInterfaces::CommandBus_ptr obj) {
-  if (obj && !obj->_NP_is_nil())  omni::duplicateObjRef(obj);
-}
-
-GEARSystem::CORBAInterfaces::CommandBus_ptr
-GEARSystem::CORBAInterfaces::CommandBus::_duplicate(::GEARSystem::CORBAInterfaces::CommandBus_ptr obj)
-{
-  if (obj && !obj->_NP_is_nil())  omni::duplicateObjRef(obj);
-  return obj;
-}
-
-GEARSystem::CORBAInterfaces::CommandBus_ptr
-GEARSystem::CORBAInterfaces::CommandBus::_narrow(::CORBA::Object_ptr obj)
-{
-  if (!obj || obj->_NP_is_nil() || obj->_NP_is_pseudo()) return _nil();
-  _ptr_type e = (_ptr_type) obj->_PR_getobj()->_realNarrow(_PD_repoId);
-  return e ? e : _nil();
-}
-
-
-GEARSystem::CORBAInterfaces::CommandBus_ptr
-GEARSystem::CORBAInterfaces::CommandBus::_unchecked_narrow(::CORBA::Object_ptr obj)
-{
-  if (!obj || obj->_NP_is_nil() || obj->_NP_is_pseudo()) return _nil();
-  _ptr_type e = (_ptr_type) obj->_PR_getobj()->_uncheckedNarrow(_PD_repoId);
-  return e ? e : _nil();
-}
-
-GEARSystem::CORBAInterfaces::CommandBus_ptr
-GEARSystem::CORBAInterfaces::CommandBus::_nil()
-{
-#ifdef OMNI_UNLOADABLE_STUBS
-  static _objref_CommandBus _the_nil_obj;
-  return &_the_nil_obj;
-#else
-  static _objref_CommandBus* _the_nil_ptr = 0;
-  if (!_the_nil_ptr) {
-    omni::nilRefLock().lock();
-    if (!_the_nil_ptr) {
-      _the_nil_ptr = new _objref_CommandBus;
-      registerNilCorbaObject(_the_nil_ptr);
-    }
-    omni::nilRefLock().unlock();
-  }
-  return _the_nil_ptr;
-#endif
-}
-
-const char* GEARSystem::CORBAInterfaces::CommandBus::_PD_repoId = "IDL:GEARSystem/CORBAInterfaces/CommandBus:1.0";
-
-
-GEARSystem::CORBAInterfaces::_objref_CommandBus::~_objref_CommandBus() {
-  
-}
-
-
-GEARSystem::CORBAInterfaces::_objref_CommandBus::_objref_CommandBus(omniIOR* ior, omniIdentity* id) :
-   omniObjRef(::GEARSystem::CORBAInterfaces::CommandBus::_PD_repoId, ior, id, 1)
-   
-   
-{
-  _PR_setobj(this);
-}
-
-void*
-GEARSystem::CORBAInterfaces::_objref_CommandBus::_ptrToObjRef(const char* id)
-{
-  if (id == ::GEARSystem::CORBAInterfaces::CommandBus::_PD_repoId)
-    return (::GEARSystem::CORBAInterfaces::CommandBus_ptr) this;
-  
-  if (id == ::CORBA::Object::_PD_repoId)
-    return (::CORBA::Object_ptr) this;
-
-  if (omni::strMatch(id, ::GEARSystem::CORBAInterfaces::CommandBus::_PD_repoId))
-    return (::GEARSystem::CORBAInterfaces::CommandBus_ptr) this;
-  
-  if (omni::strMatch(id, ::CORBA::Object::_PD_repoId))
-    return (::CORBA::Object_ptr) this;
-
-  return 0;
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::CommandBus::addActuator
-
-// Proxy call descriptor class. Mangled signature:
-//  void_i_cstring_i_cstring
-class _0RL_cd_f9ba7d5cd2d6498c_46000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_46000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  void marshalArguments(cdrStream&);
-  void unmarshalArguments(cdrStream&);
-
-    
-  
-  static const char* const _user_exns[];
-
-  ::CORBA::String_var arg_0_;
-  const char* arg_0;
-  ::CORBA::String_var arg_1_;
-  const char* arg_1;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_46000000::marshalArguments(cdrStream& _n)
-{
-  _n.marshalString(arg_0,0);
-  _n.marshalString(arg_1,0);
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_46000000::unmarshalArguments(cdrStream& _n)
-{
-  arg_0_ = _n.unmarshalString(0);
-  arg_0 = arg_0_.in();
-  arg_1_ = _n.unmarshalString(0);
-  arg_1 = arg_1_.in();
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_46000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_56000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_46000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_46000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_CommandBus* impl = (GEARSystem::CORBAInterfaces::_impl_CommandBus*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::CommandBus::_PD_repoId);
-  impl->addActuator(tcd->arg_0, tcd->arg_1);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_CommandBus::addActuator(const char* name, const char* address)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_46000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_56000000, "addActuator", 12);
-  _call_desc.arg_0 = name;
-  _call_desc.arg_1 = address;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-
-//
-// Code for GEARSystem::CORBAInterfaces::CommandBus::delActuator
-
-// Proxy call descriptor class. Mangled signature:
-//  void_i_cstring
-class _0RL_cd_f9ba7d5cd2d6498c_66000000
-  : public omniCallDescriptor
-{
-public:
-  inline _0RL_cd_f9ba7d5cd2d6498c_66000000(LocalCallFn lcfn, const char* op_, size_t oplen, _CORBA_Boolean upcall=0)
-    : omniCallDescriptor(lcfn, op_, oplen, 0, _user_exns, 0, upcall)
-  {
-    
-  }
-  
-  void marshalArguments(cdrStream&);
-  void unmarshalArguments(cdrStream&);
-
-    
-  
-  static const char* const _user_exns[];
-
-  ::CORBA::String_var arg_0_;
-  const char* arg_0;
-};
-
-void _0RL_cd_f9ba7d5cd2d6498c_66000000::marshalArguments(cdrStream& _n)
-{
-  _n.marshalString(arg_0,0);
-
-}
-
-void _0RL_cd_f9ba7d5cd2d6498c_66000000::unmarshalArguments(cdrStream& _n)
-{
-  arg_0_ = _n.unmarshalString(0);
-  arg_0 = arg_0_.in();
-
-}
-
-const char* const _0RL_cd_f9ba7d5cd2d6498c_66000000::_user_exns[] = {
-  0
-};
-
-// Local call call-back function.
-static void
-_0RL_lcfn_f9ba7d5cd2d6498c_76000000(omniCallDescriptor* cd, omniServant* svnt)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_66000000* tcd = (_0RL_cd_f9ba7d5cd2d6498c_66000000*)cd;
-  GEARSystem::CORBAInterfaces::_impl_CommandBus* impl = (GEARSystem::CORBAInterfaces::_impl_CommandBus*) svnt->_ptrToInterface(GEARSystem::CORBAInterfaces::CommandBus::_PD_repoId);
-  impl->delActuator(tcd->arg_0);
-
-
-}
-
-void GEARSystem::CORBAInterfaces::_objref_CommandBus::delActuator(const char* name)
-{
-  _0RL_cd_f9ba7d5cd2d6498c_66000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_76000000, "delActuator", 12);
-  _call_desc.arg_0 = name;
-
-  _invoke(_call_desc);
-
-
-
-}
-
-GEARSystem::CORBAInterfaces::_pof_CommandBus::~_pof_CommandBus() {}
-
-
-omniObjRef*
-GEARSystem::CORBAInterfaces::_pof_CommandBus::newObjRef(omniIOR* ior, omniIdentity* id)
-{
-  return new ::GEARSystem::CORBAInterfaces::_objref_CommandBus(ior, id);
-}
-
-
-::CORBA::Boolean
-GEARSystem::CORBAInterfaces::_pof_CommandBus::is_a(const char* id) const
-{
-  if (omni::ptrStrMatch(id, ::GEARSystem::CORBAInterfaces::CommandBus::_PD_repoId))
-    return 1;
-  
-  return 0;
-}
-
-const GEARSystem::CORBAInterfaces::_pof_CommandBus _the_pof_GEARSystem_mCORBAInterfaces_mCommandBus;
-
-GEARSystem::CORBAInterfaces::_impl_CommandBus::~_impl_CommandBus() {}
-
-
-::CORBA::Boolean
-GEARSystem::CORBAInterfaces::_impl_CommandBus::_dispatch(omniCallHandle& _handle)
-{
-  const char* op = _handle.operation_name();
-
-  if (omni::strMatch(op, "addActuator")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_46000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_56000000, "addActuator", 12, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-  if (omni::strMatch(op, "delActuator")) {
-
-    _0RL_cd_f9ba7d5cd2d6498c_66000000 _call_desc(_0RL_lcfn_f9ba7d5cd2d6498c_76000000, "delActuator", 12, 1);
-    
-    _handle.upcall(this,_call_desc);
-    return 1;
-  }
-
-
-  return 0;
-}
-
-void*
-GEARSystem::CORBAInterfaces::_impl_CommandBus::_ptrToInterface(const char* id)
-{
-  if (id == ::GEARSystem::CORBAInterfaces::CommandBus::_PD_repoId)
-    return (::GEARSystem::CORBAInterfaces::_impl_CommandBus*) this;
-  
-  if (id == ::CORBA::Object::_PD_repoId)
-    return (void*) 1;
-
-  if (omni::strMatch(id, ::GEARSystem::CORBAInterfaces::CommandBus::_PD_repoId))
-    return (::GEARSystem::CORBAInterfaces::_impl_CommandBus*) this;
-  
-  if (omni::strMatch(id, ::CORBA::Object::_PD_repoId))
-    return (void*) 1;
-  return 0;
-}
-
-const char*
-GEARSystem::CORBAInterfaces::_impl_CommandBus::_mostDerivedRepoId()
-{
-  return ::GEARSystem::CORBAInterfaces::CommandBus::_PD_repoId;
-}
-
-POA_GEARSystem::CORBAInterfaces::Actuator::~Actuator() {}
-
-POA_GEARSystem::CORBAInterfaces::Controller::~Controller() {}
-
-POA_GEARSystem::CORBAInterfaces::Sensor::~Sensor() {}
-
-POA_GEARSystem::CORBAInterfaces::RadioSensor::~RadioSensor() {}
-
-POA_GEARSystem::CORBAInterfaces::CommandBus::~CommandBus() {}
-
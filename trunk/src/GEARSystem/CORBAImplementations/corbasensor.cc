@@ -17,17 +17,71 @@
 // Selects namespace
 using namespace GEARSystem;
 using CORBA::Boolean;
+using CORBA::Double;
 using CORBA::Float;
 using CORBA::Octet;
+using CORBA::ULong;
 
 
-/*** Constructor
+/*** Constructors
   ** Description: Creates the sensor
-  ** Receives:    [worldMap] The world map the sensor will control
+  ** Receives:    [worldMap]       The world map the sensor will control
+                  [ingestCapacity] The queue capacity of the ingest stage, or 0 for none
   ***/
 CORBAImplementations::Sensor::Sensor(WorldMap* worldMap) {
     // Sets the world map
     _worldMap = worldMap;
+    _ingest   = NULL;
+}
+
+CORBAImplementations::Sensor::Sensor(WorldMap* worldMap, int ingestCapacity) {
+    // Sets the world map
+    _worldMap = worldMap;
+    _ingest   = (ingestCapacity > 0)? new WorldIngest(worldMap, ingestCapacity) : NULL;
+}
+
+/*** Destructor
+  ** Description: Applies the queued changes and destroys the sensor
+  ** Receives:    Nothing
+  ***/
+CORBAImplementations::Sensor::~Sensor() {
+    delete _ingest;
+}
+
+
+/*** 'ingest' function
+  ** Description: Gets the ingest stage, to read its metrics
+  ** Receives:    Nothing
+  ** Returns:     The ingest stage, or NULL if there is none
+  ***/
+WorldIngest* CORBAImplementations::Sensor::ingest() const {
+    return(_ingest);
+}
+
+
+/*** 'toUpdates' function
+  ** Description: Converts the samples of a frame into world updates
+  ** Receives:    [players] The pose and velocities of each player seen
+                  [balls]   The position and velocity of each ball seen
+  ** Returns:     The updates
+  ***/
+QList<WorldUpdate> CORBAImplementations::Sensor::toUpdates(const CORBATypes::PlayerSampleSeq& players, const CORBATypes::BallSampleSeq& balls) {
+    QList<WorldUpdate> updates;
+    updates.reserve(4*players.length() + 2*balls.length());
+    for (ULong i = 0; i < players.length(); i++) {
+        const CORBATypes::PlayerSample& player = players[i];
+        updates.append(WorldUpdate(player.teamNum, player.playerNum, Position(player.position)));
+        updates.append(WorldUpdate(player.teamNum, player.playerNum, Angle(player.orientation)));
+        updates.append(WorldUpdate(player.teamNum, player.playerNum, Velocity(player.velocity)));
+        updates.append(WorldUpdate(player.teamNum, player.playerNum, AngularSpeed(player.angularSpeed)));
+    }
+    for (ULong i = 0; i < balls.length(); i++) {
+        const CORBATypes::BallSample& ball = balls[i];
+        updates.append(WorldUpdate(ball.ballNum, Position(ball.position)));
+        updates.append(WorldUpdate(ball.ballNum, Velocity(ball.velocity)));
+    }
+
+    return(updates);
 }
 
 
@@ -38,10 +92,20 @@ CORBAImplementations::Sensor::Sensor(WorldMap* worldMap) {
   ** Returns:     Nothing
   ***/
 void CORBAImplementations::Sensor::addTeam(Octet teamNum, const char* teamName) {
+    // Applies the queued changes first
+    if (_ingest != NULL) {
+        _ingest->flush();
+    }
+
     // Adds the team
     _worldMap->addTeam(teamNum, QString(teamName));
 }
 void CORBAImplementations::Sensor::delGEARSystemTeam(Octet teamNum) {
+    // Applies the queued changes first
+    if (_ingest != NULL) {
+        _ingest->flush();
+    }
+
     // Deletes the team
     _worldMap->delGEARSystemTeam(teamNum);
 }
@@ -53,11 +117,21 @@ void CORBAImplementations::Sensor::delGEARSystemTeam(Octet teamNum) {
   ** Returns:     Nothing
   ***/
 void CORBAImplementations::Sensor::addBall(Octet ballNum) {
+    // Applies the queued changes first
+    if (_ingest != NULL) {
+        _ingest->flush();
+    }
+
     // Adds the ball
     _worldMap->addBall(ballNum);
 }
 
 void CORBAImplementations::Sensor::delBall(Octet ballNum) {
+    // Applies the queued changes first
+    if (_ingest != NULL) {
+        _ingest->flush();
+    }
+
     // Deletes the ball
     _worldMap->delBall(ballNum);
 }
@@ -70,7 +144,12 @@ void CORBAImplementations::Sensor::delBall(Octet ballNum) {
   ***/
 void CORBAImplementations::Sensor::setBallPosition(Octet ballNum, const CORBATypes::Position& position) {
     // Sets the position
-    _worldMap->setBallPosition(ballNum, Position(position));
+    if (_ingest != NULL) {
+        _ingest->push(WorldUpdate(ballNum, Position(position)));
+    }
+    else {
+        _worldMap->setBallPosition(ballNum, Position(position));
+    }
 }
 
 /*** 'setBallVelocity' function
@@ -81,7 +160,12 @@ void CORBAImplementations::Sensor::setBallPosition(Octet ballNum, const CORBATyp
   ***/
 void CORBAImplementations::Sensor::setBallVelocity(Octet ballNum, const CORBATypes::Velocity& velocity) {
     // Sets the velocity
-    _worldMap->setBallVelocity(ballNum, Velocity(velocity));
+    if (_ingest != NULL) {
+        _ingest->push(WorldUpdate(ballNum, Velocity(velocity)));
+    }
+    else {
+        _worldMap->setBallVelocity(ballNum, Velocity(velocity));
+    }
 }
 
 
@@ -92,10 +176,20 @@ void CORBAImplementations::Sensor::setBallVelocity(Octet ballNum, const CORBATyp
   ** Returns:     Nothing
   ***/
 void CORBAImplementations::Sensor::addPlayer(Octet teamNum, Octet playerNum) {
+    // Applies the queued changes first
+    if (_ingest != NULL) {
+        _ingest->flush();
+    }
+
     // Adds the player
     _worldMap->addPlayer(teamNum, playerNum);
 }
 void CORBAImplementations::Sensor::delPlayer(Octet teamNum, Octet playerNum) {
+    // Applies the queued changes first
+    if (_ingest != NULL) {
+        _ingest->flush();
+    }
+
     // Deletes the player
     _worldMap->delPlayer(teamNum, playerNum);
 }
@@ -109,7 +203,12 @@ void CORBAImplementations::Sensor::delPlayer(Octet teamNum, Octet playerNum) {
   ***/
 void CORBAImplementations::Sensor::setPlayerPosition(Octet teamNum, Octet playerNum, const CORBATypes::Position& position) {
     // Sets the position
-    _worldMap->setPlayerPosition(teamNum, playerNum, Position(position));
+    if (_ingest != NULL) {
+        _ingest->push(WorldUpdate(teamNum, playerNum, Position(position)));
+    }
+    else {
+        _worldMap->setPlayerPosition(teamNum, playerNum, Position(position));
+    }
 }
 
 /*** 'setPlayerOrientation' function
@@ -121,7 +220,12 @@ void CORBAImplementations::Sensor::setPlayerPosition(Octet teamNum, Octet player
   ***/
 void CORBAImplementations::Sensor::setPlayerOrientation(Octet teamNum, Octet playerNum, const CORBATypes::Angle& orientation) {
     // Sets the orientation
-    _worldMap->setPlayerOrientation(teamNum, playerNum, Angle(orientation));
+    if (_ingest != NULL) {
+        _ingest->push(WorldUpdate(teamNum, playerNum, Angle(orientation)));
+    }
+    else {
+        _worldMap->setPlayerOrientation(teamNum, playerNum, Angle(orientation));
+    }
 }
 
 /*** 'setPlayerVelocity' function
@@ -133,7 +237,12 @@ void CORBAImplementations::Sensor::setPlayerOrientation(Octet teamNum, Octet pla
   ***/
 void CORBAImplementations::Sensor::setPlayerVelocity(Octet teamNum, Octet playerNum, const CORBATypes::Velocity& velocity) {
     // Sets the velocity
-    _worldMap->setPlayerVelocity(teamNum, playerNum, Velocity(velocity));
+    if (_ingest != NULL) {
+        _ingest->push(WorldUpdate(teamNum, playerNum, Velocity(velocity)));
+    }
+    else {
+        _worldMap->setPlayerVelocity(teamNum, playerNum, Velocity(velocity));
+    }
 }
 
 /*** 'setPlayerAngularSpeed' function
@@ -145,7 +254,12 @@ void CORBAImplementations::Sensor::setPlayerVelocity(Octet teamNum, Octet player
   ***/
 void CORBAImplementations::Sensor::setPlayerAngularSpeed(Octet teamNum, Octet playerNum, const CORBATypes::AngularSpeed& angularSpeed) {
     // Sets the angular speed
-    _worldMap->setPlayerAngularSpeed(teamNum, playerNum, AngularSpeed(angularSpeed));
+    if (_ingest != NULL) {
+        _ingest->push(WorldUpdate(teamNum, playerNum, AngularSpeed(angularSpeed)));
+    }
+    else {
+        _worldMap->setPlayerAngularSpeed(teamNum, playerNum, AngularSpeed(angularSpeed));
+    }
 }
 
 
@@ -158,7 +272,76 @@ void CORBAImplementations::Sensor::setPlayerAngularSpeed(Octet teamNum, Octet pl
   ***/
 void CORBAImplementations::Sensor::setBallPossession(Octet teamNum, Octet playerNum, bool possession) {
     // Sets the flag
-    _worldMap->setBallPossession(teamNum, playerNum, possession);
+    if (_ingest != NULL) {
+        _ingest->push(WorldUpdate(WorldUpdate::BallPossession, teamNum, playerNum, possession));
+    }
+    else {
+        _worldMap->setBallPossession(teamNum, playerNum, possession);
+    }
+}
+
+
+/*** Frames handling functions
+  ** Description: Groups the changes of a vision frame, applied at once on commit
+  ** Receives:    [frameId]     The frame number
+                  [captureTime] The frame capture time, in seconds
+                  [players]     The pose and velocities of players seen
+                  [balls]       The position and velocity of balls seen
+  ** Returns:     Nothing
+  ***/
+void CORBAImplementations::Sensor::beginFrame(ULong frameId, Double captureTime) {
+    // Opens the frame
+    if (_ingest != NULL) {
+        _ingest->beginFrame(frameId, captureTime);
+    }
+    else {
+        _worldMap->beginFrame(frameId, captureTime);
+    }
+}
+
+void CORBAImplementations::Sensor::stageSamples(ULong frameId, const CORBATypes::PlayerSampleSeq& players, const CORBATypes::BallSampleSeq& balls) {
+    // Converts the samples
+    const QList<WorldUpdate> updates = toUpdates(players, balls);
+
+    // Stages them in the frame
+    if (_ingest != NULL) {
+        for (int i = 0; i < updates.size(); i++) {
+            _ingest->push(frameId, updates.at(i));
+        }
+    }
+    else {
+        _worldMap->stageUpdates(frameId, updates);
+    }
+}
+
+void CORBAImplementations::Sensor::commitFrame(ULong frameId) {
+    // Applies the frame
+    if (_ingest != NULL) {
+        _ingest->commitFrame(frameId);
+    }
+    else {
+        _worldMap->commitFrame(frameId);
+    }
+}
+
+/*** 'pushFrame' function
+  ** Description: Applies a whole vision frame received in a single call
+  ** Receives:    [players]   The pose and velocities of each player seen
+                  [balls]     The position and velocity of each ball seen
+                  [frameInfo] The frame number and capture time
+  ** Returns:     Nothing
+  ***/
+void CORBAImplementations::Sensor::pushFrame(const CORBATypes::PlayerSampleSeq& players, const CORBATypes::BallSampleSeq& balls, const CORBATypes::FrameInfo& frameInfo) {
+    // Converts the samples
+    const QList<WorldUpdate> updates = toUpdates(players, balls);
+
+    // Applies the frame
+    if (_ingest != NULL) {
+        _ingest->pushFrame(frameInfo.frameId, frameInfo.captureTime, updates);
+    }
+    else {
+        _worldMap->applyFrame(frameInfo.frameId, frameInfo.captureTime, updates);
+    }
 }
 
 
@@ -224,3 +407,13 @@ void CORBAImplementations::Sensor::setFieldCenterRadius(float centerRadius) {
     // Sets the center radius
     _worldMap->setFieldCenterRadius(centerRadius);
 }
+
+/*** 'setFieldGeometry' function
+  ** Description: Replaces every field element at once
+  ** Receives:    [geometry] The field geometry (its version is ignored)
+  ** Returns:     Nothing
+  ***/
+void CORBAImplementations::Sensor::setFieldGeometry(const CORBATypes::FieldGeometry& geometry) {
+    // Sets the field
+    _worldMap->setFieldGeometry(Field(geometry));
+}
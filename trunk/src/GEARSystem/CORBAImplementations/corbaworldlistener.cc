@@ -0,0 +1,40 @@
+/*** GEARSystem - CORBA WorldListener implementation
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Includes the class header
+#include <GEARSystem/CORBAImplementations/corbaworldlistener.hh>
+
+
+// Includes GEARSystem
+#include <GEARSystem/controller.hh>
+#include <GEARSystem/worldsnapshot.hh>
+
+
+// Selects namespace
+using namespace GEARSystem;
+
+
+/*** Constructor
+  ** Description: Creates the listener
+  ** Receives:    [controller] The GEARSystem::Controller that receives the frames
+  ***/
+CORBAImplementations::WorldListener::WorldListener(GEARSystem::Controller* controller) {
+    // Sets the controller
+    _controller = controller;
+}
+
+
+/*** 'frameCommitted' function
+  ** Description: Receives a committed frame
+  ** Receives:    [state] The world state of the frame
+  ** Returns:     Nothing
+  ***/
+void CORBAImplementations::WorldListener::frameCommitted(const CORBATypes::WorldState& state) {
+    // Hands the frame to the controller
+    _controller->frameReceived(WorldSnapshotPtr(new WorldSnapshot(state)));
+}
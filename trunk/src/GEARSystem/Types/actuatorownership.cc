@@ -0,0 +1,139 @@
+/*** GEARSystem - ActuatorOwnership implementation
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Includes the class header
+#include <GEARSystem/Types/actuatorownership.hh>
+
+
+// Selects namespace
+using namespace GEARSystem;
+
+
+/*** Constructor
+  ** Description: Creates an empty ownership, which owns every player
+  ** Receives:    Nothing
+  ***/
+ActuatorOwnership::ActuatorOwnership() {
+    clear();
+}
+
+/*** Constructor
+  ** Description: Creates an ownership from a CORBA TeamOwnershipSeq
+  ** Receives:    [ownership] The CORBA TeamOwnershipSeq
+  ***/
+ActuatorOwnership::ActuatorOwnership(const CORBATypes::TeamOwnershipSeq& ownership) {
+    clear();
+
+    // Copies the teams
+    for (CORBA::ULong i = 0; i < ownership.length(); i++) {
+        const CORBATypes::TeamOwnership& team = ownership[i];
+
+        // Whole team
+        if (team.allPlayers) {
+            addTeam(team.teamNum);
+        }
+
+        // Single players
+        else {
+            IdBitmap players(team.players);
+            if (!players.isEmpty()) {
+                _players[team.teamNum] = players;
+            }
+        }
+    }
+}
+
+
+/*** 'toCORBA' function
+  ** Description: Copies the ownership to a CORBA TeamOwnershipSeq
+  ** Receives:    [other] The CORBA TeamOwnershipSeq
+  ** Returns:     Nothing
+  ***/
+void ActuatorOwnership::toCORBA(CORBATypes::TeamOwnershipSeq* other) const {
+    const QList<quint8> teams = _teams.toList();
+    other->length(teams.size() + _players.size());
+
+    // Copies the whole teams
+    CORBA::ULong index = 0;
+    for (int i = 0; i < teams.size(); i++, index++) {
+        (*other)[index].teamNum    = teams.at(i);
+        (*other)[index].allPlayers = true;
+        IdBitmap().toCORBA((*other)[index].players);
+    }
+
+    // Copies the single players
+    QHashIterator<quint8,IdBitmap> it(_players);
+    while (it.hasNext()) {
+        it.next();
+        (*other)[index].teamNum    = it.key();
+        (*other)[index].allPlayers = false;
+        it.value().toCORBA((*other)[index].players);
+        index++;
+    }
+}
+
+
+/*** Ownership handling functions
+  ** Description: Adds a whole team or a single player to the ownership
+  ** Receives:    [teamNum]   The team number
+                  [playerNum] The player number
+  ** Returns:     Nothing
+  ***/
+void ActuatorOwnership::addTeam(quint8 teamNum) {
+    // The whole team supersedes its single players
+    (void) _teams.set(teamNum);
+    (void) _players.remove(teamNum);
+}
+
+void ActuatorOwnership::addPlayer(quint8 teamNum, quint8 playerNum) {
+    if (!_teams.test(teamNum)) {
+        (void) _players[teamNum].set(playerNum);
+    }
+}
+
+
+/*** 'clear' function
+  ** Description: Empties the ownership, so it owns every player again
+  ** Receives:    Nothing
+  ** Returns:     Nothing
+  ***/
+void ActuatorOwnership::clear() {
+    _teams.reset();
+    _players.clear();
+}
+
+/*** 'isEmpty' function
+  ** Description: Verifies if no team or player was declared
+  ** Receives:    Nothing
+  ** Returns:     'true' if the ownership is empty (owns every player), 'false' otherwise
+  ***/
+bool ActuatorOwnership::isEmpty() const {
+    return(_teams.isEmpty() && _players.isEmpty());
+}
+
+/*** 'owns' function
+  ** Description: Verifies if a player is owned
+  ** Receives:    [teamNum]   The team number
+                  [playerNum] The player number
+  ** Returns:     'true' if the player is owned, 'false' otherwise
+  ***/
+bool ActuatorOwnership::owns(quint8 teamNum, quint8 playerNum) const {
+    // Empty ownership
+    if (isEmpty()) {
+        return(true);
+    }
+
+    // Whole team
+    if (_teams.test(teamNum)) {
+        return(true);
+    }
+
+    // Single player
+    QHash<quint8,IdBitmap>::const_iterator it = _players.constFind(teamNum);
+    return((it != _players.constEnd()) && it->test(playerNum));
+}
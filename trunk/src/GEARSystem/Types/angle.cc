@@ -77,6 +77,10 @@ float Angle::difference(const Angle& a, const Angle& b) {
   ** Receives:    Nothing
   ***/
 Angle::Angle() {
+    // Isn't produced by a frame
+    _frameId     = 0;
+    _captureTime = 0.0;
+
     setInvalid();
 }
 
@@ -88,6 +92,10 @@ Angle::Angle() {
                   [theValue] The angle value
   ***/
 Angle::Angle(bool known, float theValue) {
+    // Isn't produced by a frame
+    _frameId     = 0;
+    _captureTime = 0.0;
+
     (known == true) ? setValue(theValue) : setUnknown();
 }
 
@@ -111,6 +119,10 @@ Angle::Angle(const CORBATypes::Angle& angle) {
     else {
         setValue(angle.value);
     }
+
+    // Sets the capture info
+    _frameId     = angle.frameId;
+    _captureTime = angle.captureTime;
 }
 
 
@@ -136,6 +148,10 @@ Angle& Angle::operator =(const Angle& other) {
         setInvalid();
     }
 
+    // Copies the capture info
+    _frameId     = other._frameId;
+    _captureTime = other._captureTime;
+
     // Returns this angle
     return(*this);
 }
@@ -177,6 +193,10 @@ void Angle::toCORBA(CORBATypes::Angle* other) const {
         other->isUnknown = false;
         other->value     = value();
     }
+
+    // Sets the capture info
+    other->frameId     = _frameId;
+    other->captureTime = _captureTime;
 }
 
 
@@ -203,3 +223,12 @@ void Angle::setUnknown() {
     _unknown = true;
     _valid   = true;
 }
+
+
+// Capture info functions
+quint32 Angle::frameId()     const { return(_frameId);     }
+double  Angle::captureTime() const { return(_captureTime); }
+void    Angle::setCapture(quint32 frameId, double captureTime) {
+    _frameId     = frameId;
+    _captureTime = captureTime;
+}
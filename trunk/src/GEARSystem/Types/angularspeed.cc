@@ -19,6 +19,10 @@ using namespace GEARSystem;
   ** Receives:    Nothing
   ***/
 AngularSpeed::AngularSpeed() {
+    // Isn't produced by a frame
+    _frameId     = 0;
+    _captureTime = 0.0;
+
     setInvalid();
 }
 
@@ -30,6 +34,10 @@ AngularSpeed::AngularSpeed() {
                   [theValue] The speed value
   ***/
 AngularSpeed::AngularSpeed(bool known, float theValue) {
+    // Isn't produced by a frame
+    _frameId     = 0;
+    _captureTime = 0.0;
+
     (known == true) ? setValue(theValue) : setUnknown();
 }
 
@@ -53,6 +61,10 @@ AngularSpeed::AngularSpeed(const CORBATypes::AngularSpeed& angularSpeed) {
     else {
         setValue(angularSpeed.value);
     }
+
+    // Sets the capture info
+    _frameId     = angularSpeed.frameId;
+    _captureTime = angularSpeed.captureTime;
 }
 
 
@@ -79,6 +91,10 @@ void AngularSpeed::toCORBA(CORBATypes::AngularSpeed* other) const {
         other->isUnknown = false;
         other->value     = value();
     }
+
+    // Sets the capture info
+    other->frameId     = _frameId;
+    other->captureTime = _captureTime;
 }
 
 
@@ -104,6 +120,10 @@ AngularSpeed& AngularSpeed::operator =(const AngularSpeed& other) {
         setInvalid();
     }
 
+    // Copies the capture info
+    _frameId     = other._frameId;
+    _captureTime = other._captureTime;
+
     // Returns this speed
     return(*this);
 }
@@ -142,3 +162,12 @@ void AngularSpeed::setUnknown() {
     _unknown = true;
     _valid   = true;
 }
+
+
+// Capture info functions
+quint32 AngularSpeed::frameId()     const { return(_frameId);     }
+double  AngularSpeed::captureTime() const { return(_captureTime); }
+void    AngularSpeed::setCapture(quint32 frameId, double captureTime) {
+    _frameId     = frameId;
+    _captureTime = captureTime;
+}
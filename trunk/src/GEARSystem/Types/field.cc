@@ -23,28 +23,126 @@ using namespace GEARSystem;
   ** Receives:    Nothing
   ***/
 Field::Field() {
-    // Creates the locks
-    #ifdef GSTHREADSAFE
-    _goalsLock   = new QReadWriteLock();
-    _cornersLock = new QReadWriteLock();
-    _penaltyLock = new QReadWriteLock();
-    #endif
-
     // Initialize center radius
     _centerRadius = 0.0f;
 }
 
+/*** Constructor
+  ** Description: Creates a field from a CORBA FieldGeometry
+  ** Receives:    [geometry] The CORBA FieldGeometry
+  ***/
+Field::Field(const CORBATypes::FieldGeometry& geometry) {
+    // Sets the corners
+    _topRightCorner    = Position(geometry.topRightCorner);
+    _topLeftCorner     = Position(geometry.topLeftCorner);
+    _bottomLeftCorner  = Position(geometry.bottomLeftCorner);
+    _bottomRightCorner = Position(geometry.bottomRightCorner);
+    _center            = Position(geometry.center);
+
+    // Sets the goals
+    _leftGoal  = Goal(geometry.leftGoal);
+    _rightGoal = Goal(geometry.rightGoal);
+
+    // Sets the penalty marks
+    _leftPenaltyMark  = Position(geometry.leftPenaltyMark);
+    _rightPenaltyMark = Position(geometry.rightPenaltyMark);
+
+    // Set center radius
+    _centerRadius = geometry.centerRadius;
+}
+
+/*** Copy constructor
+  ** Description: Creates a consistent copy of a field
+  ** Receives:    [other] The field
+  ***/
+Field::Field(const Field& other) {
+    // Handles the locks of the copied field
+    ReadLocker cornersLocker(other._cornersLock);
+    ReadLocker goalsLocker(other._goalsLock);
+    ReadLocker penaltyLocker(other._penaltyLock);
+
+    // Copies it
+    _leftGoal          = other._leftGoal;
+    _rightGoal         = other._rightGoal;
+    _topRightCorner    = other._topRightCorner;
+    _topLeftCorner     = other._topLeftCorner;
+    _bottomLeftCorner  = other._bottomLeftCorner;
+    _bottomRightCorner = other._bottomRightCorner;
+    _center            = other._center;
+    _leftPenaltyMark   = other._leftPenaltyMark;
+    _rightPenaltyMark  = other._rightPenaltyMark;
+    _centerRadius      = other._centerRadius;
+}
+
 /*** Destructor
   ** Description: Destroys the field
   ** Receives:    Nothing
   ***/
 Field::~Field() {
-    // Destroys the locks
-    #ifdef GSTHREADSAFE
-    delete(_goalsLock);
-    delete(_cornersLock);
-    delete(_penaltyLock);
-    #endif
+}
+
+
+/*** Assignment operator
+  ** Description: Replaces every field element at once
+  ** Receives:    [other] The field
+  ** Returns:     This field
+  ***/
+Field& Field::operator =(const Field& other) {
+    if (this == &other) {
+        return(*this);
+    }
+
+    // Copies the other field first, so the locks of both fields are never held together
+    const Field copy(other);
+
+    // Handles the locks
+    WriteLocker cornersLocker(_cornersLock);
+    WriteLocker goalsLocker(_goalsLock);
+    WriteLocker penaltyLocker(_penaltyLock);
+
+    // Replaces the elements
+    _leftGoal          = copy._leftGoal;
+    _rightGoal         = copy._rightGoal;
+    _topRightCorner    = copy._topRightCorner;
+    _topLeftCorner     = copy._topLeftCorner;
+    _bottomLeftCorner  = copy._bottomLeftCorner;
+    _bottomRightCorner = copy._bottomRightCorner;
+    _center            = copy._center;
+    _leftPenaltyMark   = copy._leftPenaltyMark;
+    _rightPenaltyMark  = copy._rightPenaltyMark;
+    _centerRadius      = copy._centerRadius;
+
+    return(*this);
+}
+
+/*** 'toCORBA' function
+  ** Description: Copies the field to a CORBA FieldGeometry
+  ** Receives:    [other] The CORBA FieldGeometry
+  ** Returns:     Nothing
+  ***/
+void Field::toCORBA(CORBATypes::FieldGeometry* other) const {
+    // Handles the locks
+    ReadLocker cornersLocker(_cornersLock);
+    ReadLocker goalsLocker(_goalsLock);
+    ReadLocker penaltyLocker(_penaltyLock);
+
+    // Copies the corners
+    _topRightCorner.toCORBA(&other->topRightCorner);
+    _topLeftCorner.toCORBA(&other->topLeftCorner);
+    _bottomLeftCorner.toCORBA(&other->bottomLeftCorner);
+    _bottomRightCorner.toCORBA(&other->bottomRightCorner);
+    _center.toCORBA(&other->center);
+
+    // Copies the goals
+    _leftGoal.toCORBA(&other->leftGoal);
+    _rightGoal.toCORBA(&other->rightGoal);
+
+    // Copies the penalty marks
+    _leftPenaltyMark.toCORBA(&other->leftPenaltyMark);
+    _rightPenaltyMark.toCORBA(&other->rightPenaltyMark);
+
+    // Copies the center radius
+    other->centerRadius = _centerRadius;
 }
 
 
@@ -53,10 +151,7 @@ Field::~Field() {
   ***/
 void Field::setTopRightCorner(const Position& position) {
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    //QWriteLocker cornersLocker(_cornersLock);
-    // TODO: Fix fault at this point
-    #endif
+    WriteLocker cornersLocker(_cornersLock);
 
     // Sets the position
     _topRightCorner = position;
@@ -64,10 +159,7 @@ void Field::setTopRightCorner(const Position& position) {
 
 void Field::setTopLeftCorner(const Position& position) {
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    //QWriteLocker cornersLocker(_cornersLock);
-    // TODO: Fix fault at this point
-    #endif
+    WriteLocker cornersLocker(_cornersLock);
 
     // Sets the position
     _topLeftCorner = position;
@@ -75,10 +167,7 @@ void Field::setTopLeftCorner(const Position& position) {
 
 void Field::setBottomLeftCorner(const Position& position) {
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    //QWriteLocker cornersLocker(_cornersLock);
-    // TODO: Fix fault at this point
-    #endif
+    WriteLocker cornersLocker(_cornersLock);
 
     // Sets the position
     _bottomLeftCorner = position;
@@ -86,10 +175,7 @@ void Field::setBottomLeftCorner(const Position& position) {
 
 void Field::setBottomRightCorner(const Position& position) {
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    //QWriteLocker cornersLocker(_cornersLock);
-    // TODO: Fix fault at this point
-    #endif
+    WriteLocker cornersLocker(_cornersLock);
 
     // Sets the position
     _bottomRightCorner = position;
@@ -97,10 +183,7 @@ void Field::setBottomRightCorner(const Position& position) {
 
 void Field::setCenter(const Position& position) {
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    //QWriteLocker cornersLocker(_cornersLock);
-    // TODO: Fix fault at this point
-    #endif
+    WriteLocker cornersLocker(_cornersLock);
 
     // Sets the position
     _center = position;
@@ -108,10 +191,7 @@ void Field::setCenter(const Position& position) {
 
 void Field::setLeftGoalPosts(const Position& leftPost, const Position& rightPost) {
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    //QWriteLocker goalsLocker(_goalsLock);
-    // TODO: Fix fault at this point
-    #endif
+    WriteLocker goalsLocker(_goalsLock);
 
     // Sets the posts positions
     _leftGoal.setLeftPost(leftPost);
@@ -120,10 +200,7 @@ void Field::setLeftGoalPosts(const Position& leftPost, const Position& rightPost
 
 void Field::setRightGoalPosts(const Position& leftPost, const Position& rightPost) {
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    //QWriteLocker goalsLocker(_goalsLock);
-    // TODO: Fix fault at this point
-    #endif
+    WriteLocker goalsLocker(_goalsLock);
 
     // Sets the posts positions
     _rightGoal.setLeftPost(leftPost);
@@ -132,10 +209,7 @@ void Field::setRightGoalPosts(const Position& leftPost, const Position& rightPos
 
 void Field::setGoalArea(float length, float width, float roundedRadius) {
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    //QWriteLocker goalsLocker(_goalsLock);
-    // TODO: Fix fault at this point
-    #endif
+    WriteLocker goalsLocker(_goalsLock);
 
     // Set the goal area
     _rightGoal.setAreaLength(length);
@@ -148,10 +222,7 @@ void Field::setGoalArea(float length, float width, float roundedRadius) {
 
 void Field::setGoalDepth(float depth) {
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    //QWriteLocker goalsLocker(_goalsLock);
-    // TODO: Fix fault at this point
-    #endif
+    WriteLocker goalsLocker(_goalsLock);
 
     _rightGoal.setDepth(depth);
     _leftGoal.setDepth(depth);
@@ -159,10 +230,7 @@ void Field::setGoalDepth(float depth) {
 
 void Field::setLeftPenaltyMark(const Position& position) {
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    //QWriteLocker penaltyLocker(_penaltyLock);
-    // TODO: Fix fault at this point
-    #endif
+    WriteLocker penaltyLocker(_penaltyLock);
 
     // Sets the position
     _leftPenaltyMark = position;
@@ -170,26 +238,23 @@ void Field::setLeftPenaltyMark(const Position& position) {
 
 void Field::setRightPenaltyMark(const Position& position) {
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    //QWriteLocker penaltyLocker(_penaltyLock);
-    // TODO: Fix fault at this point
-    #endif
+    WriteLocker penaltyLocker(_penaltyLock);
 
     // Sets the position
     _rightPenaltyMark = position;
 }
 
 void Field::setCenterRadius(float centerRadius) {
+    // Handles the lock
+    WriteLocker cornersLocker(_cornersLock);
+
     // Set center radius
     _centerRadius = centerRadius;
 }
 
 const Position& Field::topRightCorner()  const {
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    //QReadLocker cornersLocker(_cornersLock);
-    // TODO: Fix fault at this point
-    #endif
+    ReadLocker cornersLocker(_cornersLock);
 
     // Returns the position
     return(_topRightCorner);
@@ -197,10 +262,7 @@ const Position& Field::topRightCorner()  const {
 
 const Position& Field::topLeftCorner()   const {
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    //QReadLocker cornersLocker(_cornersLock);
-    // TODO: Fix fault at this point
-    #endif
+    ReadLocker cornersLocker(_cornersLock);
 
     // Returns the position
     return(_topLeftCorner);
@@ -208,10 +270,7 @@ const Position& Field::topLeftCorner()   const {
 
 const Position& Field::bottomLeftCorner()  const {
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    //QReadLocker cornersLocker(_cornersLock);
-    // TODO: Fix fault at this point
-    #endif
+    ReadLocker cornersLocker(_cornersLock);
 
     // Returns the position
     return(_bottomLeftCorner);
@@ -219,20 +278,14 @@ const Position& Field::bottomLeftCorner()  const {
 
 const Position& Field::bottomRightCorner() const {
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    //QReadLocker cornersLocker(_cornersLock);
-    // TODO: Fix fault at this point
-    #endif
+    ReadLocker cornersLocker(_cornersLock);
 
     // Returns the position
     return(_bottomRightCorner);
 }
 const Position& Field::center()            const {
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    //QReadLocker cornersLocker(_cornersLock);
-    // TODO: Fix fault at this point
-    #endif
+    ReadLocker cornersLocker(_cornersLock);
 
     // Returns the position
     return(_center);
@@ -240,20 +293,14 @@ const Position& Field::center()            const {
 
 const Goal& Field::leftGoal()  const {
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    //QReadLocker goalsLocker(_goalsLock);
-    // TODO: Fix fault at this point
-    #endif
+    ReadLocker goalsLocker(_goalsLock);
 
     // Returns the goal
     return(_leftGoal);
 }
 const Goal& Field::rightGoal() const {
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    //QReadLocker goalsLocker(_goalsLock);
-    // TODO: Fix fault at this point
-    #endif
+    ReadLocker goalsLocker(_goalsLock);
 
     // Returns the goal
     return(_rightGoal);
@@ -261,26 +308,23 @@ const Goal& Field::rightGoal() const {
 
 const Position& Field::leftPenaltyMark()  const {
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    //QReadLocker penaltyLocker(_penaltyLock);
-    // TODO: Fix fault at this point
-    #endif
+    ReadLocker penaltyLocker(_penaltyLock);
 
     // Returns the position
     return(_leftPenaltyMark);
 }
 const Position& Field::rightPenaltyMark() const {
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    //QReadLocker penaltyLocker(_penaltyLock);
-    // TODO: Fix fault at this point
-    #endif
+    ReadLocker penaltyLocker(_penaltyLock);
 
     // Returns the position
     return(_rightPenaltyMark);
 }
 
 float Field::centerRadius() const {
+    // Handles the lock
+    ReadLocker cornersLocker(_cornersLock);
+
     // Returns the center radius
     return(_centerRadius);
 }
@@ -61,6 +61,42 @@ Goal::Goal(const Position& left, const Position& right, float depth, float areaL
     _areaRoundedRadius = areaRoundedRadius;
 }
 
+/*** Constructor
+  ** Description: Creates a goal from a CORBA GoalGeometry
+  ** Receives:    [goal] The CORBA GoalGeometry
+  ***/
+Goal::Goal(const CORBATypes::GoalGeometry& goal) {
+    // Sets the positions
+    setLeftPost(Position(goal.leftPost));
+    setRightPost(Position(goal.rightPost));
+
+    // Set depth
+    _depth = goal.depth;
+
+    // Set goal area
+    _areaLength = goal.areaLength;
+    _areaWidth = goal.areaWidth;
+    _areaRoundedRadius = goal.areaRoundedRadius;
+}
+
+
+/*** 'toCORBA' function
+  ** Description: Copies the goal to a CORBA GoalGeometry
+  ** Receives:    [other] The CORBA GoalGeometry
+  ** Returns:     Nothing
+  ***/
+void Goal::toCORBA(CORBATypes::GoalGeometry* other) const {
+    // Copies the posts
+    _leftPost.toCORBA(&other->leftPost);
+    _rightPost.toCORBA(&other->rightPost);
+
+    // Copies the depth and the goal area
+    other->depth             = _depth;
+    other->areaLength        = _areaLength;
+    other->areaWidth         = _areaWidth;
+    other->areaRoundedRadius = _areaRoundedRadius;
+}
+
 
 /*** Positions handling function
   ** Description: Sets/gets the posts positions
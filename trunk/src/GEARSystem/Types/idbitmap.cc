@@ -0,0 +1,163 @@
+/*** GEARSystem - IdBitmap implementation
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Includes the class header
+#include <GEARSystem/Types/idbitmap.hh>
+
+
+// Selects namespace
+using namespace GEARSystem;
+
+
+/*** Constructor
+  ** Description: Creates an empty bitmap
+  ** Receives:    Nothing
+  ***/
+IdBitmap::IdBitmap() {
+    reset();
+}
+
+/*** Constructor
+  ** Description: Creates a bitmap from a CORBA IdBitmap
+  ** Receives:    [bitmap] The CORBA IdBitmap
+  ***/
+IdBitmap::IdBitmap(const CORBATypes::IdBitmap bitmap) {
+    reset();
+    for (int i = 0; i < nWords; i++) {
+        setWord(i, bitmap[i]);
+    }
+}
+
+
+/*** 'toCORBA' function
+  ** Description: Copies the bitmap to a CORBA IdBitmap
+  ** Receives:    [other] The CORBA IdBitmap
+  ** Returns:     Nothing
+  ***/
+void IdBitmap::toCORBA(CORBATypes::IdBitmap other) const {
+    for (int i = 0; i < nWords; i++) {
+        other[i] = _words[i];
+    }
+}
+
+
+/*** Ids handling functions
+  ** Description: Adds, removes and checks an id
+  ** Receives:    [id] The id
+  ** Returns:     'set' and 'clear' return 'true' if the bitmap changed; 'test' returns 'true' if the id is set
+  ***/
+bool IdBitmap::set(quint8 id) {
+    // Verifies if the id is already set
+    const quint32 mask = (1u << (id & 31));
+    if (_words[id >> 5] & mask) {
+        return(false);
+    }
+
+    // Sets the bit
+    _words[id >> 5] |= mask;
+    _count++;
+    return(true);
+}
+
+bool IdBitmap::clear(quint8 id) {
+    // Verifies if the id is set
+    const quint32 mask = (1u << (id & 31));
+    if (!(_words[id >> 5] & mask)) {
+        return(false);
+    }
+
+    // Clears the bit
+    _words[id >> 5] &= ~mask;
+    _count--;
+    return(true);
+}
+
+bool IdBitmap::test(quint8 id) const {
+    return((_words[id >> 5] & (1u << (id & 31))) != 0);
+}
+
+
+/*** 'reset' function
+  ** Description: Removes all the ids
+  ** Receives:    Nothing
+  ** Returns:     Nothing
+  ***/
+void IdBitmap::reset() {
+    for (int i = 0; i < nWords; i++) {
+        _words[i] = 0;
+    }
+    _count = 0;
+}
+
+
+/*** 'count' and 'isEmpty' functions
+  ** Description: Gets the number of ids set
+  ***/
+int  IdBitmap::count()   const { return(_count); }
+bool IdBitmap::isEmpty() const { return(_count == 0); }
+
+
+/*** 'toList' function
+  ** Description: Lists the ids set
+  ** Receives:    Nothing
+  ** Returns:     The ids, in ascending order
+  ***/
+QList<quint8> IdBitmap::toList() const {
+    QList<quint8> ids;
+    ids.reserve(_count);
+
+    // Walks through the set bits of each word
+    for (int i = 0; i < nWords; i++) {
+        quint32 bits = _words[i];
+        while (bits != 0) {
+            ids.append(quint8((i << 5) + qCountTrailingZeroBits(bits)));
+            bits &= (bits - 1);
+        }
+    }
+
+    // Returns the list
+    return(ids);
+}
+
+
+/*** Raw words handling functions
+  ** Description: Gets/sets a 32-bit word of the map
+  ** Receives:    [index] The word index
+                  [value] The word value
+  ***/
+quint32 IdBitmap::word(int index) const {
+    return((index >= 0 && index < nWords)? _words[index] : 0);
+}
+
+void IdBitmap::setWord(int index, quint32 value) {
+    if (index < 0 || index >= nWords) {
+        return;
+    }
+
+    // Updates the word and the counter
+    _count -= qPopulationCount(_words[index]);
+    _words[index] = value;
+    _count += qPopulationCount(value);
+}
+
+
+/*** Comparison operators
+  ** Description: Compares two bitmaps
+  ***/
+bool IdBitmap::operator ==(const IdBitmap& other) const {
+    for (int i = 0; i < nWords; i++) {
+        if (_words[i] != other._words[i]) {
+            return(false);
+        }
+    }
+    return(true);
+}
+
+bool IdBitmap::operator !=(const IdBitmap& other) const {
+    return(!operator ==(other));
+}
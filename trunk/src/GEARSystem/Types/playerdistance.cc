@@ -0,0 +1,121 @@
+/*** GEARSystem - PlayerDistance implementation
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Includes the class header
+#include <GEARSystem/Types/playerdistance.hh>
+
+
+// Selects namespace
+using namespace GEARSystem;
+
+
+/*** Constructor
+  ** Description: Creates player 0 of team 0 at distance 0
+  ** Receives:    Nothing
+  ***/
+PlayerDistance::PlayerDistance() {
+    _teamNum   = 0;
+    _playerNum = 0;
+    _distance  = 0.0f;
+}
+
+/*** Constructor
+  ** Description: Creates a player distance
+  ** Receives:    [teamNum]   The team number
+                  [playerNum] The player number
+                  [distance]  The distance
+  ***/
+PlayerDistance::PlayerDistance(quint8 teamNum, quint8 playerNum, float distance) {
+    _teamNum   = teamNum;
+    _playerNum = playerNum;
+    _distance  = distance;
+}
+
+/*** Constructor
+  ** Description: Creates a player distance from a CORBA PlayerDistance
+  ** Receives:    [playerDistance] The CORBA PlayerDistance
+  ***/
+PlayerDistance::PlayerDistance(const CORBATypes::PlayerDistance& playerDistance) {
+    _teamNum   = playerDistance.teamNum;
+    _playerNum = playerDistance.playerNum;
+    _distance  = playerDistance.distance;
+}
+
+
+/*** 'toCORBA' function
+  ** Description: Copies the player distance to a CORBA PlayerDistance
+  ** Receives:    [other] The CORBA PlayerDistance
+  ** Returns:     Nothing
+  ***/
+void PlayerDistance::toCORBA(CORBATypes::PlayerDistance* other) const {
+    other->teamNum   = _teamNum;
+    other->playerNum = _playerNum;
+    other->distance  = _distance;
+}
+
+/*** 'toCORBA' function
+  ** Description: Copies a list of player distances to a CORBA PlayerDistanceSeq
+  ** Receives:    [playerDistances] The player distances
+                  [other]           The CORBA PlayerDistanceSeq
+  ** Returns:     Nothing
+  ***/
+void PlayerDistance::toCORBA(const QList<PlayerDistance>& playerDistances, CORBATypes::PlayerDistanceSeq* other) {
+    // Sizes the sequence once
+    other->length(playerDistances.size());
+
+    // Copies the player distances
+    for (int i = 0; i < playerDistances.size(); i++) {
+        playerDistances.at(i).toCORBA(&(*other)[i]);
+    }
+}
+
+/*** 'fromCORBA' function
+  ** Description: Copies a CORBA PlayerDistanceSeq to a list of player distances
+  ** Receives:    [playerDistances] The CORBA PlayerDistanceSeq
+  ** Returns:     The player distances
+  ***/
+QList<PlayerDistance> PlayerDistance::fromCORBA(const CORBATypes::PlayerDistanceSeq& playerDistances) {
+    QList<PlayerDistance> list;
+    list.reserve(playerDistances.length());
+
+    // Copies the player distances
+    for (CORBA::ULong i = 0; i < playerDistances.length(); i++) {
+        list.append(PlayerDistance(playerDistances[i]));
+    }
+
+    // Returns the player distances
+    return(list);
+}
+
+
+/*** '<' operator
+  ** Description: Compares the distances, so results can be sorted from the closest player
+  ** Receives:    [other] The other player distance
+  ** Returns:     'true' if this player is closer, 'false' otherwise
+  ***/
+bool PlayerDistance::operator <(const PlayerDistance& other) const {
+    return(_distance < other._distance);
+}
+
+
+/*** Info functions
+  ** Description: Gets the player distance info
+  ** Receives:    Nothing
+  ** Returns:     The requested info
+  ***/
+quint8 PlayerDistance::teamNum() const {
+    return(_teamNum);
+}
+
+quint8 PlayerDistance::playerNum() const {
+    return(_playerNum);
+}
+
+float PlayerDistance::distance() const {
+    return(_distance);
+}
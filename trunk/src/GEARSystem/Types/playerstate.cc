@@ -0,0 +1,171 @@
+/*** GEARSystem - PlayerState implementation
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Includes the class header
+#include <GEARSystem/Types/playerstate.hh>
+
+
+// Selects namespace
+using namespace GEARSystem;
+
+
+/*** Constructor
+  ** Description: Creates the invalid state of a player that doesn't exist
+  ** Receives:    [teamNum]   The team number
+                  [playerNum] The player number
+  ***/
+PlayerState::PlayerState() {
+    _teamNum         = 0;
+    _playerNum       = 0;
+    _valid           = false;
+    _ballPossession  = false;
+    _kickEnabled     = false;
+    _dribbleEnabled  = false;
+    _batteryCharge   = 0;
+    _capacitorCharge = 0;
+}
+
+PlayerState::PlayerState(quint8 teamNum, quint8 playerNum) {
+    _teamNum         = teamNum;
+    _playerNum       = playerNum;
+    _valid           = false;
+    _ballPossession  = false;
+    _kickEnabled     = false;
+    _dribbleEnabled  = false;
+    _batteryCharge   = 0;
+    _capacitorCharge = 0;
+}
+
+/*** Constructor
+  ** Description: Creates a player state
+  ** Receives:    [teamNum]         The team number
+                  [playerNum]       The player number
+                  [position]        The position
+                  [orientation]     The orientation
+                  [velocity]        The velocity
+                  [angularSpeed]    The angular speed
+                  [ballPossession]  'true' if the player has the ball
+                  [kickEnabled]     'true' if the kicking device is enabled
+                  [dribbleEnabled]  'true' if the dribbling device is enabled
+                  [batteryCharge]   The battery charge
+                  [capacitorCharge] The capacitor charge
+  ***/
+PlayerState::PlayerState(quint8 teamNum, quint8 playerNum, const Position& position, const Angle& orientation,
+                         const Velocity& velocity, const AngularSpeed& angularSpeed, bool ballPossession, bool kickEnabled,
+                         bool dribbleEnabled, unsigned char batteryCharge, unsigned char capacitorCharge) {
+    _teamNum         = teamNum;
+    _playerNum       = playerNum;
+    _valid           = true;
+    _position        = position;
+    _orientation     = orientation;
+    _velocity        = velocity;
+    _angularSpeed    = angularSpeed;
+    _ballPossession  = ballPossession;
+    _kickEnabled     = kickEnabled;
+    _dribbleEnabled  = dribbleEnabled;
+    _batteryCharge   = batteryCharge;
+    _capacitorCharge = capacitorCharge;
+}
+
+/*** Constructor
+  ** Description: Creates a player state from a CORBA PlayerState
+  ** Receives:    [state] The CORBA PlayerState
+  ***/
+PlayerState::PlayerState(const CORBATypes::PlayerState& state) {
+    _teamNum         = state.teamNum;
+    _playerNum       = state.playerNum;
+    _valid           = true;
+    _position        = Position(state.position);
+    _orientation     = Angle(state.orientation);
+    _velocity        = Velocity(state.velocity);
+    _angularSpeed    = AngularSpeed(state.angularSpeed);
+    _ballPossession  = state.ballPossession;
+    _kickEnabled     = state.kickEnabled;
+    _dribbleEnabled  = state.dribbleEnabled;
+    _batteryCharge   = state.batteryCharge;
+    _capacitorCharge = state.capacitorCharge;
+}
+
+
+/*** 'toCORBA' function
+  ** Description: Copies the state to a CORBA PlayerState
+  ** Receives:    [other] The CORBA PlayerState
+  ** Returns:     Nothing
+  ***/
+void PlayerState::toCORBA(CORBATypes::PlayerState* other) const {
+    other->teamNum   = _teamNum;
+    other->playerNum = _playerNum;
+    _position.toCORBA(&other->position);
+    _orientation.toCORBA(&other->orientation);
+    _velocity.toCORBA(&other->velocity);
+    _angularSpeed.toCORBA(&other->angularSpeed);
+    other->ballPossession  = _ballPossession;
+    other->kickEnabled     = _kickEnabled;
+    other->dribbleEnabled  = _dribbleEnabled;
+    other->batteryCharge   = _batteryCharge;
+    other->capacitorCharge = _capacitorCharge;
+}
+
+
+/*** 'isValid' function
+  ** Description: Verifies if the state belongs to an existing player
+  ** Receives:    Nothing
+  ** Returns:     'true' if it does, 'false' otherwise
+  ***/
+bool PlayerState::isValid() const {
+    return(_valid);
+}
+
+/*** Info functions
+  ** Description: Gets the player info
+  ** Receives:    Nothing
+  ** Returns:     The requested info
+  ***/
+quint8 PlayerState::teamNum() const {
+    return(_teamNum);
+}
+
+quint8 PlayerState::playerNum() const {
+    return(_playerNum);
+}
+
+const Position& PlayerState::position() const {
+    return(_position);
+}
+
+const Angle& PlayerState::orientation() const {
+    return(_orientation);
+}
+
+const Velocity& PlayerState::velocity() const {
+    return(_velocity);
+}
+
+const AngularSpeed& PlayerState::angularSpeed() const {
+    return(_angularSpeed);
+}
+
+bool PlayerState::ballPossession() const {
+    return(_ballPossession);
+}
+
+bool PlayerState::kickEnabled() const {
+    return(_kickEnabled);
+}
+
+bool PlayerState::dribbleEnabled() const {
+    return(_dribbleEnabled);
+}
+
+unsigned char PlayerState::batteryCharge() const {
+    return(_batteryCharge);
+}
+
+unsigned char PlayerState::capacitorCharge() const {
+    return(_capacitorCharge);
+}
@@ -19,6 +19,10 @@ using namespace GEARSystem;
   ** Recieves:    Nothing
   ***/
 Position::Position() {
+    // Isn't produced by a frame
+    _frameId     = 0;
+    _captureTime = 0.0;
+
     setInvalid();
 }
 
@@ -32,6 +36,10 @@ Position::Position() {
                   [newZ]  The z coordinate
   ***/
 Position::Position(bool known, float newX, float newY, float newZ) {
+    // Isn't produced by a frame
+    _frameId     = 0;
+    _captureTime = 0.0;
+
     (known == true) ? setPosition(newX, newY, newZ) : setUnknown();
 }
 
@@ -55,6 +63,10 @@ Position::Position(const CORBATypes::Position& position) {
     else {
         setPosition(position.x, position.y, position.z);
     }
+
+    // Sets the capture info
+    _frameId     = position.frameId;
+    _captureTime = position.captureTime;
 }
 
 
@@ -83,6 +95,10 @@ void Position::toCORBA(CORBATypes::Position* other) const {
         other->y         = y();
         other->z         = z();
     }
+
+    // Sets the capture info
+    other->frameId     = _frameId;
+    other->captureTime = _captureTime;
 }
 
 
@@ -108,6 +124,10 @@ Position& Position::operator =(const Position& other) {
         setInvalid();
     }
 
+    // Copies the capture info
+    _frameId     = other._frameId;
+    _captureTime = other._captureTime;
+
     // Returns this position
     return(*this);
 }
@@ -137,3 +157,12 @@ void Position::setUnknown() {
     _unknown = true;
     _valid   = true;
 }
+
+
+// Capture info functions
+quint32 Position::frameId()     const { return(_frameId);     }
+double  Position::captureTime() const { return(_captureTime); }
+void    Position::setCapture(quint32 frameId, double captureTime) {
+    _frameId     = frameId;
+    _captureTime = captureTime;
+}
@@ -0,0 +1,129 @@
+/*** GEARSystem - RobotCommand implementation
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Includes the class header
+#include <GEARSystem/Types/robotcommand.hh>
+
+
+// Selects namespace
+using namespace GEARSystem;
+
+
+/*** Constructor
+  ** Description: Creates a null command for player 0 of team 0
+  ** Receives:    Nothing
+  ***/
+RobotCommand::RobotCommand() {
+    _teamNum   = 0;
+    _playerNum = 0;
+    _x         = 0.0f;
+    _y         = 0.0f;
+    _theta     = 0.0f;
+}
+
+/*** Constructor
+  ** Description: Creates a speed command
+  ** Receives:    [teamNum]   The team number
+                  [playerNum] The player number
+                  [x]         The x speed component
+                  [y]         The y speed component
+                  [theta]     The angular speed
+  ***/
+RobotCommand::RobotCommand(quint8 teamNum, quint8 playerNum, float x, float y, float theta) {
+    _teamNum   = teamNum;
+    _playerNum = playerNum;
+    _x         = x;
+    _y         = y;
+    _theta     = theta;
+}
+
+/*** Constructor
+  ** Description: Creates a command from a CORBA RobotCommand
+  ** Receives:    [command] The CORBA RobotCommand
+  ***/
+RobotCommand::RobotCommand(const CORBATypes::RobotCommand& command) {
+    _teamNum   = command.teamNum;
+    _playerNum = command.playerNum;
+    _x         = command.x;
+    _y         = command.y;
+    _theta     = command.theta;
+}
+
+
+/*** 'toCORBA' function
+  ** Description: Copies the command to a CORBA RobotCommand
+  ** Receives:    [other] The CORBA RobotCommand
+  ** Returns:     Nothing
+  ***/
+void RobotCommand::toCORBA(CORBATypes::RobotCommand* other) const {
+    other->teamNum   = _teamNum;
+    other->playerNum = _playerNum;
+    other->x         = _x;
+    other->y         = _y;
+    other->theta     = _theta;
+}
+
+/*** 'toCORBA' function
+  ** Description: Copies a list of commands to a CORBA RobotCommandSeq
+  ** Receives:    [commands] The commands
+                  [other]    The CORBA RobotCommandSeq
+  ** Returns:     Nothing
+  ***/
+void RobotCommand::toCORBA(const QList<RobotCommand>& commands, CORBATypes::RobotCommandSeq* other) {
+    // Sizes the sequence once
+    other->length(commands.size());
+
+    // Copies the commands
+    for (int i = 0; i < commands.size(); i++) {
+        commands.at(i).toCORBA(&(*other)[i]);
+    }
+}
+
+/*** 'fromCORBA' function
+  ** Description: Copies a CORBA RobotCommandSeq to a list of commands
+  ** Receives:    [commands] The CORBA RobotCommandSeq
+  ** Returns:     The commands
+  ***/
+QList<RobotCommand> RobotCommand::fromCORBA(const CORBATypes::RobotCommandSeq& commands) {
+    QList<RobotCommand> list;
+    list.reserve(commands.length());
+
+    // Copies the commands
+    for (CORBA::ULong i = 0; i < commands.length(); i++) {
+        list.append(RobotCommand(commands[i]));
+    }
+
+    // Returns the commands
+    return(list);
+}
+
+
+/*** Info functions
+  ** Description: Gets the command info
+  ** Receives:    Nothing
+  ** Returns:     The requested info
+  ***/
+quint8 RobotCommand::teamNum() const {
+    return(_teamNum);
+}
+
+quint8 RobotCommand::playerNum() const {
+    return(_playerNum);
+}
+
+float RobotCommand::x() const {
+    return(_x);
+}
+
+float RobotCommand::y() const {
+    return(_y);
+}
+
+float RobotCommand::theta() const {
+    return(_theta);
+}
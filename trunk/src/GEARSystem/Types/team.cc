@@ -24,6 +24,13 @@ using std::endl;
 using std::flush;
 
 
+// Invalid types
+const Angle        GEARSystemTeam::_invalidAngle;
+const AngularSpeed GEARSystemTeam::_invalidAngularSpeed;
+const Position     GEARSystemTeam::_invalidPosition;
+const Velocity     GEARSystemTeam::_invalidVelocity;
+
+
 /*** Constructor
   ** Description: Creates an invalid team
   ** Recieves:    Nothing
@@ -32,29 +39,11 @@ GEARSystemTeam::GEARSystemTeam() {
     // Sets as invalid
     setInvalid();
 
-    // Creates invalid types
-    _invalidPosition     = new Position();
-    _invalidAngle        = new Angle();
-    _invalidVelocity     = new Velocity();
-    _invalidAngularSpeed = new AngularSpeed();
-
     // Initializes the players
-    _nPlayers = 0;
-    _validPlayers.clear();
-    _playersPositions.clear();
-    _playersOrientations.clear();
-    _playersVelocities.clear();
-    _playersAngularSpeeds.clear();
-    _ballPossessions.clear();
-
-    // Creates the locks
-    #ifdef GSTHREADSAFE
-    _positionsLock     = new QReadWriteLock();
-    _orientationsLock  = new QReadWriteLock();
-    _velocitiesLock    = new QReadWriteLock();
-    _angularSpeedsLock = new QReadWriteLock();
-    _possessionsLock   = new QReadWriteLock();
-    #endif
+    _validPlayers.reset();
+    for (int i = 0; i < _maxPlayers; i++) {
+        resetSlot(uint8(i));
+    }
 }
 
 /*** Constructor
@@ -68,105 +57,70 @@ GEARSystemTeam::GEARSystemTeam(uint8 teamNumber, QString teamName) {
     _name   = teamName;
     _valid  = true;
 
-    // Creates invalid types
-    _invalidPosition     = new Position();
-    _invalidAngle        = new Angle();
-    _invalidVelocity     = new Velocity();
-    _invalidAngularSpeed = new AngularSpeed();
-
     // Initializes the players
-    _nPlayers = 0;
-    _validPlayers.clear();
-    _playersPositions.clear();
-    _playersOrientations.clear();
-    _playersVelocities.clear();
-    _playersAngularSpeeds.clear();
-    _ballPossessions.clear();
-    _kickEnabled.clear();
-    _dribbleEnabled.clear();
-    _batteryCharge.clear();
-    _capacitorCharge.clear();
-
-    // Creates the locks
-    #ifdef GSTHREADSAFE
-    _positionsLock     = new QReadWriteLock();
-    _orientationsLock  = new QReadWriteLock();
-    _velocitiesLock    = new QReadWriteLock();
-    _angularSpeedsLock = new QReadWriteLock();
-    _possessionsLock   = new QReadWriteLock();
-    #endif
+    _validPlayers.reset();
+    for (int i = 0; i < _maxPlayers; i++) {
+        resetSlot(uint8(i));
+    }
 }
 
 
 /*** Players handling functions
   ** Description: Handles the team players
   ** Receives:    [playerNum] The player number
-  ** Returns:     Nothing
+  ** Returns:     'addPlayer' and 'delPlayer' return 'true' if the player was added or removed; 'players' and
+                  'playersBitmap' return the players
   ***/
-void GEARSystemTeam::addPlayer(uint8 playerNum) {
-    // Handles the locks
-    #ifdef GSTHREADSAFE
-    QWriteLocker positionsLocker(_positionsLock);
-    QWriteLocker orientationsLocker(_orientationsLock);
-    QWriteLocker velocitiesLocker(_velocitiesLock);
-    QWriteLocker angularSpeedsLocker(_angularSpeedsLock);
-    QWriteLocker possessionsLocker(_possessionsLock);
-    // TODO: Fix fault at this point
-    #endif
-
-    // Adds the player
-    (void) _validPlayers.insert(playerNum, true);
-    (void) _playersPositions.insert(playerNum, new Position(false,0,0,0));
-    (void) _playersOrientations.insert(playerNum, new Angle(false,0));
-    (void) _playersVelocities.insert(playerNum, new Velocity(false,0,0));
-    (void) _playersAngularSpeeds.insert(playerNum, new AngularSpeed(false,0));
-    (void) _kickEnabled.insert(playerNum, false);
-    (void) _dribbleEnabled.insert(playerNum, false);
-    (void) _batteryCharge.insert(playerNum, 0);
-    (void) _capacitorCharge.insert(playerNum, 0);
-    (void) _ballPossessions.insert(playerNum, false);
-    _nPlayers++;
+bool GEARSystemTeam::addPlayer(uint8 playerNum) {
+    // Handles the lock
+    PlayersWriteLocker playersLocker(_playersLock);
+
+    // Adds the player (re-adding resets its state)
+    resetSlot(playerNum);
+    return(_validPlayers.set(playerNum));
 }
 
-void GEARSystemTeam::delPlayer(uint8 playerNum) {
-    // Handles the locks
-    #ifdef GSTHREADSAFE
-    QWriteLocker positionsLocker(_positionsLock);
-    QWriteLocker orientationsLocker(_orientationsLock);
-    QWriteLocker velocitiesLocker(_velocitiesLock);
-    QWriteLocker angularSpeedsLocker(_angularSpeedsLock);
-    QWriteLocker possessionsLocker(_possessionsLock);
-    // TODO: Fix fault at this point
-    #endif
+bool GEARSystemTeam::delPlayer(uint8 playerNum) {
+    // Handles the lock
+    PlayersWriteLocker playersLocker(_playersLock);
 
     // Deletes the player
-    (void) _validPlayers.remove(playerNum);
-    (void) delete(_playersPositions[playerNum]);
-    (void) delete(_playersOrientations[playerNum]);
-    (void) delete(_playersVelocities[playerNum]);
-    (void) delete(_playersAngularSpeeds[playerNum]);
-    (void) _playersPositions.remove(playerNum);
-    (void) _playersOrientations.remove(playerNum);
-    (void) _playersVelocities.remove(playerNum);
-    (void) _playersAngularSpeeds.remove(playerNum);
-    (void) _ballPossessions.remove(playerNum);
-    (void) _kickEnabled.remove(playerNum);
-    (void) _dribbleEnabled.remove(playerNum);
-    (void) _batteryCharge.remove(playerNum);
-    (void) _capacitorCharge.remove(playerNum);
-    _nPlayers--;
+    return(_validPlayers.clear(playerNum));
 }
 
 QList<uint8> GEARSystemTeam::players() const {
-    // Adds the players to the list
-    QList<uint8> playersList;
-    QHashIterator<uint8,Position*> it(_playersPositions);
-    while (it.hasNext()) {
-        playersList.append(it.next().key());
-    }
+    // Handles the lock
+    PlayersReadLocker playersLocker(_playersLock);
 
     // Returns the list
-    return(playersList);
+    return(_validPlayers.toList());
+}
+
+IdBitmap GEARSystemTeam::playersBitmap() const {
+    // Handles the lock
+    PlayersReadLocker playersLocker(_playersLock);
+
+    // Returns the bitmap
+    return(_validPlayers);
+}
+
+
+/*** 'resetSlot' function
+  ** Description: Sets a player slot to its initial state
+  ** Receives:    [playerNum] The player number
+  ** Returns:     Nothing
+  ***/
+void GEARSystemTeam::resetSlot(uint8 playerNum) {
+    PlayerSlot& slot = _players[playerNum];
+    slot.position        = Position(false,0,0,0);
+    slot.orientation     = Angle(false,0);
+    slot.velocity        = Velocity(false,0,0);
+    slot.angularSpeed    = AngularSpeed(false,0);
+    slot.ballPossession  = false;
+    slot.dribbleEnabled  = false;
+    slot.kickEnabled     = false;
+    slot.batteryCharge   = 0;
+    slot.capacitorCharge = 0;
 }
 
 
@@ -181,6 +135,32 @@ void  GEARSystemTeam::setNumber(uint8 teamNumber) {
     _number = teamNumber;
 }
 
+/*** 'reset' function
+  ** Description: Turns the team into a new team without players, so its storage can be reused
+  ** Receives:    [teamNumber] The team number
+                  [teamName]   The team name
+  ** Returns:     Nothing
+  ***/
+void GEARSystemTeam::reset(uint8 teamNumber, const QString& teamName) {
+    // Handles the lock
+    PlayersWriteLocker playersLocker(_playersLock);
+
+    // Sets team info and drops the players
+    _number = teamNumber;
+    _name   = teamName;
+    _valid  = true;
+    _validPlayers.reset();
+}
+
+/*** 'setExternalLocking' function
+  ** Description: Selects who guards the team
+  ** Receives:    [enable] 'true' if the owner guards every call with its own lock, 'false' if the team locks itself
+  ** Returns:     Nothing
+  ***/
+void GEARSystemTeam::setExternalLocking(bool enable) {
+    _playersLock.setEnabled(!enable);
+}
+
 
 /*** 'setPosition' function
   ** Description: Sets the player position
@@ -190,14 +170,11 @@ void  GEARSystemTeam::setNumber(uint8 teamNumber) {
   ***/
 void GEARSystemTeam::setPosition(uint8 playerNum, const Position& thePosition) {
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    QWriteLocker positionsLocker(_positionsLock);
-    // TODO: Fix fault at this point
-    #endif
+    PlayersWriteLocker playersLocker(_playersLock);
 
     // Sets the player position
-    if (_validPlayers.value(playerNum)) {
-        (void) _playersPositions.value(playerNum)->operator =(thePosition);
+    if (_validPlayers.test(playerNum)) {
+        _players[playerNum].position = thePosition;
     }
     else {
         #ifdef GSDEBUGMSG
@@ -215,14 +192,11 @@ void GEARSystemTeam::setPosition(uint8 playerNum, const Position& thePosition) {
   ***/
 void GEARSystemTeam::setOrientation(uint8 playerNum, const Angle& theOrientation) {
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    QWriteLocker orientationsLocker(_orientationsLock);
-    // TODO: Fix fault at this point
-    #endif
+    PlayersWriteLocker playersLocker(_playersLock);
 
     // Sets the player orientation
-    if (_validPlayers.value(playerNum)) {
-        (void) _playersOrientations.value(playerNum)->operator =(theOrientation);
+    if (_validPlayers.test(playerNum)) {
+        _players[playerNum].orientation = theOrientation;
     }
     else {
         #ifdef GSDEBUGMSG
@@ -240,14 +214,11 @@ void GEARSystemTeam::setOrientation(uint8 playerNum, const Angle& theOrientation
   ***/
 void GEARSystemTeam::setVelocity(uint8 playerNum, const Velocity& theVelocity) {
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    QWriteLocker velocitiesLocker(_velocitiesLock);
-    // TODO: Fix fault at this point
-    #endif
+    PlayersWriteLocker playersLocker(_playersLock);
 
     // Sets the player velocity
-    if (_validPlayers.value(playerNum)) {
-        (void) _playersVelocities.value(playerNum)->operator =(theVelocity);
+    if (_validPlayers.test(playerNum)) {
+        _players[playerNum].velocity = theVelocity;
     }
     else {
         #ifdef GSDEBUGMSG
@@ -265,14 +236,11 @@ void GEARSystemTeam::setVelocity(uint8 playerNum, const Velocity& theVelocity) {
   ***/
 void GEARSystemTeam::setPlayerBatteryCharge(uint8 playerNum, unsigned char charge){
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    QWriteLocker batteriesLocker(_batteriesLock);
-    // TODO: Fix fault at this point
-    #endif
+    PlayersWriteLocker playersLocker(_playersLock);
 
     // Sets the player speed
-    if (_validPlayers.value(playerNum)) {
-        (void) _batteryCharge.insert(playerNum, charge);
+    if (_validPlayers.test(playerNum)) {
+        _players[playerNum].batteryCharge = charge;
     }
     else {
         #ifdef GSDEBUGMSG
@@ -290,14 +258,11 @@ void GEARSystemTeam::setPlayerBatteryCharge(uint8 playerNum, unsigned char charg
   ***/
 void GEARSystemTeam::setPlayerCapacitorCharge(uint8 playerNum, unsigned char charge){
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    QWriteLocker capacitorsLocker(_capacitorsLock);
-    // TODO: Fix fault at this point
-    #endif
+    PlayersWriteLocker playersLocker(_playersLock);
 
     // Sets the player speed
-    if (_validPlayers.value(playerNum)) {
-        (void) _capacitorCharge.insert(playerNum, charge);
+    if (_validPlayers.test(playerNum)) {
+        _players[playerNum].capacitorCharge = charge;
     }
     else {
         #ifdef GSDEBUGMSG
@@ -315,14 +280,11 @@ void GEARSystemTeam::setPlayerCapacitorCharge(uint8 playerNum, unsigned char cha
   ***/
 void GEARSystemTeam::setPlayerDribbleStatus(uint8 playerNum, bool status){
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    QWriteLocker dribblesLocker(_dribblesLock);
-    // TODO: Fix fault at this point
-    #endif
+    PlayersWriteLocker playersLocker(_playersLock);
 
     // Sets the player speed
-    if (_validPlayers.value(playerNum)) {
-        (void) _dribbleEnabled.insert(playerNum, status);
+    if (_validPlayers.test(playerNum)) {
+        _players[playerNum].dribbleEnabled = status;
     }
     else {
         #ifdef GSDEBUGMSG
@@ -340,14 +302,11 @@ void GEARSystemTeam::setPlayerDribbleStatus(uint8 playerNum, bool status){
   ***/
 void GEARSystemTeam::setPlayerKickStatus(uint8 playerNum, bool status){
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    QWriteLocker kicksLocker(_kicksLock);
-    // TODO: Fix fault at this point
-    #endif
+    PlayersWriteLocker playersLocker(_playersLock);
 
     // Sets the player speed
-    if (_validPlayers.value(playerNum)) {
-        (void) _kickEnabled.insert(playerNum, status);
+    if (_validPlayers.test(playerNum)) {
+        _players[playerNum].kickEnabled = status;
     }
     else {
         #ifdef GSDEBUGMSG
@@ -365,14 +324,11 @@ void GEARSystemTeam::setPlayerKickStatus(uint8 playerNum, bool status){
   ***/
 void GEARSystemTeam::setAngularSpeed(uint8 playerNum, const AngularSpeed& theAngularSpeed) {
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    QWriteLocker angularSpeedsLocker(_angularSpeedsLock);
-    // TODO: Fix fault at this point
-    #endif
+    PlayersWriteLocker playersLocker(_playersLock);
 
     // Sets the player speed
-    if (_validPlayers.value(playerNum)) {
-        (void) _playersAngularSpeeds.value(playerNum)->operator =(theAngularSpeed);
+    if (_validPlayers.test(playerNum)) {
+        _players[playerNum].angularSpeed = theAngularSpeed;
     }
     else {
         #ifdef GSDEBUGMSG
@@ -390,14 +346,11 @@ void GEARSystemTeam::setAngularSpeed(uint8 playerNum, const AngularSpeed& theAng
   ***/
 void GEARSystemTeam::setBallPossession(uint8 playerNum, bool possession) {
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    QWriteLocker possessionsLocker(_possessionsLock);
-    // TODO: Fix fault at this point
-    #endif
+    PlayersWriteLocker playersLocker(_playersLock);
 
     // Sets the flag
-    if (_validPlayers.value(playerNum)) {
-        (void) _ballPossessions.insert(playerNum, possession);
+    if (_validPlayers.test(playerNum)) {
+        _players[playerNum].ballPossession = possession;
     }
     else {
         #ifdef GSDEBUGMSG
@@ -415,14 +368,11 @@ void GEARSystemTeam::setBallPossession(uint8 playerNum, bool possession) {
   ***/
 const Position* GEARSystemTeam::position(uint8 playerNum) const {
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    QReadLocker positionsLocker(_positionsLock);
-    // TODO: Fix fault at this point
-    #endif
+    PlayersReadLocker playersLocker(_playersLock);
 
     // Returns the player position
-    if (_validPlayers.value(playerNum)) {
-        return(_playersPositions.value(playerNum));
+    if (_validPlayers.test(playerNum)) {
+        return(&_players[playerNum].position);
     }
     else {
         #ifdef GSDEBUGMSG
@@ -432,19 +382,16 @@ const Position* GEARSystemTeam::position(uint8 playerNum) const {
     }
 
     // Returns an invalid position
-    return(_invalidPosition);
+    return(&_invalidPosition);
 }
 
 const Angle* GEARSystemTeam::orientation(uint8 playerNum) const {
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    QReadLocker orientationsLocker(_orientationsLock);
-    // TODO: Fix fault at this point
-    #endif
+    PlayersReadLocker playersLocker(_playersLock);
 
     // Returns the player orientation
-    if (_validPlayers.value(playerNum)) {
-        return(_playersOrientations.value(playerNum));
+    if (_validPlayers.test(playerNum)) {
+        return(&_players[playerNum].orientation);
     }
     else {
         #ifdef GSDEBUGMSG
@@ -454,19 +401,16 @@ const Angle* GEARSystemTeam::orientation(uint8 playerNum) const {
     }
 
     // Returns an invalid angle
-    return(_invalidAngle);
+    return(&_invalidAngle);
 }
 
 const Velocity* GEARSystemTeam::velocity(uint8 playerNum) const {
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    QReadLocker velocitiesLocker(_velocitiesLock);
-    // TODO: Fix fault at this point
-    #endif
+    PlayersReadLocker playersLocker(_playersLock);
 
     // Returns the player velocity
-    if (_validPlayers.value(playerNum)) {
-        return(_playersVelocities.value(playerNum));
+    if (_validPlayers.test(playerNum)) {
+        return(&_players[playerNum].velocity);
     }
     else {
         #ifdef GSDEBUGMSG
@@ -476,19 +420,16 @@ const Velocity* GEARSystemTeam::velocity(uint8 playerNum) const {
     }
 
     // Returns an invalid velocity
-    return(_invalidVelocity);
+    return(&_invalidVelocity);
 }
 
 const AngularSpeed* GEARSystemTeam::angularSpeed(uint8 playerNum) const {
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    QReadLocker angularSpeedsLocker(_angularSpeedsLock);
-    // TODO: Fix fault at this point
-    #endif
+    PlayersReadLocker playersLocker(_playersLock);
 
     // Returns the player speed
-    if (_validPlayers.value(playerNum)) {
-        return(_playersAngularSpeeds.value(playerNum));
+    if (_validPlayers.test(playerNum)) {
+        return(&_players[playerNum].angularSpeed);
     }
     else {
         #ifdef GSDEBUGMSG
@@ -498,19 +439,16 @@ const AngularSpeed* GEARSystemTeam::angularSpeed(uint8 playerNum) const {
     }
 
     // Returns an invalid speed
-    return(_invalidAngularSpeed);
+    return(&_invalidAngularSpeed);
 }
 
 bool GEARSystemTeam::ballPossession(uint8 playerNum) const {
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    QReadLocker possessionsLocker(_possessionsLock);
-    // TODO: Fix fault at this point
-    #endif
+    PlayersReadLocker playersLocker(_playersLock);
 
     // Returns the flag
-    if (_validPlayers.value(playerNum)) {
-        return(_ballPossessions.value(playerNum));
+    if (_validPlayers.test(playerNum)) {
+        return(_players[playerNum].ballPossession);
     }
     else {
         #ifdef GSDEBUGMSG
@@ -525,14 +463,11 @@ bool GEARSystemTeam::ballPossession(uint8 playerNum) const {
 
 bool GEARSystemTeam::kickEnabled(quint8 playerNum) const{
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    QReadLocker kicksLocker(_kicksLock);
-    // TODO: Fix fault at this point
-    #endif
+    PlayersReadLocker playersLocker(_playersLock);
 
     // Returns the flag
-    if (_validPlayers.value(playerNum)) {
-        return(_kickEnabled.value(playerNum));
+    if (_validPlayers.test(playerNum)) {
+        return(_players[playerNum].kickEnabled);
     }
     else {
         #ifdef GSDEBUGMSG
@@ -547,14 +482,11 @@ bool GEARSystemTeam::kickEnabled(quint8 playerNum) const{
 
 bool GEARSystemTeam::dribbleEnabled(quint8 playerNum) const{
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    QReadLocker dribblesLocker(_dribblesLock);
-    // TODO: Fix fault at this point
-    #endif
+    PlayersReadLocker playersLocker(_playersLock);
 
     // Returns the flag
-    if (_validPlayers.value(playerNum)) {
-        return(_dribbleEnabled.value(playerNum));
+    if (_validPlayers.test(playerNum)) {
+        return(_players[playerNum].dribbleEnabled);
     }
     else {
         #ifdef GSDEBUGMSG
@@ -569,14 +501,11 @@ bool GEARSystemTeam::dribbleEnabled(quint8 playerNum) const{
 
 unsigned char GEARSystemTeam::batteryCharge(quint8 playerNum) const{
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    QReadLocker batteriesLocker(_batteriesLock);
-    // TODO: Fix fault at this point
-    #endif
+    PlayersReadLocker playersLocker(_playersLock);
 
     // Returns the flag
-    if (_validPlayers.value(playerNum)) {
-        return(_batteryCharge.value(playerNum));
+    if (_validPlayers.test(playerNum)) {
+        return(_players[playerNum].batteryCharge);
     }
     else {
         #ifdef GSDEBUGMSG
@@ -591,14 +520,11 @@ unsigned char GEARSystemTeam::batteryCharge(quint8 playerNum) const{
 
 unsigned char GEARSystemTeam::capacitorCharge(quint8 playerNum) const{
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    QReadLocker capacitorsLocker(_capacitorsLock);
-    // TODO: Fix fault at this point
-    #endif
+    PlayersReadLocker playersLocker(_playersLock);
 
     // Returns the flag
-    if (_validPlayers.value(playerNum)) {
-        return(_capacitorCharge.value(playerNum));
+    if (_validPlayers.test(playerNum)) {
+        return(_players[playerNum].capacitorCharge);
     }
     else {
         #ifdef GSDEBUGMSG
@@ -611,9 +537,60 @@ unsigned char GEARSystemTeam::capacitorCharge(quint8 playerNum) const{
     return(0);
 }
 
+/*** 'playerState' function
+  ** Description: Gets the whole player state at once
+  ** Receives:    [playerNum] The player number
+  ** Returns:     The player state, invalid if there is no such player
+  ***/
+PlayerState GEARSystemTeam::playerState(uint8 playerNum) const {
+    // Handles the lock
+    PlayersReadLocker playersLocker(_playersLock);
+
+    // Copies the player slot
+    if (_validPlayers.test(playerNum)) {
+        const PlayerSlot& slot = _players[playerNum];
+        return(PlayerState(_number, playerNum, slot.position, slot.orientation, slot.velocity, slot.angularSpeed,
+                           slot.ballPossession, slot.kickEnabled, slot.dribbleEnabled, slot.batteryCharge,
+                           slot.capacitorCharge));
+    }
+    else {
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: GEARSystemTeam::playerState(uint8): No such Player #" << int(playerNum) << " in GEARSystemTeam #";
+        cerr << int(_number) << "(" << _name.toStdString() << ")!!" << endl << flush;
+        #endif
+    }
+
+    // Returns an invalid state
+    return(PlayerState(_number, playerNum));
+}
+
+/*** 'playerStates' function
+  ** Description: Gets the state of every player of the team at once
+  ** Receives:    Nothing
+  ** Returns:     The player states, in ascending player order
+  ***/
+QVector<PlayerState> GEARSystemTeam::playerStates() const {
+    // Handles the lock
+    PlayersReadLocker playersLocker(_playersLock);
+
+    // Copies the slots of the players in the team
+    QVector<PlayerState> states;
+    states.reserve(_validPlayers.count());
+    for (int i = 0; i < _maxPlayers; i++) {
+        if (_validPlayers.test(i)) {
+            const PlayerSlot& slot = _players[i];
+            states.append(PlayerState(_number, i, slot.position, slot.orientation, slot.velocity, slot.angularSpeed,
+                                      slot.ballPossession, slot.kickEnabled, slot.dribbleEnabled,
+                                      slot.batteryCharge, slot.capacitorCharge));
+        }
+    }
+
+    return(states);
+}
+
 // Info functions
 bool GEARSystemTeam::isValid() const { return(_valid); }
 void GEARSystemTeam::setInvalid() {
     _valid = false;
-    _validPlayers.clear();
+    _validPlayers.reset();
 }
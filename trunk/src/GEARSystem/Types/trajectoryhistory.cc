@@ -0,0 +1,193 @@
+/*** GEARSystem - TrajectoryHistory implementation
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Includes the class header
+#include <GEARSystem/Types/trajectoryhistory.hh>
+
+
+// Selects namespace
+using namespace GEARSystem;
+
+
+/*** Constructor
+  ** Description: Creates an empty history with no room
+  ** Receives:    Nothing
+  ***/
+TrajectoryHistory::TrajectoryHistory() {
+    _first = 0;
+    _size  = 0;
+}
+
+/*** Constructor
+  ** Description: Creates an empty history
+  ** Receives:    [capacity] The maximum number of samples
+  ***/
+TrajectoryHistory::TrajectoryHistory(int capacity) {
+    _samples.resize(qMax(capacity, 0));
+    _first = 0;
+    _size  = 0;
+}
+
+
+/*** Capacity functions
+  ** Description: Handles the maximum number of samples
+  ** Receives:    [capacity] The maximum number of samples (the newest samples are kept when shrinking)
+  ** Returns:     Nothing, or the capacity
+  ***/
+void TrajectoryHistory::setCapacity(int capacity) {
+    capacity = qMax(capacity, 0);
+    if (capacity == _samples.size()) {
+        return;
+    }
+
+    // Copies the newest samples to a buffer of the new size
+    QVector<TrajectorySample> samples(capacity);
+    const int kept = qMin(_size, capacity);
+    for (int i = 0; i < kept; i++) {
+        samples[i] = at(_size-kept+i);
+    }
+
+    _samples.swap(samples);
+    _first = 0;
+    _size  = kept;
+}
+
+int TrajectoryHistory::capacity() const {
+    return(_samples.size());
+}
+
+/*** 'size' function
+  ** Description: Gets the number of stored samples
+  ** Receives:    Nothing
+  ** Returns:     The number of samples
+  ***/
+int TrajectoryHistory::size() const {
+    return(_size);
+}
+
+/*** 'clear' function
+  ** Description: Removes every sample
+  ** Receives:    Nothing
+  ** Returns:     Nothing
+  ***/
+void TrajectoryHistory::clear() {
+    _first = 0;
+    _size  = 0;
+}
+
+
+/*** 'append' function
+  ** Description: Stores a new sample
+  ** Receives:    [sample] The sample
+  ** Returns:     Nothing
+  ** Comments:    A sample with the same time as the newest one replaces it; older samples are ignored
+  ***/
+void TrajectoryHistory::append(const TrajectorySample& sample) {
+    const int capacity = _samples.size();
+    if (capacity == 0) {
+        return;
+    }
+
+    // Keeps the samples ordered
+    if (_size > 0) {
+        const int last = (_first+_size-1)%capacity;
+        if (sample.time() < _samples.at(last).time()) {
+            return;
+        }
+        if (sample.time() == _samples.at(last).time()) {
+            _samples[last] = sample;
+            return;
+        }
+    }
+
+    // Overwrites the oldest sample when full
+    if (_size == capacity) {
+        _samples[_first] = sample;
+        _first = (_first+1)%capacity;
+    }
+    else {
+        _samples[(_first+_size)%capacity] = sample;
+        _size++;
+    }
+}
+
+/*** 'at' function
+  ** Description: Gets a sample
+  ** Receives:    [index] The sample index, 0 being the oldest
+  ** Returns:     The sample
+  ***/
+const TrajectorySample& TrajectoryHistory::at(int index) const {
+    return(_samples.at((_first+index)%_samples.size()));
+}
+
+/*** 'sampleAt' function
+  ** Description: Gets the sample at a given time, interpolating the stored samples
+  ** Receives:    [time] The wanted time, in seconds
+  ** Returns:     The sample (the newest one after the last stored time, invalid before the first)
+  ***/
+TrajectorySample TrajectoryHistory::sampleAt(double time) const {
+    // Nothing that old is stored
+    if ((_size == 0) || (time < at(0).time())) {
+        return(TrajectorySample());
+    }
+
+    // Newer than the newest sample
+    const int index = lowerBound(time);
+    if (index == _size) {
+        return(at(_size-1));
+    }
+
+    // Exactly at a sample
+    const TrajectorySample& after = at(index);
+    if ((after.time() == time) || (index == 0)) {
+        return(after);
+    }
+
+    // Between two samples
+    return(TrajectorySample::interpolate(at(index-1), after, time));
+}
+
+/*** 'samples' function
+  ** Description: Gets the stored samples in a time interval
+  ** Receives:    [startTime] The interval start, in seconds
+                  [endTime]   The interval end, in seconds
+  ** Returns:     The samples, oldest first
+  ***/
+QList<TrajectorySample> TrajectoryHistory::samples(double startTime, double endTime) const {
+    QList<TrajectorySample> list;
+
+    for (int i = lowerBound(startTime); (i < _size) && (at(i).time() <= endTime); i++) {
+        list.append(at(i));
+    }
+
+    return(list);
+}
+
+
+/*** 'lowerBound' function
+  ** Description: Finds the first sample not older than a given time
+  ** Receives:    [time] The time
+  ** Returns:     The sample index ('size' if every sample is older)
+  ***/
+int TrajectoryHistory::lowerBound(double time) const {
+    int first = 0;
+    int last  = _size;
+
+    // Binary search over the ordered samples
+    while (first < last) {
+        const int middle = (first+last)/2;
+        if (at(middle).time() < time) {
+            first = middle+1;
+        }
+        else {
+            last = middle;
+        }
+    }
+
+    return(first);
+}
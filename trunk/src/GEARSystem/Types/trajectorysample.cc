@@ -0,0 +1,158 @@
+/*** GEARSystem - TrajectorySample implementation
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Includes the class header
+#include <GEARSystem/Types/trajectorysample.hh>
+
+
+// Selects namespace
+using namespace GEARSystem;
+
+
+/*** Constructor
+  ** Description: Creates an invalid sample at time 0
+  ** Receives:    Nothing
+  ***/
+TrajectorySample::TrajectorySample() {
+    _time = 0.0;
+}
+
+/*** Constructor
+  ** Description: Creates a sample
+  ** Receives:    [time]        The capture time, in seconds
+                  [position]    The position
+                  [orientation] The orientation
+                  [velocity]    The velocity
+  ***/
+TrajectorySample::TrajectorySample(double time, const Position& position, const Angle& orientation, const Velocity& velocity) {
+    _time        = time;
+    _position    = position;
+    _orientation = orientation;
+    _velocity    = velocity;
+}
+
+/*** Constructor
+  ** Description: Creates a sample from a CORBA TrajectorySample
+  ** Receives:    [sample] The CORBA TrajectorySample
+  ***/
+TrajectorySample::TrajectorySample(const CORBATypes::TrajectorySample& sample) {
+    _time        = sample.time;
+    _position    = Position(sample.position);
+    _orientation = Angle(sample.orientation);
+    _velocity    = Velocity(sample.velocity);
+}
+
+
+/*** 'toCORBA' function
+  ** Description: Copies the sample to a CORBA TrajectorySample
+  ** Receives:    [other] The CORBA TrajectorySample
+  ** Returns:     Nothing
+  ***/
+void TrajectorySample::toCORBA(CORBATypes::TrajectorySample* other) const {
+    other->time = _time;
+    _position.toCORBA(&other->position);
+    _orientation.toCORBA(&other->orientation);
+    _velocity.toCORBA(&other->velocity);
+}
+
+/*** 'toCORBA' function
+  ** Description: Copies a list of samples to a CORBA TrajectorySampleSeq
+  ** Receives:    [samples] The samples
+                  [other]   The CORBA TrajectorySampleSeq
+  ** Returns:     Nothing
+  ***/
+void TrajectorySample::toCORBA(const QList<TrajectorySample>& samples, CORBATypes::TrajectorySampleSeq* other) {
+    // Sizes the sequence once
+    other->length(samples.size());
+
+    // Copies the samples
+    for (int i = 0; i < samples.size(); i++) {
+        samples.at(i).toCORBA(&(*other)[i]);
+    }
+}
+
+/*** 'fromCORBA' function
+  ** Description: Copies a CORBA TrajectorySampleSeq to a list of samples
+  ** Receives:    [samples] The CORBA TrajectorySampleSeq
+  ** Returns:     The samples
+  ***/
+QList<TrajectorySample> TrajectorySample::fromCORBA(const CORBATypes::TrajectorySampleSeq& samples) {
+    QList<TrajectorySample> list;
+    list.reserve(samples.length());
+
+    // Copies the samples
+    for (CORBA::ULong i = 0; i < samples.length(); i++) {
+        list.append(TrajectorySample(samples[i]));
+    }
+
+    // Returns the samples
+    return(list);
+}
+
+
+/*** 'interpolate' function
+  ** Description: Interpolates two samples linearly
+  ** Receives:    [a]    The earlier sample
+                  [b]    The later sample
+                  [time] The wanted time, between the samples times
+  ** Returns:     The interpolated sample
+  ** Comments:    The orientation takes the shortest turn. Values that aren't known in both samples are
+                  taken from the sample closest in time
+  ***/
+TrajectorySample TrajectorySample::interpolate(const TrajectorySample& a, const TrajectorySample& b, double time) {
+    // Calculates the interpolation factor
+    const double interval = b._time-a._time;
+    float factor = (interval > 0.0)? static_cast<float>((time-a._time)/interval) : 1.0f;
+    factor = qBound(0.0f, factor, 1.0f);
+
+    const TrajectorySample& closest = (factor < 0.5f)? a : b;
+    TrajectorySample sample(time, closest._position, closest._orientation, closest._velocity);
+
+    // Interpolates the position
+    if (a._position.isValid() && !a._position.isUnknown() && b._position.isValid() && !b._position.isUnknown()) {
+        sample._position.setPosition(a._position.x()+factor*(b._position.x()-a._position.x()),
+                                     a._position.y()+factor*(b._position.y()-a._position.y()),
+                                     a._position.z()+factor*(b._position.z()-a._position.z()));
+    }
+
+    // Interpolates the orientation
+    if (a._orientation.isValid() && !a._orientation.isUnknown() && b._orientation.isValid() && !b._orientation.isUnknown()) {
+        sample._orientation.setValue(a._orientation.value()+factor*Angle::difference(b._orientation, a._orientation));
+    }
+
+    // Interpolates the velocity
+    if (a._velocity.isValid() && !a._velocity.isUnknown() && b._velocity.isValid() && !b._velocity.isUnknown()) {
+        sample._velocity.setVelocity(a._velocity.x()+factor*(b._velocity.x()-a._velocity.x()),
+                                     a._velocity.y()+factor*(b._velocity.y()-a._velocity.y()));
+    }
+
+    // Returns the sample
+    return(sample);
+}
+
+
+/*** Info functions
+  ** Description: Gets the sample info
+  ** Receives:    Nothing
+  ** Returns:     The requested info
+  ***/
+double TrajectorySample::time() const {
+    return(_time);
+}
+
+const Position& TrajectorySample::position() const {
+    return(_position);
+}
+
+const Angle& TrajectorySample::orientation() const {
+    return(_orientation);
+}
+
+const Velocity& TrajectorySample::velocity() const {
+    return(_velocity);
+}
@@ -23,6 +23,10 @@ using namespace GEARSystem;
   ** Recieves:    Nothing
   ***/
 Velocity::Velocity() {
+    // Isn't produced by a frame
+    _frameId     = 0;
+    _captureTime = 0.0;
+
     setInvalid();
 }
 
@@ -35,6 +39,10 @@ Velocity::Velocity() {
                   [newY]  The y component
   ***/
 Velocity::Velocity(bool known, float newX, float newY) {
+    // Isn't produced by a frame
+    _frameId     = 0;
+    _captureTime = 0.0;
+
     (known == true) ? setVelocity(newX, newY) : setUnknown();
 }
 
@@ -47,6 +55,10 @@ Velocity::Velocity(bool known, float newX, float newY) {
                   [newArg] The velocity argument
   ***/
 Velocity::Velocity(bool known, float newAbs, const Angle& newArg) {
+    // Isn't produced by a frame
+    _frameId     = 0;
+    _captureTime = 0.0;
+
     (known == true) ? setVelocity(newAbs, newArg) : setUnknown();
 }
 
@@ -70,6 +82,10 @@ Velocity::Velocity(const CORBATypes::Velocity& velocity) {
     else {
         setVelocity(velocity.x, velocity.y);
     }
+
+    // Sets the capture info
+    _frameId     = velocity.frameId;
+    _captureTime = velocity.captureTime;
 }
 
 
@@ -97,6 +113,10 @@ void Velocity::toCORBA(CORBATypes::Velocity* other) const {
         other->x         = x();
         other->y         = y();
     }
+
+    // Sets the capture info
+    other->frameId     = _frameId;
+    other->captureTime = _captureTime;
 }
 
 
@@ -122,6 +142,10 @@ Velocity& Velocity::operator =(const Velocity& other) {
         setInvalid();
     }
 
+    // Copies the capture info
+    _frameId     = other._frameId;
+    _captureTime = other._captureTime;
+
     // Returns this velocity
     return(*this);
 }
@@ -191,3 +215,12 @@ void Velocity::setPolarComponents() {
     _abs = sqrt(pow(_x, 2) + pow(_y, 2));
     _arg = atan2(_y, _x);
 }
+
+
+// Capture info functions
+quint32 Velocity::frameId()     const { return(_frameId);     }
+double  Velocity::captureTime() const { return(_captureTime); }
+void    Velocity::setCapture(quint32 frameId, double captureTime) {
+    _frameId     = frameId;
+    _captureTime = captureTime;
+}
@@ -0,0 +1,183 @@
+/*** GEARSystem - WorldUpdate implementation
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Includes the class header
+#include <GEARSystem/Types/worldupdate.hh>
+
+
+// Selects namespace
+using namespace GEARSystem;
+
+
+/*** Constructor
+  ** Description: Creates an invalid update
+  ** Receives:    Nothing
+  ***/
+WorldUpdate::WorldUpdate() {
+    _type    = Invalid;
+    _teamNum = 0;
+    _num     = 0;
+    _flag    = false;
+    _charge  = 0;
+}
+
+
+/*** Constructors
+  ** Description: Creates a ball position or velocity update
+  ** Receives:    [ballNum]  The ball number
+                  [position] The ball position
+                  [velocity] The ball velocity
+  ***/
+WorldUpdate::WorldUpdate(quint8 ballNum, const Position& position) {
+    _type     = BallPosition;
+    _teamNum  = 0;
+    _num      = ballNum;
+    _position = position;
+    _flag     = false;
+    _charge   = 0;
+}
+
+WorldUpdate::WorldUpdate(quint8 ballNum, const Velocity& velocity) {
+    _type     = BallVelocity;
+    _teamNum  = 0;
+    _num      = ballNum;
+    _velocity = velocity;
+    _flag     = false;
+    _charge   = 0;
+}
+
+
+/*** Constructors
+  ** Description: Creates a player pose, velocity or angular speed update
+  ** Receives:    [teamNum]      The team number
+                  [playerNum]    The player number
+                  [position]     The player position
+                  [orientation]  The player orientation
+                  [velocity]     The player velocity
+                  [angularSpeed] The player angular speed
+  ***/
+WorldUpdate::WorldUpdate(quint8 teamNum, quint8 playerNum, const Position& position) {
+    _type     = PlayerPosition;
+    _teamNum  = teamNum;
+    _num      = playerNum;
+    _position = position;
+    _flag     = false;
+    _charge   = 0;
+}
+
+WorldUpdate::WorldUpdate(quint8 teamNum, quint8 playerNum, const Angle& orientation) {
+    _type        = PlayerOrientation;
+    _teamNum     = teamNum;
+    _num         = playerNum;
+    _orientation = orientation;
+    _flag        = false;
+    _charge      = 0;
+}
+
+WorldUpdate::WorldUpdate(quint8 teamNum, quint8 playerNum, const Velocity& velocity) {
+    _type     = PlayerVelocity;
+    _teamNum  = teamNum;
+    _num      = playerNum;
+    _velocity = velocity;
+    _flag     = false;
+    _charge   = 0;
+}
+
+WorldUpdate::WorldUpdate(quint8 teamNum, quint8 playerNum, const AngularSpeed& angularSpeed) {
+    _type         = PlayerAngularSpeed;
+    _teamNum      = teamNum;
+    _num          = playerNum;
+    _angularSpeed = angularSpeed;
+    _flag         = false;
+    _charge       = 0;
+}
+
+
+/*** Constructors
+  ** Description: Creates a player flag or charge update
+  ** Receives:    [type]      The update type
+                  [teamNum]   The team number
+                  [playerNum] The player number
+                  [flag]      The flag value
+                  [charge]    The charge value
+  ***/
+WorldUpdate::WorldUpdate(Type type, quint8 teamNum, quint8 playerNum, bool flag) {
+    _type    = (type == BallPossession || type == KickEnabled || type == DribbleEnabled)? type : Invalid;
+    _teamNum = teamNum;
+    _num     = playerNum;
+    _flag    = flag;
+    _charge  = 0;
+}
+
+WorldUpdate::WorldUpdate(Type type, quint8 teamNum, quint8 playerNum, unsigned char charge) {
+    _type    = (type == BatteryCharge || type == CapacitorCharge)? type : Invalid;
+    _teamNum = teamNum;
+    _num     = playerNum;
+    _flag    = false;
+    _charge  = charge;
+}
+
+
+/*** Info functions
+  ** Description: Gets the update info
+  ***/
+WorldUpdate::Type WorldUpdate::type() const { return(_type); }
+bool   WorldUpdate::isBall()    const { return(_type == BallPosition || _type == BallVelocity); }
+quint8 WorldUpdate::teamNum()   const { return(_teamNum); }
+quint8 WorldUpdate::playerNum() const { return(_num); }
+quint8 WorldUpdate::ballNum()   const { return(_num); }
+
+
+/*** Values functions
+  ** Description: Gets the update value
+  ***/
+const Position&     WorldUpdate::position()     const { return(_position); }
+const Angle&        WorldUpdate::orientation()  const { return(_orientation); }
+const Velocity&     WorldUpdate::velocity()     const { return(_velocity); }
+const AngularSpeed& WorldUpdate::angularSpeed() const { return(_angularSpeed); }
+bool                WorldUpdate::flag()         const { return(_flag); }
+unsigned char       WorldUpdate::charge()       const { return(_charge); }
+
+
+/*** 'setCapture' function
+  ** Description: Sets the vision frame that produced the value, unless the value already has one
+  ** Receives:    [frameId]     The frame number
+                  [captureTime] The frame capture time, in seconds
+  ** Returns:     Nothing
+  ***/
+void WorldUpdate::setCapture(quint32 frameId, double captureTime) {
+    switch (_type) {
+        case BallPosition:
+        case PlayerPosition:
+            if ((_position.frameId() == 0) && (_position.captureTime() == 0.0)) {
+                _position.setCapture(frameId, captureTime);
+            }
+            break;
+
+        case PlayerOrientation:
+            if ((_orientation.frameId() == 0) && (_orientation.captureTime() == 0.0)) {
+                _orientation.setCapture(frameId, captureTime);
+            }
+            break;
+
+        case BallVelocity:
+        case PlayerVelocity:
+            if ((_velocity.frameId() == 0) && (_velocity.captureTime() == 0.0)) {
+                _velocity.setCapture(frameId, captureTime);
+            }
+            break;
+
+        case PlayerAngularSpeed:
+            if ((_angularSpeed.frameId() == 0) && (_angularSpeed.captureTime() == 0.0)) {
+                _angularSpeed.setCapture(frameId, captureTime);
+            }
+            break;
+
+        default: break;
+    }
+}
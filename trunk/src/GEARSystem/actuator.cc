@@ -162,8 +162,10 @@ bool Actuator::connect(const QString& address, uint16 port) {
     // Activates the POA Manager
     _poa->the_POAManager()->activate();
 
-    // Adds the actuator to the server
-    _corbaCommandBus->addActuator(_name.toStdString().c_str(), _orb->object_to_string(_corbaActuator->_this()));
+    // Adds the actuator to the server, declaring its players
+    CORBATypes::TeamOwnershipSeq ownership;
+    _ownership.toCORBA(&ownership);
+    _corbaCommandBus->addActuator(_name.toStdString().c_str(), _orb->object_to_string(_corbaActuator->_this()), ownership);
 
     // Sets as connected
     _serverAddress = address;
@@ -199,6 +201,41 @@ void Actuator::disconnect() {
 bool Actuator::isConnected() const { return(_isConnected); }
 
 
+/*** 'setOwnership' function
+  ** Description: Sets the teams and players this actuator drives
+  ** Receives:    [ownership] The ownership (if empty, the actuator receives every command)
+  ** Returns:     Nothing
+  ** Comments:    The ownership is sent to the server on 'connect', so it must be set before it
+  ***/
+void Actuator::setOwnership(const ActuatorOwnership& ownership) {
+    _ownership = ownership;
+}
+
+/*** 'ownership' function
+  ** Description: Gets the teams and players this actuator drives
+  ** Receives:    Nothing
+  ** Returns:     The ownership
+  ***/
+const ActuatorOwnership& Actuator::ownership() const {
+    return(_ownership);
+}
+
+
+/*** 'setSpeeds'
+  ** Description: Sets the speed of several players at once
+  ** Receives:    [commands] The speed commands
+  ** Returns:     Nothing
+  ** Comments:    The default implementation calls 'setSpeed' for each command. Actuators that
+                  can send all the commands in a single packet should reimplement it
+  ***/
+void Actuator::setSpeeds(const QList<RobotCommand>& commands) {
+    for (int i = 0; i < commands.size(); i++) {
+        const RobotCommand& command = commands.at(i);
+        setSpeed(command.teamNum(), command.playerNum(), command.x(), command.y(), command.theta());
+    }
+}
+
+
 /*** 'bindToServer' function
   ** Description: Binds the actuator at the name service
   ** Receives:    Nothing
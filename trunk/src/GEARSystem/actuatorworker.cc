@@ -0,0 +1,317 @@
+/*** GEARSystem - ActuatorWorker implementation
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Includes the class header
+#include <GEARSystem/actuatorworker.hh>
+
+
+// Inlcudes Qt library
+#include <QtCore/QtCore>
+
+// Includes omniORB 4
+#include <omniORB4/CORBA.h>
+
+// Inlcudes IO streams
+#include <iostream>
+
+
+// Selects namespace
+using namespace GEARSystem;
+using std::cerr;
+using std::endl;
+using std::flush;
+
+
+/*** Constructor
+  ** Description: Creates an empty speed command
+  ** Receives:    Nothing
+  ***/
+ActuatorWorker::Command::Command() {
+    type      = SetSpeed;
+    teamNum   = 0;
+    playerNum = 0;
+    x         = 0.0f;
+    y         = 0.0f;
+    value     = 0.0f;
+    enable    = false;
+}
+
+
+/*** Constructor
+  ** Description: Creates the worker and starts its thread
+  ** Receives:    [name]     The actuator name
+                  [actuator] The connected actuator
+  ***/
+ActuatorWorker::ActuatorWorker(const QString& name, const CORBAInterfaces::Actuator_var& actuator) {
+    // Initializes the variables
+    _name         = name;
+    _actuator     = actuator;
+    _timeout      = 0;
+    _oneway       = false;
+    _maxQueueSize = defaultMaxQueueSize;
+    _running      = true;
+
+    // Creates the locks
+    _queueLock     = new QMutex();
+    _queueNotEmpty = new QWaitCondition();
+
+    // Starts the thread
+    start();
+}
+
+/*** Destructor
+  ** Description: Stops the thread, discarding the pending commands, and destroys the worker
+  ** Receives:    Nothing
+  ***/
+ActuatorWorker::~ActuatorWorker() {
+    // Stops the thread
+    _queueLock->lock();
+    _running = false;
+    _queue.clear();
+    _queueNotEmpty->wakeAll();
+    _queueLock->unlock();
+
+    (void) wait();
+
+    // Deletes the locks
+    delete _queueNotEmpty;
+    delete _queueLock;
+}
+
+
+/*** 'enqueue' function
+  ** Description: Queues a command to be sent to the actuator
+  ** Receives:    [command] The command
+  ** Returns:     Nothing
+  ** Comments:    If the queue is full, only speed commands are replaced or dropped
+  ***/
+void ActuatorWorker::enqueue(const Command& command) {
+    // Handles the lock
+    QMutexLocker queueLocker(_queueLock);
+
+    // Makes room if the actuator is falling behind, never dropping events
+    if (_queue.size() >= _maxQueueSize) {
+        // Replaces the speed setpoint queued for the same robot
+        if (command.type == SetSpeed) {
+            for (int i = 0; i < _queue.size(); i++) {
+                const Command& queued = _queue.at(i);
+                if ((queued.type == SetSpeed) && (queued.teamNum == command.teamNum) && (queued.playerNum == command.playerNum)) {
+                    _queue[i] = command;
+                    _queueNotEmpty->wakeOne();
+                    return;
+                }
+            }
+        }
+
+        // Drops the oldest speed command
+        for (int i = 0; i < _queue.size(); i++) {
+            if ((_queue.at(i).type == SetSpeed) || (_queue.at(i).type == SetSpeeds)) {
+                _queue.removeAt(i);
+
+                #ifdef GSDEBUGMSG
+                cerr << ">> GEARSystem: ActuatorWorker::enqueue(const Command&): The queue of actuator '";
+                cerr << _name.toStdString() << "' is full, dropping the oldest speed command!!" << endl << flush;
+                #endif
+                break;
+            }
+        }
+    }
+
+    // Queues the command and wakes the thread
+    _queue.enqueue(command);
+    _queueNotEmpty->wakeOne();
+}
+
+/*** 'pendingCommands' function
+  ** Description: Gets the number of commands waiting to be sent
+  ** Receives:    Nothing
+  ** Returns:     The number of queued commands
+  ***/
+int ActuatorWorker::pendingCommands() const {
+    // Handles the lock
+    QMutexLocker queueLocker(_queueLock);
+
+    return(_queue.size());
+}
+
+/*** 'setMaxQueueSize' function
+  ** Description: Sets the maximum number of queued commands
+  ** Receives:    [size] The queue size
+  ** Returns:     Nothing
+  ***/
+void ActuatorWorker::setMaxQueueSize(int size) {
+    // Handles the lock
+    QMutexLocker queueLocker(_queueLock);
+
+    _maxQueueSize = (size > 0) ? size : 1;
+}
+
+/*** 'setTimeout' function
+  ** Description: Sets the call timeout of the actuator
+  ** Receives:    [timeout] The timeout in milliseconds, or 0 to use the ORB default
+  ** Returns:     Nothing
+  ***/
+void ActuatorWorker::setTimeout(uint32 timeout) {
+    // Handles the lock
+    QMutexLocker queueLocker(_queueLock);
+
+    // Sets the timeout of the object reference
+    _timeout = timeout;
+    omniORB::setClientCallTimeout(_actuator, _timeout);
+}
+
+/*** 'timeout' function
+  ** Description: Gets the call timeout of the actuator
+  ** Receives:    Nothing
+  ** Returns:     The timeout in milliseconds
+  ***/
+uint32 ActuatorWorker::timeout() const {
+    // Handles the lock
+    QMutexLocker queueLocker(_queueLock);
+
+    return(_timeout);
+}
+
+/*** 'setOneway' function
+  ** Description: Selects if the commands are sent as oneway calls
+  ** Receives:    [enable] 'true' to send the commands without waiting for the actuator reply,
+                           'false' to wait for it (the default)
+  ** Returns:     Nothing
+  ***/
+void ActuatorWorker::setOneway(bool enable) {
+    // Handles the lock
+    QMutexLocker queueLocker(_queueLock);
+
+    _oneway = enable;
+}
+
+/*** 'isOneway' function
+  ** Description: Verifies if the commands are sent as oneway calls
+  ** Receives:    Nothing
+  ** Returns:     'true' if they are, 'false' otherwise
+  ***/
+bool ActuatorWorker::isOneway() const {
+    // Handles the lock
+    QMutexLocker queueLocker(_queueLock);
+
+    return(_oneway);
+}
+
+
+/*** 'run' function
+  ** Description: Sends the queued commands until the worker is stopped
+  ** Receives:    Nothing
+  ** Returns:     Nothing
+  ***/
+void ActuatorWorker::run() {
+    forever {
+        // Waits for a command
+        _queueLock->lock();
+        while (_running && _queue.isEmpty()) {
+            (void) _queueNotEmpty->wait(_queueLock);
+        }
+
+        // Leaves if the worker was stopped
+        if (!_running) {
+            _queueLock->unlock();
+            break;
+        }
+
+        // Sends the command without holding the lock
+        Command command = _queue.dequeue();
+        bool oneway = _oneway;
+        _queueLock->unlock();
+
+        send(command, oneway);
+    }
+}
+
+
+/*** 'send' function
+  ** Description: Sends a command to the actuator
+  ** Receives:    [command] The command
+                  [oneway]  'true' to send it as a oneway call
+  ** Returns:     Nothing
+  ***/
+void ActuatorWorker::send(const Command& command, bool oneway) {
+    try {
+        // Oneway calls
+        if (oneway) {
+            switch (command.type) {
+                case SetSpeed:
+                    _actuator->setSpeedAsync(command.teamNum, command.playerNum, command.x, command.y, command.value);
+                    break;
+
+                case SetSpeeds:
+                    _actuator->setSpeedsAsync(*command.commands);
+                    break;
+
+                case Kick:
+                    _actuator->kickAsync(command.teamNum, command.playerNum, command.value);
+                    break;
+
+                case ChipKick:
+                    _actuator->chipKickAsync(command.teamNum, command.playerNum, command.value);
+                    break;
+
+                case KickOnTouch:
+                    _actuator->kickOnTouchAsync(command.teamNum, command.playerNum, command.enable, command.value);
+                    break;
+
+                case ChipKickOnTouch:
+                    _actuator->chipKickOnTouchAsync(command.teamNum, command.playerNum, command.enable, command.value);
+                    break;
+
+                case HoldBall:
+                    _actuator->holdBallAsync(command.teamNum, command.playerNum, command.enable);
+                    break;
+            }
+
+            return;
+        }
+
+        // Two-way calls
+        switch (command.type) {
+            case SetSpeed:
+                _actuator->setSpeed(command.teamNum, command.playerNum, command.x, command.y, command.value);
+                break;
+
+            case SetSpeeds:
+                _actuator->setSpeeds(*command.commands);
+                break;
+
+            case Kick:
+                _actuator->kick(command.teamNum, command.playerNum, command.value);
+                break;
+
+            case ChipKick:
+                _actuator->chipKick(command.teamNum, command.playerNum, command.value);
+                break;
+
+            case KickOnTouch:
+                _actuator->kickOnTouch(command.teamNum, command.playerNum, command.enable, command.value);
+                break;
+
+            case ChipKickOnTouch:
+                _actuator->chipKickOnTouch(command.teamNum, command.playerNum, command.enable, command.value);
+                break;
+
+            case HoldBall:
+                _actuator->holdBall(command.teamNum, command.playerNum, command.enable);
+                break;
+        }
+    }
+
+    // Handles CORBA exceptions (including timeouts)
+    catch (const CORBA::Exception& exception) {
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: ActuatorWorker::send(const Command&): Caught CORBA exception from actuator '";
+        cerr << _name.toStdString() << "': " << exception._name() << "!!" << endl << flush;
+        #endif
+    }
+}
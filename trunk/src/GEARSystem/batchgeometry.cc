@@ -0,0 +1,532 @@
+/*** GEARSystem - BatchGeometry implementation
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Includes the class header
+#include <GEARSystem/batchgeometry.hh>
+
+// Includes math library
+#include <cmath>
+#include <limits>
+
+// Includes SIMD intrinsics (the instruction set follows the compiler target)
+#if !defined(GSNOSIMD) && defined(__AVX__)
+    #define GSSIMD
+    #include <immintrin.h>
+#elif !defined(GSNOSIMD) && defined(__SSE2__)
+    #define GSSIMD
+    #include <emmintrin.h>
+#endif
+
+
+// Selects namespace
+using namespace GEARSystem;
+
+
+namespace {
+    // Angle constants
+    const float pi     = 3.14159265358979323846f;
+    const float halfPi = 1.57079632679489661923f;
+    const float twoPi  = 6.28318530717958647692f;
+
+    // Arc tangent polynomial coefficients, for arguments in [0, 1]
+    const float arcTan0 =  0.99997726f;
+    const float arcTan1 = -0.33262347f;
+    const float arcTan2 =  0.19354346f;
+    const float arcTan3 = -0.11643287f;
+    const float arcTan4 =  0.05265332f;
+    const float arcTan5 = -0.01172120f;
+
+
+    /*** 'bearing' function
+      ** Description: Approximates the direction of a vector, as the vector kernel does
+      ** Receives:    [dx] The vector x component
+                      [dy] The vector y component
+      ** Returns:     The angle, in the range 0 <= angle < 2*Pi
+      ***/
+    inline float bearing(float dx, float dy) {
+        const float ax = std::fabs(dx);
+        const float ay = std::fabs(dy);
+        const float hi = (ax > ay)? ax : ay;
+        const float lo = (ax > ay)? ay : ax;
+        const float a  = (hi > 0.0f)? lo/hi : 0.0f;
+        const float s  = a*a;
+
+        // Folds the octant back
+        float angle = a*(arcTan0 + s*(arcTan1 + s*(arcTan2 + s*(arcTan3 + s*(arcTan4 + s*arcTan5)))));
+        if (ay > ax)    angle = halfPi - angle;
+        if (dx < 0.0f)  angle = pi - angle;
+        if (dy < 0.0f)  angle = -angle;
+        if (angle < 0.0f) angle += twoPi;
+        return(angle);
+    }
+
+
+    #ifdef GSSIMD
+    /*** 'Lanes' struct
+      ** Description: Thin wrappers over the vector instructions, so each kernel is written once
+      ***/
+    #ifdef __AVX__
+    struct Lanes {
+        typedef __m256 Vector;
+        static const int width = 8;
+
+        static Vector set(float value)                  { return(_mm256_set1_ps(value)); }
+        static Vector load(const float* values)         { return(_mm256_loadu_ps(values)); }
+        static void   store(float* values, Vector v)    { _mm256_storeu_ps(values, v); }
+        static Vector add(Vector a, Vector b)           { return(_mm256_add_ps(a, b)); }
+        static Vector sub(Vector a, Vector b)           { return(_mm256_sub_ps(a, b)); }
+        static Vector mul(Vector a, Vector b)           { return(_mm256_mul_ps(a, b)); }
+        static Vector div(Vector a, Vector b)           { return(_mm256_div_ps(a, b)); }
+        static Vector min(Vector a, Vector b)           { return(_mm256_min_ps(a, b)); }
+        static Vector max(Vector a, Vector b)           { return(_mm256_max_ps(a, b)); }
+        static Vector sqrt(Vector v)                    { return(_mm256_sqrt_ps(v)); }
+        static Vector floor(Vector v)                   { return(_mm256_floor_ps(v)); }
+        static Vector abs(Vector v)                     { return(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), v)); }
+        static Vector bitAnd(Vector a, Vector b)        { return(_mm256_and_ps(a, b)); }
+        static Vector bitXor(Vector a, Vector b)        { return(_mm256_xor_ps(a, b)); }
+        static Vector greater(Vector a, Vector b)       { return(_mm256_cmp_ps(a, b, _CMP_GT_OQ)); }
+        static Vector less(Vector a, Vector b)          { return(_mm256_cmp_ps(a, b, _CMP_LT_OQ)); }
+        static Vector select(Vector m, Vector a, Vector b) { return(_mm256_blendv_ps(b, a, m)); }
+        static int    mask(Vector m)                    { return(_mm256_movemask_ps(m)); }
+    };
+    #else
+    struct Lanes {
+        typedef __m128 Vector;
+        static const int width = 4;
+
+        static Vector set(float value)                  { return(_mm_set1_ps(value)); }
+        static Vector load(const float* values)         { return(_mm_loadu_ps(values)); }
+        static void   store(float* values, Vector v)    { _mm_storeu_ps(values, v); }
+        static Vector add(Vector a, Vector b)           { return(_mm_add_ps(a, b)); }
+        static Vector sub(Vector a, Vector b)           { return(_mm_sub_ps(a, b)); }
+        static Vector mul(Vector a, Vector b)           { return(_mm_mul_ps(a, b)); }
+        static Vector div(Vector a, Vector b)           { return(_mm_div_ps(a, b)); }
+        static Vector min(Vector a, Vector b)           { return(_mm_min_ps(a, b)); }
+        static Vector max(Vector a, Vector b)           { return(_mm_max_ps(a, b)); }
+        static Vector sqrt(Vector v)                    { return(_mm_sqrt_ps(v)); }
+        static Vector abs(Vector v)                     { return(_mm_andnot_ps(_mm_set1_ps(-0.0f), v)); }
+        static Vector bitAnd(Vector a, Vector b)        { return(_mm_and_ps(a, b)); }
+        static Vector bitXor(Vector a, Vector b)        { return(_mm_xor_ps(a, b)); }
+        static Vector greater(Vector a, Vector b)       { return(_mm_cmpgt_ps(a, b)); }
+        static Vector less(Vector a, Vector b)          { return(_mm_cmplt_ps(a, b)); }
+        static Vector select(Vector m, Vector a, Vector b) { return(_mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b))); }
+        static int    mask(Vector m)                    { return(_mm_movemask_ps(m)); }
+
+        // SSE2 has no rounding instruction: truncates and steps down the negative values
+        static Vector floor(Vector v) {
+            const Vector truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(v));
+            return(_mm_sub_ps(truncated, _mm_and_ps(_mm_cmpgt_ps(truncated, v), _mm_set1_ps(1.0f))));
+        }
+    };
+    #endif
+
+    /*** 'bearing' function
+      ** Description: Approximates the direction of vectors
+      ** Receives:    [dx] The vectors x components
+                      [dy] The vectors y components
+      ** Returns:     The angles, in the range 0 <= angle < 2*Pi
+      ***/
+    inline Lanes::Vector bearing(Lanes::Vector dx, Lanes::Vector dy) {
+        const Lanes::Vector zero = Lanes::set(0.0f);
+        const Lanes::Vector ax   = Lanes::abs(dx);
+        const Lanes::Vector ay   = Lanes::abs(dy);
+        const Lanes::Vector hi   = Lanes::max(ax, ay);
+        const Lanes::Vector lo   = Lanes::min(ax, ay);
+        const Lanes::Vector a    = Lanes::select(Lanes::greater(hi, zero), Lanes::div(lo, hi), zero);
+        const Lanes::Vector s    = Lanes::mul(a, a);
+
+        // Evaluates the polynomial
+        Lanes::Vector angle = Lanes::add(Lanes::set(arcTan4), Lanes::mul(s, Lanes::set(arcTan5)));
+        angle = Lanes::add(Lanes::set(arcTan3), Lanes::mul(s, angle));
+        angle = Lanes::add(Lanes::set(arcTan2), Lanes::mul(s, angle));
+        angle = Lanes::add(Lanes::set(arcTan1), Lanes::mul(s, angle));
+        angle = Lanes::mul(a, Lanes::add(Lanes::set(arcTan0), Lanes::mul(s, angle)));
+
+        // Folds the octant back
+        angle = Lanes::select(Lanes::greater(ay, ax), Lanes::sub(Lanes::set(halfPi), angle), angle);
+        angle = Lanes::select(Lanes::less(dx, zero), Lanes::sub(Lanes::set(pi), angle), angle);
+        angle = Lanes::select(Lanes::less(dy, zero), Lanes::sub(zero, angle), angle);
+        return(Lanes::select(Lanes::less(angle, zero), Lanes::add(angle, Lanes::set(twoPi)), angle));
+    }
+    #endif
+}
+
+
+/*** 'instructionSet' function
+  ** Description: Gets the instruction set the kernels were built with
+  ** Receives:    Nothing
+  ** Returns:     "AVX", "SSE2" or "scalar"
+  ***/
+const char* BatchGeometry::instructionSet() {
+    #if defined(GSSIMD) && defined(__AVX__)
+    return("AVX");
+    #elif defined(GSSIMD)
+    return("SSE2");
+    #else
+    return("scalar");
+    #endif
+}
+
+
+/*** Distances functions
+  ** Description: Calculates the distances (or squared distances) from a point to each point of an array
+  ** Receives:    [x]      The points x coordinates
+                  [y]      The points y coordinates
+                  [n]      The number of points
+                  [pointX] The reference point x coordinate
+                  [pointY] The reference point y coordinate
+                  [result] Where the distances will be stored
+  ** Returns:     Nothing
+  ***/
+void BatchGeometry::distances(const float* x, const float* y, int n, float pointX, float pointY, float* result) {
+    int i = 0;
+
+    // Vector part
+    #ifdef GSSIMD
+    const Lanes::Vector px = Lanes::set(pointX);
+    const Lanes::Vector py = Lanes::set(pointY);
+    for (; i+Lanes::width <= n; i += Lanes::width) {
+        const Lanes::Vector dx = Lanes::sub(Lanes::load(x+i), px);
+        const Lanes::Vector dy = Lanes::sub(Lanes::load(y+i), py);
+        Lanes::store(result+i, Lanes::sqrt(Lanes::add(Lanes::mul(dx, dx), Lanes::mul(dy, dy))));
+    }
+    #endif
+
+    // Remaining points
+    for (; i < n; i++) {
+        const float dx = x[i]-pointX;
+        const float dy = y[i]-pointY;
+        result[i] = std::sqrt(dx*dx + dy*dy);
+    }
+}
+
+void BatchGeometry::squaredDistances(const float* x, const float* y, int n, float pointX, float pointY, float* result) {
+    int i = 0;
+
+    // Vector part
+    #ifdef GSSIMD
+    const Lanes::Vector px = Lanes::set(pointX);
+    const Lanes::Vector py = Lanes::set(pointY);
+    for (; i+Lanes::width <= n; i += Lanes::width) {
+        const Lanes::Vector dx = Lanes::sub(Lanes::load(x+i), px);
+        const Lanes::Vector dy = Lanes::sub(Lanes::load(y+i), py);
+        Lanes::store(result+i, Lanes::add(Lanes::mul(dx, dx), Lanes::mul(dy, dy)));
+    }
+    #endif
+
+    // Remaining points
+    for (; i < n; i++) {
+        const float dx = x[i]-pointX;
+        const float dy = y[i]-pointY;
+        result[i] = dx*dx + dy*dy;
+    }
+}
+
+/*** 'pairwiseDistances' function
+  ** Description: Calculates the distances between every point of two arrays
+  ** Receives:    [ax]     The first points x coordinates
+                  [ay]     The first points y coordinates
+                  [na]     The number of first points
+                  [bx]     The second points x coordinates
+                  [by]     The second points y coordinates
+                  [nb]     The number of second points
+                  [result] Where the na*nb distances will be stored
+  ** Returns:     Nothing
+  ***/
+void BatchGeometry::pairwiseDistances(const float* ax, const float* ay, int na, const float* bx, const float* by, int nb, float* result) {
+    // Each row is a point-to-array kernel
+    for (int i = 0; i < na; i++) {
+        distances(bx, by, nb, ax[i], ay[i], result + i*nb);
+    }
+}
+
+/*** 'segmentDistances' function
+  ** Description: Calculates the distances from each point of an array to a segment
+  ** Receives:    [x]      The points x coordinates
+                  [y]      The points y coordinates
+                  [n]      The number of points
+                  [ax]     The segment start x coordinate
+                  [ay]     The segment start y coordinate
+                  [bx]     The segment end x coordinate
+                  [by]     The segment end y coordinate
+                  [result] Where the distances will be stored
+  ** Returns:     Nothing
+  ***/
+void BatchGeometry::segmentDistances(const float* x, const float* y, int n, float ax, float ay, float bx, float by, float* result) {
+    // Segment direction (a degenerate segment projects everything on its start)
+    const float dx       = bx-ax;
+    const float dy       = by-ay;
+    const float length2  = dx*dx + dy*dy;
+    const float invLength2 = (length2 > 0.0f)? 1.0f/length2 : 0.0f;
+
+    int i = 0;
+
+    // Vector part
+    #ifdef GSSIMD
+    const Lanes::Vector vax  = Lanes::set(ax);
+    const Lanes::Vector vay  = Lanes::set(ay);
+    const Lanes::Vector vdx  = Lanes::set(dx);
+    const Lanes::Vector vdy  = Lanes::set(dy);
+    const Lanes::Vector vinv = Lanes::set(invLength2);
+    const Lanes::Vector zero = Lanes::set(0.0f);
+    const Lanes::Vector one  = Lanes::set(1.0f);
+    for (; i+Lanes::width <= n; i += Lanes::width) {
+        const Lanes::Vector px = Lanes::sub(Lanes::load(x+i), vax);
+        const Lanes::Vector py = Lanes::sub(Lanes::load(y+i), vay);
+        Lanes::Vector t = Lanes::mul(Lanes::add(Lanes::mul(px, vdx), Lanes::mul(py, vdy)), vinv);
+        t = Lanes::min(Lanes::max(t, zero), one);
+        const Lanes::Vector ex = Lanes::sub(px, Lanes::mul(t, vdx));
+        const Lanes::Vector ey = Lanes::sub(py, Lanes::mul(t, vdy));
+        Lanes::store(result+i, Lanes::sqrt(Lanes::add(Lanes::mul(ex, ex), Lanes::mul(ey, ey))));
+    }
+    #endif
+
+    // Remaining points
+    for (; i < n; i++) {
+        const float px = x[i]-ax;
+        const float py = y[i]-ay;
+        const float t  = qBound(0.0f, (px*dx + py*dy)*invLength2, 1.0f);
+        const float ex = px - t*dx;
+        const float ey = py - t*dy;
+        result[i] = std::sqrt(ex*ex + ey*ey);
+    }
+}
+
+/*** 'bearings' function
+  ** Description: Calculates the direction from a point to each point of an array
+  ** Receives:    [x]      The points x coordinates
+                  [y]      The points y coordinates
+                  [n]      The number of points
+                  [fromX]  The origin x coordinate
+                  [fromY]  The origin y coordinate
+                  [result] Where the angles will be stored
+  ** Returns:     Nothing
+  ***/
+void BatchGeometry::bearings(const float* x, const float* y, int n, float fromX, float fromY, float* result) {
+    int i = 0;
+
+    // Vector part
+    #ifdef GSSIMD
+    const Lanes::Vector fx = Lanes::set(fromX);
+    const Lanes::Vector fy = Lanes::set(fromY);
+    for (; i+Lanes::width <= n; i += Lanes::width) {
+        Lanes::store(result+i, bearing(Lanes::sub(Lanes::load(x+i), fx), Lanes::sub(Lanes::load(y+i), fy)));
+    }
+    #endif
+
+    // Remaining points
+    for (; i < n; i++) {
+        result[i] = bearing(x[i]-fromX, y[i]-fromY);
+    }
+}
+
+
+/*** 'normalizeAngles' function
+  ** Description: Brings angles to the range 0 <= angle < 2*Pi
+  ** Receives:    [angles] The angles
+                  [n]      The number of angles
+                  [result] Where the normalized angles will be stored
+  ** Returns:     Nothing
+  ***/
+void BatchGeometry::normalizeAngles(const float* angles, int n, float* result) {
+    const float invTwoPi = 1.0f/twoPi;
+    int i = 0;
+
+    // Vector part
+    #ifdef GSSIMD
+    const Lanes::Vector zero  = Lanes::set(0.0f);
+    const Lanes::Vector turn  = Lanes::set(twoPi);
+    const Lanes::Vector scale = Lanes::set(invTwoPi);
+    for (; i+Lanes::width <= n; i += Lanes::width) {
+        const Lanes::Vector value = Lanes::load(angles+i);
+        Lanes::Vector angle = Lanes::sub(value, Lanes::mul(turn, Lanes::floor(Lanes::mul(value, scale))));
+
+        // Fixes the rounding at the range ends
+        angle = Lanes::select(Lanes::less(angle, turn), angle, Lanes::sub(angle, turn));
+        angle = Lanes::select(Lanes::less(angle, zero), Lanes::add(angle, turn), angle);
+        Lanes::store(result+i, angle);
+    }
+    #endif
+
+    // Remaining angles
+    for (; i < n; i++) {
+        float angle = angles[i] - twoPi*std::floor(angles[i]*invTwoPi);
+        if (!(angle < twoPi)) angle -= twoPi;
+        if (angle < 0.0f)     angle += twoPi;
+        result[i] = angle;
+    }
+}
+
+/*** 'angleDifferences' function
+  ** Description: Calculates the difference of each pair of angles, as 'Angle::difference' does
+  ** Receives:    [a]      The first angles (normalized)
+                  [b]      The second angles (normalized)
+                  [n]      The number of angles
+                  [result] Where the differences will be stored
+  ** Returns:     Nothing
+  ***/
+void BatchGeometry::angleDifferences(const float* a, const float* b, int n, float* result) {
+    int i = 0;
+
+    // Vector part
+    #ifdef GSSIMD
+    const Lanes::Vector turn   = Lanes::set(twoPi);
+    const Lanes::Vector upper  = Lanes::set(pi);
+    const Lanes::Vector lower  = Lanes::set(-pi);
+    for (; i+Lanes::width <= n; i += Lanes::width) {
+        Lanes::Vector difference = Lanes::sub(Lanes::load(a+i), Lanes::load(b+i));
+        difference = Lanes::select(Lanes::greater(difference, upper), Lanes::sub(difference, turn), difference);
+        difference = Lanes::select(Lanes::less(difference, lower), Lanes::add(difference, turn), difference);
+        Lanes::store(result+i, difference);
+    }
+    #endif
+
+    // Remaining angles
+    for (; i < n; i++) {
+        float difference = a[i]-b[i];
+        if (difference > pi)       difference -= twoPi;
+        else if (difference < -pi) difference += twoPi;
+        result[i] = difference;
+    }
+}
+
+
+/*** 'pointsInPolygon' function
+  ** Description: Tests if each point of an array is inside a polygon
+  ** Receives:    [x]         The points x coordinates
+                  [y]         The points y coordinates
+                  [n]         The number of points
+                  [polygonX]  The polygon vertices x coordinates
+                  [polygonY]  The polygon vertices y coordinates
+                  [nVertices] The number of vertices
+                  [result]    Where the results will be stored
+  ** Returns:     Nothing
+  ***/
+void BatchGeometry::pointsInPolygon(const float* x, const float* y, int n, const float* polygonX, const float* polygonY, int nVertices, bool* result) {
+    int i = 0;
+
+    // Vector part (each edge toggles the points whose rightwards ray crosses it)
+    #ifdef GSSIMD
+    for (; i+Lanes::width <= n; i += Lanes::width) {
+        const Lanes::Vector px = Lanes::load(x+i);
+        const Lanes::Vector py = Lanes::load(y+i);
+        Lanes::Vector inside = Lanes::set(0.0f);
+        for (int j = 0, k = nVertices-1; j < nVertices; k = j++) {
+            // Horizontal edges get an infinite slope, but their crossing condition is always false
+            const float slope = (polygonX[k]-polygonX[j])/(polygonY[k]-polygonY[j]);
+            const Lanes::Vector yj = Lanes::set(polygonY[j]);
+            const Lanes::Vector spans = Lanes::bitXor(Lanes::greater(yj, py), Lanes::greater(Lanes::set(polygonY[k]), py));
+            const Lanes::Vector crossX = Lanes::add(Lanes::set(polygonX[j]), Lanes::mul(Lanes::set(slope), Lanes::sub(py, yj)));
+            inside = Lanes::bitXor(inside, Lanes::bitAnd(spans, Lanes::less(px, crossX)));
+        }
+
+        // Unpacks the lanes
+        const int mask = Lanes::mask(inside);
+        for (int lane = 0; lane < Lanes::width; lane++) {
+            result[i+lane] = (mask >> lane) & 1;
+        }
+    }
+    #endif
+
+    // Remaining points
+    for (; i < n; i++) {
+        bool inside = false;
+        for (int j = 0, k = nVertices-1; j < nVertices; k = j++) {
+            if ((polygonY[j] > y[i]) != (polygonY[k] > y[i])) {
+                const float slope = (polygonX[k]-polygonX[j])/(polygonY[k]-polygonY[j]);
+                if (x[i] < polygonX[j] + slope*(y[i]-polygonY[j])) {
+                    inside = !inside;
+                }
+            }
+        }
+        result[i] = inside;
+    }
+}
+
+/*** 'pointsInField' function
+  ** Description: Tests if each point of an array is inside the area bounded by the field corners
+  ** Receives:    [x]      The points x coordinates
+                  [y]      The points y coordinates
+                  [n]      The number of points
+                  [field]  The field
+                  [result] Where the results will be stored
+  ** Returns:     Nothing
+  ***/
+void BatchGeometry::pointsInField(const float* x, const float* y, int n, const Field& field, bool* result) {
+    // Gets the corners, in order around the field
+    const Position corners[4] = {field.topLeftCorner(), field.topRightCorner(),
+                                 field.bottomRightCorner(), field.bottomLeftCorner()};
+    float polygonX[4];
+    float polygonY[4];
+    for (int i = 0; i < 4; i++) {
+        // No point is inside an unknown field
+        if (corners[i].isUnknown() || !corners[i].isValid()) {
+            for (int j = 0; j < n; j++) {
+                result[j] = false;
+            }
+            return;
+        }
+
+        polygonX[i] = corners[i].x();
+        polygonY[i] = corners[i].y();
+    }
+
+    // Tests the points
+    pointsInPolygon(x, y, n, polygonX, polygonY, 4, result);
+}
+
+
+/*** 'packPlayers' function
+  ** Description: Copies the known players positions and orientations of a snapshot into arrays that can
+                  be given to the kernels
+  ** Receives:    [snapshot]    The snapshot
+                  [teams]       The teams copied (an empty bitmap copies all teams)
+                  [x]           Where the x coordinates will be stored
+                  [y]           Where the y coordinates will be stored
+                  [orientation] Where the orientations will be stored (NaN if unknown), or NULL
+                  [players]     Where the team and player numbers will be stored, as (team << 8) | player
+  ** Returns:     The number of players copied
+  ***/
+int BatchGeometry::packPlayers(const WorldSnapshot& snapshot, const IdBitmap& teams, QVector<float>* x, QVector<float>* y,
+                               QVector<float>* orientation, QVector<quint16>* players) {
+    x->clear();
+    y->clear();
+    players->clear();
+    if (orientation != NULL) {
+        orientation->clear();
+    }
+
+    // Copies the players
+    const bool allTeams = teams.isEmpty();
+    const QList<uint8> snapshotTeams = snapshot.teams();
+    for (int i = 0; i < snapshotTeams.size(); i++) {
+        const uint8 teamNum = snapshotTeams.at(i);
+        if (!allTeams && !teams.test(teamNum)) {
+            continue;
+        }
+
+        const QList<uint8> teamPlayers = snapshot.players(teamNum);
+        for (int j = 0; j < teamPlayers.size(); j++) {
+            const Position& position = snapshot.playerPosition(teamNum, teamPlayers.at(j));
+            if (position.isUnknown() || !position.isValid()) {
+                continue;
+            }
+
+            x->append(position.x());
+            y->append(position.y());
+            players->append((quint16(teamNum) << 8) | teamPlayers.at(j));
+            if (orientation != NULL) {
+                const Angle& angle = snapshot.playerOrientation(teamNum, teamPlayers.at(j));
+                orientation->append((angle.isUnknown() || !angle.isValid())? std::numeric_limits<float>::quiet_NaN() : angle.value());
+            }
+        }
+    }
+
+    // Returns the number of players
+    return(players->size());
+}
@@ -32,47 +32,186 @@ CommandBus::CommandBus() {
     // Initializes the variables
     _nActuators = 0;
     _validActuators.clear();
-    _actuators.clear();
+    _workers.clear();
+    _ownership.clear();
+    _defaultTimeout = 0;
+    _oneway         = false;
+    _coalescer      = NULL;
+}
 
-    // Creates the locks
-    #ifdef GSTHREADSAFE
-    _actuatorsLock = new QReadWriteLock();
-    #endif
+/*** Destructor
+  ** Description: Stops the actuator workers and destroys the bus
+  ** Receives:    Nothing
+  ***/
+CommandBus::~CommandBus() {
+    // Stops the coalescer, sending its last commands
+    delete _coalescer;
+    _coalescer = NULL;
+
+    // Stops the workers
+    qDeleteAll(_workers);
+    _workers.clear();
+    _ownership.clear();
 }
 
 
 /*** Actuators handling functions
   ** Description: Handles the actuators
-  ** Receives:    [name]    The actuator name
-                  [address] The actuator address
+  ** Receives:    [name]      The actuator name
+                  [address]   The actuator address
+                  [ownership] The teams and players the actuator drives
+                              (if omitted or empty, it receives every command)
   ** Returns:     Nothing
   ***/
 void CommandBus::addActuator(const QString& name, const QString& address) {
-    // Handles the lock
-    #ifdef GSTHREADSAFE
-    QWriteLocker actuatorsLocker(_actuatorsLock);
-    #endif
+    addActuator(name, address, ActuatorOwnership());
+}
 
-    // Adds the actuator
+void CommandBus::addActuator(const QString& name, const QString& address, const ActuatorOwnership& ownership) {
+    // Connects to the actuator without holding the lock, since it is a remote call
     CORBAInterfaces::Actuator_var actuator = connectToActuator(address);
-    if (actuator) {
-        (void) _actuators.remove(name);
+    if (!actuator) {
+        return;
+    }
+
+    // Creates the actuator worker
+    ActuatorWorker* worker = new ActuatorWorker(name, actuator);
+    ActuatorWorker* oldWorker;
+
+    // Replaces the actuator
+    {
+        WriteLocker actuatorsLocker(_actuatorsLock);
+
+        if (_defaultTimeout > 0) {
+            worker->setTimeout(_defaultTimeout);
+        }
+        worker->setOneway(_oneway);
+
+        oldWorker = _workers.take(name);
+        if (oldWorker == NULL) {
+            _nActuators++;
+        }
         (void) _validActuators.insert(name, true);
-        _actuators[name] = actuator;
-        _nActuators++;
+        _workers[name]   = worker;
+        _ownership[name] = ownership;
     }
+
+    // Stops the old worker without holding the lock, since it waits for its thread
+    delete oldWorker;
 }
 
 void CommandBus::delActuator(const QString& name) {
-    // Handles the lock
-    #ifdef GSTHREADSAFE
-    QWriteLocker actuatorsLocker(_actuatorsLock);
-    #endif
+    ActuatorWorker* oldWorker;
 
     // Deletes the actuator
-    (void) _validActuators.remove(name);
-    (void) _actuators.remove(name);
-    _nActuators--;
+    {
+        WriteLocker actuatorsLocker(_actuatorsLock);
+
+        (void) _validActuators.remove(name);
+        (void) _ownership.remove(name);
+        oldWorker = _workers.take(name);
+        if (oldWorker != NULL) {
+            _nActuators--;
+        }
+    }
+
+    // Stops the worker without holding the lock, since it waits for its thread
+    delete oldWorker;
+}
+
+/*** 'setActuatorTimeout' function
+  ** Description: Sets the call timeout of an actuator
+  ** Receives:    [name]    The actuator name
+                  [timeout] The timeout in milliseconds, or 0 to use the ORB default
+  ** Returns:     Nothing
+  ***/
+void CommandBus::setActuatorTimeout(const QString& name, uint32 timeout) {
+    // Handles the lock
+    ReadLocker actuatorsLocker(_actuatorsLock);
+
+    // Sets the timeout
+    ActuatorWorker* worker = _workers.value(name, NULL);
+    if (worker) {
+        worker->setTimeout(timeout);
+    }
+}
+
+/*** 'setDefaultTimeout' function
+  ** Description: Sets the call timeout given to the actuators added from now on
+  ** Receives:    [timeout] The timeout in milliseconds, or 0 to use the ORB default
+  ** Returns:     Nothing
+  ***/
+void CommandBus::setDefaultTimeout(uint32 timeout) {
+    // Handles the lock
+    WriteLocker actuatorsLocker(_actuatorsLock);
+
+    _defaultTimeout = timeout;
+}
+
+/*** 'setAsynchronousCommands' function
+  ** Description: Selects if the commands are sent to the actuators as oneway calls
+  ** Receives:    [enable] 'true' to send the commands without waiting for the actuators replies,
+                           'false' to wait for them (the default)
+  ** Returns:     Nothing
+  ***/
+void CommandBus::setAsynchronousCommands(bool enable) {
+    // Handles the lock
+    WriteLocker actuatorsLocker(_actuatorsLock);
+
+    // Updates the existing workers
+    _oneway = enable;
+    QHashIterator<QString,ActuatorWorker*> it(_workers);
+    while (it.hasNext()) {
+        it.next().value()->setOneway(enable);
+    }
+}
+
+/*** 'setCoalescingRate' function
+  ** Description: Enables or disables the coalescing of speed commands
+  ** Receives:    [rate] The rate (in Hz) the latest speed of each player is sent to the actuators,
+                         or 0 to send every speed command as soon as it arrives (the default)
+  ** Returns:     Nothing
+  ** Comments:    When enabled, only the latest speed of each player is kept between two ticks.
+                  Kicks and ball holding commands are never coalesced
+  ***/
+void CommandBus::setCoalescingRate(float rate) {
+    CommandCoalescer* oldCoalescer;
+
+    // Replaces the coalescer
+    {
+        WriteLocker actuatorsLocker(_actuatorsLock);
+
+        oldCoalescer = _coalescer;
+        _coalescer   = (rate > 0.0f) ? new CommandCoalescer(this, rate) : NULL;
+    }
+
+    // Stops the old one without holding the lock, since its last flush takes it
+    delete oldCoalescer;
+}
+
+/*** 'coalescingRate' function
+  ** Description: Gets the coalescing rate of speed commands
+  ** Receives:    Nothing
+  ** Returns:     The rate in Hz, or 0 if coalescing is disabled
+  ***/
+float CommandBus::coalescingRate() const {
+    // Handles the lock
+    ReadLocker actuatorsLocker(_actuatorsLock);
+
+    return((_coalescer != NULL) ? _coalescer->rate() : 0.0f);
+}
+
+/*** 'pendingCommands' function
+  ** Description: Gets the number of commands not yet sent to an actuator
+  ** Receives:    [name] The actuator name
+  ** Returns:     The number of queued commands
+  ***/
+int CommandBus::pendingCommands(const QString& name) const {
+    // Handles the lock
+    ReadLocker actuatorsLocker(_actuatorsLock);
+
+    ActuatorWorker* worker = _workers.value(name, NULL);
+    return((worker != NULL) ? worker->pendingCommands() : 0);
 }
 
 
@@ -86,25 +225,117 @@ void CommandBus::delActuator(const QString& name) {
   ** Returns:     Nothing
   ***/
 void CommandBus::setSpeed(uint8 teamNum, uint8 playerNum, float x, float y, float theta) const {
+    // Leaves the command to the coalescer, if enabled
+    if (coalesce(RobotCommand(teamNum, playerNum, x, y, theta))) {
+        return;
+    }
+
+    // Queues the command on all actuators
+    ActuatorWorker::Command command;
+    command.type      = ActuatorWorker::SetSpeed;
+    command.teamNum   = teamNum;
+    command.playerNum = playerNum;
+    command.x         = x;
+    command.y         = y;
+    command.value     = theta;
+    dispatch(command);
+}
+
+/*** 'setSpeeds'
+  ** Description: Sets the speed of several players at once
+  ** Receives:    [commands] The speed commands
+  ** Returns:     Nothing
+  ** Comments:    Each actuator receives all the commands of its players in a single call
+  ***/
+void CommandBus::setSpeeds(const QList<RobotCommand>& commands) const {
+    // Leaves the commands to the coalescer, if enabled
+    if (!coalesce(commands)) {
+        sendSpeeds(commands);
+    }
+}
+
+
+/*** 'coalesce' function
+  ** Description: Hands speed commands to the coalescer, if coalescing is enabled
+  ** Receives:    [command]  The speed command
+                  [commands] The speed commands
+  ** Returns:     'true' if the commands were coalesced, 'false' if they must be sent now
+  ***/
+bool CommandBus::coalesce(const RobotCommand& command) const {
+    // Handles the lock
+    ReadLocker actuatorsLocker(_actuatorsLock);
+
+    if (_coalescer == NULL) {
+        return(false);
+    }
+
+    _coalescer->store(command);
+    return(true);
+}
+
+bool CommandBus::coalesce(const QList<RobotCommand>& commands) const {
+    // Handles the lock
+    ReadLocker actuatorsLocker(_actuatorsLock);
+
+    if (_coalescer == NULL) {
+        return(false);
+    }
+
+    _coalescer->store(commands);
+    return(true);
+}
+
+/*** 'sendSpeeds' function
+  ** Description: Queues speed commands on the workers of the actuators that own their players
+  ** Receives:    [commands] The speed commands
+  ** Returns:     Nothing
+  ***/
+void CommandBus::sendSpeeds(const QList<RobotCommand>& commands) const {
+    // Converts the commands only once, sharing them between the actuators that own every player
+    std::shared_ptr<CORBATypes::RobotCommandSeq> corbaCommands(new CORBATypes::RobotCommandSeq());
+    RobotCommand::toCORBA(commands, corbaCommands.get());
+
+    ActuatorWorker::Command command;
+    command.type = ActuatorWorker::SetSpeeds;
+
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    QReadLocker actuatorsLocker(_actuatorsLock);
-    #endif
+    ReadLocker actuatorsLocker(_actuatorsLock);
 
-    // Sends the command to all actuators
-    QHashIterator<QString,CORBAInterfaces::Actuator_var> it(_actuators);
+    // Queues on each actuator the commands of its players
+    QHashIterator<QString,ActuatorWorker*> it(_workers);
     while (it.hasNext()) {
-        try {
-            it.next().value()->setSpeed(teamNum, playerNum, x, y, theta);
+        it.next();
+        const ActuatorOwnership& ownership = *_ownership.constFind(it.key());
+
+        // Actuators that own every player share the whole batch
+        if (ownership.isEmpty()) {
+            command.commands = corbaCommands;
         }
 
-        // Handles CORBA exceptions
-        catch (const CORBA::Exception& exception) {
-            #ifdef GSDEBUGMSG
-            cerr << ">> GEARSystem: CommandBus::setSpeed(uint8, uint8, float, float, float): ";
-            cerr << "Caught CORBA exception: " << exception._name() << "!!" << endl << flush;
-            #endif
+        // Others receive only their players' commands
+        else {
+            QList<RobotCommand> owned;
+            for (int i = 0; i < commands.size(); i++) {
+                if (ownership.owns(commands.at(i).teamNum(), commands.at(i).playerNum())) {
+                    owned.append(commands.at(i));
+                }
+            }
+
+            // Skips actuators with nothing to send
+            if (owned.isEmpty()) {
+                continue;
+            }
+            else if (owned.size() == commands.size()) {
+                command.commands = corbaCommands;
+            }
+            else {
+                std::shared_ptr<CORBATypes::RobotCommandSeq> ownedCommands(new CORBATypes::RobotCommandSeq());
+                RobotCommand::toCORBA(owned, ownedCommands.get());
+                command.commands = ownedCommands;
+            }
         }
+
+        it.value()->enqueue(command);
     }
 }
 
@@ -116,16 +347,13 @@ void CommandBus::setSpeed(uint8 teamNum, uint8 playerNum, float x, float y, floa
   ** Returns:     Nothing
   ***/
 void CommandBus::kick(uint8 teamNum, uint8 playerNum, float power) const {
-    // Handles the lock
-    #ifdef GSTHREADSAFE
-    QReadLocker actuatorsLocker(_actuatorsLock);
-    #endif
-
-    // Sends the command to all actuators
-    QHashIterator<QString,CORBAInterfaces::Actuator_var> it(_actuators);
-    while (it.hasNext()) {
-        it.next().value()->kick(teamNum, playerNum, power);
-    }
+    // Queues the command on all actuators
+    ActuatorWorker::Command command;
+    command.type      = ActuatorWorker::Kick;
+    command.teamNum   = teamNum;
+    command.playerNum = playerNum;
+    command.value     = power;
+    dispatch(command);
 }
 
 /*** 'chipKick'
@@ -136,16 +364,13 @@ void CommandBus::kick(uint8 teamNum, uint8 playerNum, float power) const {
   ** Returns:     Nothing
   ***/
 void CommandBus::chipKick(uint8 teamNum, uint8 playerNum, float power) const {
-    // Handles the lock
-    #ifdef GSTHREADSAFE
-    QReadLocker actuatorsLocker(_actuatorsLock);
-    #endif
-
-    // Sends the command to all actuators
-    QHashIterator<QString,CORBAInterfaces::Actuator_var> it(_actuators);
-    while (it.hasNext()) {
-        it.next().value()->chipKick(teamNum, playerNum, power);
-    }
+    // Queues the command on all actuators
+    ActuatorWorker::Command command;
+    command.type      = ActuatorWorker::ChipKick;
+    command.teamNum   = teamNum;
+    command.playerNum = playerNum;
+    command.value     = power;
+    dispatch(command);
 }
 
 /*** 'kickOnTouch'
@@ -158,16 +383,14 @@ void CommandBus::chipKick(uint8 teamNum, uint8 playerNum, float power) const {
   ** Returns:     Nothing
   ***/
 void CommandBus::kickOnTouch(uint8 teamNum, uint8 playerNum, bool enable, float power) const {
-    // Handles the lock
-    #ifdef GSTHREADSAFE
-    QReadLocker actuatorsLocker(_actuatorsLock);
-    #endif
-
-    // Sends the command to all actuators
-    QHashIterator<QString,CORBAInterfaces::Actuator_var> it(_actuators);
-    while (it.hasNext()) {
-        it.next().value()->kickOnTouch(teamNum, playerNum, enable, power);
-    }
+    // Queues the command on all actuators
+    ActuatorWorker::Command command;
+    command.type      = ActuatorWorker::KickOnTouch;
+    command.teamNum   = teamNum;
+    command.playerNum = playerNum;
+    command.enable    = enable;
+    command.value     = power;
+    dispatch(command);
 }
 
 /*** 'chipKickOnTouch'
@@ -180,16 +403,14 @@ void CommandBus::kickOnTouch(uint8 teamNum, uint8 playerNum, bool enable, float
   ** Returns:     Nothing
   ***/
 void CommandBus::chipKickOnTouch(uint8 teamNum, uint8 playerNum, bool enable, float power) const {
-    // Handles the lock
-    #ifdef GSTHREADSAFE
-    QReadLocker actuatorsLocker(_actuatorsLock);
-    #endif
-
-    // Sends the command to all actuators
-    QHashIterator<QString,CORBAInterfaces::Actuator_var> it(_actuators);
-    while (it.hasNext()) {
-        it.next().value()->chipKickOnTouch(teamNum, playerNum, enable, power);
-    }
+    // Queues the command on all actuators
+    ActuatorWorker::Command command;
+    command.type      = ActuatorWorker::ChipKickOnTouch;
+    command.teamNum   = teamNum;
+    command.playerNum = playerNum;
+    command.enable    = enable;
+    command.value     = power;
+    dispatch(command);
 }
 
 /*** 'holdBall'
@@ -201,19 +422,35 @@ void CommandBus::chipKickOnTouch(uint8 teamNum, uint8 playerNum, bool enable, fl
   ** Returns:     Nothing
   ***/
 void CommandBus::holdBall(uint8 teamNum, uint8 playerNum, bool enable) const {
+    // Queues the command on all actuators
+    ActuatorWorker::Command command;
+    command.type      = ActuatorWorker::HoldBall;
+    command.teamNum   = teamNum;
+    command.playerNum = playerNum;
+    command.enable    = enable;
+    dispatch(command);
+}
+
+
+/*** 'dispatch' function
+  ** Description: Queues a command on the workers of the actuators that own its player
+  ** Receives:    [command] The command
+  ** Returns:     Nothing
+  ***/
+void CommandBus::dispatch(const ActuatorWorker::Command& command) const {
     // Handles the lock
-    #ifdef GSTHREADSAFE
-    QReadLocker actuatorsLocker(_actuatorsLock);
-    #endif
+    ReadLocker actuatorsLocker(_actuatorsLock);
 
-    // Sends the command to all actuators
-    QHashIterator<QString,CORBAInterfaces::Actuator_var> it(_actuators);
+    // Queues the command on the owners; the workers send it concurrently
+    QHashIterator<QString,ActuatorWorker*> it(_workers);
     while (it.hasNext()) {
-        it.next().value()->holdBall(teamNum, playerNum, enable);
+        it.next();
+        if (_ownership.constFind(it.key())->owns(command.teamNum, command.playerNum)) {
+            it.value()->enqueue(command);
+        }
     }
 }
 
-
 /*** 'connectToActuator'
   ** Description: Connects to a given actuator address
   ** Receives:    [address] The actuator address
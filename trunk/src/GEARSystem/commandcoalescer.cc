@@ -0,0 +1,153 @@
+/*** GEARSystem - CommandCoalescer implementation
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Includes the class header
+#include <GEARSystem/commandcoalescer.hh>
+
+
+// Includes GEARSystem
+#include <GEARSystem/commandbus.hh>
+
+// Inlcudes Qt library
+#include <QtCore/QtCore>
+
+
+// Selects namespace
+using namespace GEARSystem;
+
+
+/*** Constructor
+  ** Description: Creates the coalescer and starts its thread
+  ** Receives:    [commandBus] The bus the commands are flushed to
+                  [rate]       The flush rate in Hz
+  ***/
+CommandCoalescer::CommandCoalescer(const CommandBus* commandBus, float rate) {
+    // Initializes the variables
+    _commandBus = commandBus;
+    _interval   = (rate > 0.0f) ? qMax(1, qRound(1000.0f/rate)) : 1;
+    _running    = true;
+    _pending.clear();
+
+    // Creates the locks
+    _pendingLock   = new QMutex();
+    _stopCondition = new QWaitCondition();
+
+    // Starts the thread
+    start();
+}
+
+/*** Destructor
+  ** Description: Stops the thread, flushes the pending commands and destroys the coalescer
+  ** Receives:    Nothing
+  ***/
+CommandCoalescer::~CommandCoalescer() {
+    // Stops the thread
+    _pendingLock->lock();
+    _running = false;
+    _stopCondition->wakeAll();
+    _pendingLock->unlock();
+
+    (void) wait();
+
+    // Sends the last commands
+    flush();
+
+    // Deletes the locks
+    delete _stopCondition;
+    delete _pendingLock;
+}
+
+
+/*** 'store' function
+  ** Description: Stores speed commands, replacing the pending ones of the same players
+  ** Receives:    [command]  The speed command
+                  [commands] The speed commands
+  ** Returns:     Nothing
+  ***/
+void CommandCoalescer::store(const RobotCommand& command) {
+    // Handles the lock
+    QMutexLocker pendingLocker(_pendingLock);
+
+    // Latest value wins
+    _pending[(command.teamNum() << 8) | command.playerNum()] = command;
+}
+
+void CommandCoalescer::store(const QList<RobotCommand>& commands) {
+    // Handles the lock
+    QMutexLocker pendingLocker(_pendingLock);
+
+    // Latest value wins
+    for (int i = 0; i < commands.size(); i++) {
+        const RobotCommand& command = commands.at(i);
+        _pending[(command.teamNum() << 8) | command.playerNum()] = command;
+    }
+}
+
+/*** 'rate' function
+  ** Description: Gets the flush rate
+  ** Receives:    Nothing
+  ** Returns:     The flush rate in Hz
+  ***/
+float CommandCoalescer::rate() const {
+    return(1000.0f/_interval);
+}
+
+
+/*** 'run' function
+  ** Description: Flushes the pending commands at every tick until the coalescer is stopped
+  ** Receives:    Nothing
+  ** Returns:     Nothing
+  ***/
+void CommandCoalescer::run() {
+    QElapsedTimer timer;
+    timer.start();
+    qint64 nextTick = _interval;
+
+    forever {
+        // Waits for the next tick (or for the stop request)
+        _pendingLock->lock();
+        qint64 remaining = nextTick - timer.elapsed();
+        while (_running && remaining > 0) {
+            (void) _stopCondition->wait(_pendingLock, (unsigned long) remaining);
+            remaining = nextTick - timer.elapsed();
+        }
+
+        // Leaves if the coalescer was stopped
+        if (!_running) {
+            _pendingLock->unlock();
+            break;
+        }
+        _pendingLock->unlock();
+
+        // Flushes and schedules the next tick, skipping the ones already missed
+        flush();
+        nextTick += _interval;
+        if (nextTick <= timer.elapsed()) {
+            nextTick = timer.elapsed() + _interval;
+        }
+    }
+}
+
+
+/*** 'flush' function
+  ** Description: Sends the pending commands to the command bus in a single batch
+  ** Receives:    Nothing
+  ** Returns:     Nothing
+  ***/
+void CommandCoalescer::flush() {
+    // Takes the pending commands
+    _pendingLock->lock();
+    QList<RobotCommand> commands = _pending.values();
+    _pending.clear();
+    _pendingLock->unlock();
+
+    // Sends them
+    if (!commands.isEmpty()) {
+        _commandBus->sendSpeeds(commands);
+    }
+}
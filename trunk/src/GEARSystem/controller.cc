@@ -10,6 +10,11 @@
 #include <GEARSystem/controller.hh>
 
 
+// Includes GEARSystem
+#include <GEARSystem/CORBAImplementations/corbaworldlistener.hh>
+#include <GEARSystem/sharedworld.hh>
+
+
 // Includes IO streams
 #include <iostream>
 
@@ -38,6 +43,43 @@ Controller::Controller() {
     _isConnected     = false;
     _serverPort      = 0;
     _serverAddress.clear();
+
+    _asynchronousCommands = false;
+
+    _corbaListener = NULL;
+    _poa           = NULL;
+    _isSubscribed  = false;
+    _subscriptionName.clear();
+
+    _lastFrame = WorldSnapshotPtr(new WorldSnapshot());
+    _listeners.clear();
+
+    _sharedWorld = NULL;
+
+    _caching       = false;
+    _cacheInterval = defaultCacheInterval;
+    clearCache();
+
+    // Creates the locks
+    _frameLock     = new QMutex();
+    _listenersLock = new QMutex();
+    _frameArrived  = new QWaitCondition();
+    _cacheLock     = new QMutex();
+}
+
+/*** Destructor
+  ** Description: Unsubscribes and destroys the controller
+  ** Receives:    Nothing
+  ***/
+Controller::~Controller() {
+    unsubscribe();
+    detachSharedWorld();
+
+    // Deletes the locks
+    delete _cacheLock;
+    delete _frameArrived;
+    delete _listenersLock;
+    delete _frameLock;
 }
 
 
@@ -91,7 +133,10 @@ bool Controller::connect(const QString& address, uint16 port) {
             return(false);
         }
 
-        // Sets as connected
+        // Sets as connected (the cache of a previous server is dropped)
+        _cacheLock->lock();
+        clearCache();
+        _cacheLock->unlock();
         _serverAddress = address;
         _serverPort    = port;
         _isConnected   = true;
@@ -117,6 +162,14 @@ bool Controller::connect(const QString& address, uint16 port) {
   ** Returns:     Nothing
   ***/
 void Controller::disconnect() {
+    // Stops receiving frames
+    unsubscribe();
+
+    // Drops the cache
+    _cacheLock->lock();
+    clearCache();
+    _cacheLock->unlock();
+
     // Sets as disconnected
     _serverAddress.clear();
     _serverPort  = 0;
@@ -130,6 +183,100 @@ void Controller::disconnect() {
   ***/
 bool Controller::isConnected() const { return(_isConnected); }
 
+/*** 'setAsynchronousCommands' function
+  ** Description: Selects if the commands (speeds, kicks and ball holding) are sent as oneway calls
+  ** Receives:    [enable] 'true' to send the commands without waiting for the server reply,
+                           'false' to wait for it (the default)
+  ** Returns:     Nothing
+  ** Comments:    Oneway commands may be lost silently if the server is unreachable
+  ***/
+void Controller::setAsynchronousCommands(bool enable) { _asynchronousCommands = enable; }
+
+/*** 'asynchronousCommands' function
+  ** Description: Verifies if the commands are sent as oneway calls
+  ** Receives:    Nothing
+  ** Returns:     'true' if they are, 'false' otherwise
+  ***/
+bool Controller::asynchronousCommands() const { return(_asynchronousCommands); }
+
+
+/*** 'attachSharedWorld' function
+  ** Description: Attaches to the world shared by a server on this host. While attached, the teams,
+                  players and balls functions and 'worldState' read the shared memory segment instead
+                  of calling the server; field functions and commands still go through CORBA
+  ** Receives:    [key] The segment key (SharedWorld::defaultKey if not given)
+  ** Returns:     'true' if the segment was found, 'false' otherwise
+  ***/
+bool Controller::attachSharedWorld() {
+    return(attachSharedWorld(SharedWorld::defaultKey));
+}
+
+bool Controller::attachSharedWorld(const QString& key) {
+    // Replaces a previously attached world
+    detachSharedWorld();
+
+    // Attaches to the segment
+    SharedWorld* sharedWorld = new SharedWorld(key);
+    if (!sharedWorld->attach()) {
+        delete sharedWorld;
+
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: Controller::attachSharedWorld(const QString&): ";
+        cerr << "Could not attach to the shared world!!" << endl << flush;
+        #endif
+
+        return(false);
+    }
+
+    _sharedWorld = sharedWorld;
+    return(true);
+}
+
+/*** 'detachSharedWorld' function
+  ** Description: Detaches from the shared world, going back to reading the world through CORBA
+  ** Receives:    Nothing
+  ** Returns:     Nothing
+  ***/
+void Controller::detachSharedWorld() {
+    delete _sharedWorld;
+    _sharedWorld = NULL;
+}
+
+/*** 'isSharedWorldAttached' function
+  ** Description: Verifies if the world is read from a shared memory segment
+  ** Receives:    Nothing
+  ** Returns:     'true' if it is, 'false' otherwise
+  ***/
+bool Controller::isSharedWorldAttached() const { return(_sharedWorld != NULL); }
+
+
+/*** 'setCaching' function
+  ** Description: Enables or disables the client-side cache
+  ** Receives:    [enable]   'true' to cache, 'false' to call the server on every function
+                  [interval] The minimum time between version checks, in milliseconds
+  ** Returns:     Nothing
+  ***/
+void Controller::setCaching(bool enable) {
+    setCaching(enable, defaultCacheInterval);
+}
+
+void Controller::setCaching(bool enable, uint32 interval) {
+    // Handles the lock
+    QMutexLocker cacheLocker(_cacheLock);
+
+    // Drops the cached values, so a re-enabled cache starts fresh
+    _caching       = enable;
+    _cacheInterval = interval;
+    clearCache();
+}
+
+/*** 'isCaching' function
+  ** Description: Verifies if the client-side cache is enabled
+  ** Receives:    Nothing
+  ** Returns:     'true' if it is, 'false' otherwise
+  ***/
+bool Controller::isCaching() const { return(_caching); }
+
 
 /*** 'teamName' function
   ** Description: Gets the team name
@@ -137,6 +284,22 @@ bool Controller::isConnected() const { return(_isConnected); }
   ** Returns:     The team name
   ***/
 const QString Controller::teamName(uint8 teamNum) const {
+    // Reads the shared world, if attached and the world fits in it
+    if (_sharedWorld != NULL) {
+        WorldSnapshotPtr world = _sharedWorld->read();
+        if (world != NULL) {
+            return(world->teamName(teamNum));
+        }
+    }
+
+    // Reads the cached world, if caching
+    if (_caching) {
+        WorldSnapshotPtr world = cachedWorld();
+        if (world != NULL) {
+            return(world->teamName(teamNum));
+        }
+    }
+
     // Gets the team name
     if (isConnected()) {
         try {
@@ -170,6 +333,22 @@ const QString Controller::teamName(uint8 teamNum) const {
   ** Returns:     The team number
   ***/
 uint8 Controller::teamNumber(const QString& name) const {
+    // Reads the shared world, if attached and the world fits in it
+    if (_sharedWorld != NULL) {
+        WorldSnapshotPtr world = _sharedWorld->read();
+        if (world != NULL) {
+            return(world->teamNumber(name));
+        }
+    }
+
+    // Reads the cached world, if caching
+    if (_caching) {
+        WorldSnapshotPtr world = cachedWorld();
+        if (world != NULL) {
+            return(world->teamNumber(name));
+        }
+    }
+
     // Gets the team number
     if (isConnected()) {
         try {
@@ -203,30 +382,32 @@ uint8 Controller::teamNumber(const QString& name) const {
   ** Returns:     The teams list
   ***/
 QList<uint8> Controller::teams() const {
+    // Reads the shared world, if attached and the world fits in it
+    if (_sharedWorld != NULL) {
+        WorldSnapshotPtr world = _sharedWorld->read();
+        if (world != NULL) {
+            return(world->teams());
+        }
+    }
+
+    // Reads the cached world, if caching
+    if (_caching) {
+        WorldSnapshotPtr world = cachedWorld();
+        if (world != NULL) {
+            return(world->teams());
+        }
+    }
+
     // Gets the teams
     if (isConnected()) {
         try {
-            // Gets the stringfied teams list
-            String_var teamsCorba;
-            uint8      nGEARSystemTeams;
-            bool       hasGEARSystemTeam0;
-            _corbaController->teams(teamsCorba, nGEARSystemTeams, hasGEARSystemTeam0);
-            char* teamsStr = (char*) teamsCorba;
-
-            // Recreates the list
-            QList<uint8> list;
-            if (hasGEARSystemTeam0) {
-                list.append(0);
-                nGEARSystemTeams--;
-            }
-
-            uint16 i;
-            for (i = 0; i < nGEARSystemTeams; i++) {
-                list.append(teamsStr[i]);
-            }
+            // Gets the teams bitmap
+            CORBATypes::IdBitmap teamsCorba;
+            CORBA::ULongLong     rosterVersion;
+            _corbaController->teams(teamsCorba, rosterVersion);
 
             // Returns the list
-            return(list);
+            return(IdBitmap(teamsCorba).toList());
         }
 
         // Handles CORBA exceptions
@@ -255,30 +436,32 @@ QList<uint8> Controller::teams() const {
   ** Returns:     The players list
   ***/
 QList<uint8> Controller::players(uint8 teamNum) const {
+    // Reads the shared world, if attached and the world fits in it
+    if (_sharedWorld != NULL) {
+        WorldSnapshotPtr world = _sharedWorld->read();
+        if (world != NULL) {
+            return(world->players(teamNum));
+        }
+    }
+
+    // Reads the cached world, if caching
+    if (_caching) {
+        WorldSnapshotPtr world = cachedWorld();
+        if (world != NULL) {
+            return(world->players(teamNum));
+        }
+    }
+
     // Gets the players
     if (isConnected()) {
         try {
-            // Gets the stringfied players list
-            String_var playersCorba;
-            uint8      nPlayers;
-            bool       hasPlayer0;
-            _corbaController->players(teamNum, playersCorba, nPlayers, hasPlayer0);
-            char* playersStr = (char*) playersCorba;
-
-            // Recreates the list
-            QList<uint8> list;
-            if (hasPlayer0) {
-                list.append(0);
-                nPlayers--;
-            }
-
-            uint16 i;
-            for (i = 0; i < nPlayers; i++) {
-                list.append(playersStr[i]);
-            }
+            // Gets the players bitmap
+            CORBATypes::IdBitmap playersCorba;
+            CORBA::ULongLong     rosterVersion;
+            _corbaController->players(teamNum, playersCorba, rosterVersion);
 
             // Returns the list
-            return(list);
+            return(IdBitmap(playersCorba).toList());
         }
 
         // Handles CORBA exceptions
@@ -307,30 +490,32 @@ QList<uint8> Controller::players(uint8 teamNum) const {
   ** Returns:     The balls list
   ***/
 QList<uint8> Controller::balls() const {
+    // Reads the shared world, if attached and the world fits in it
+    if (_sharedWorld != NULL) {
+        WorldSnapshotPtr world = _sharedWorld->read();
+        if (world != NULL) {
+            return(world->balls());
+        }
+    }
+
+    // Reads the cached world, if caching
+    if (_caching) {
+        WorldSnapshotPtr world = cachedWorld();
+        if (world != NULL) {
+            return(world->balls());
+        }
+    }
+
     // Gets the balls
     if (isConnected()) {
         try {
-            // Gets the stringfied balls list
-            String_var ballsCorba;
-            uint8      nBalls;
-            bool       hasBall0;
-            _corbaController->balls(ballsCorba, nBalls, hasBall0);
-            char* ballsStr = (char*) ballsCorba;
-
-            // Recreates the list
-            QList<uint8> list;
-            if (hasBall0) {
-                list.append(0);
-                nBalls--;
-            }
-
-            uint16 i;
-            for (i = 0; i < nBalls; i++) {
-                list.append(ballsStr[i]);
-            }
+            // Gets the balls bitmap
+            CORBATypes::IdBitmap ballsCorba;
+            CORBA::ULongLong     rosterVersion;
+            _corbaController->balls(ballsCorba, rosterVersion);
 
             // Returns the list
-            return(list);
+            return(IdBitmap(ballsCorba).toList());
         }
 
         // Handles CORBA exceptions
@@ -359,6 +544,22 @@ QList<uint8> Controller::balls() const {
   ** Returns:     The ball position
   ***/
 const Position Controller::ballPosition(uint8 ballNum) const {
+    // Reads the shared world, if attached and the world fits in it
+    if (_sharedWorld != NULL) {
+        WorldSnapshotPtr world = _sharedWorld->read();
+        if (world != NULL) {
+            return(world->ballPosition(ballNum));
+        }
+    }
+
+    // Reads the cached world, if caching
+    if (_caching) {
+        WorldSnapshotPtr world = cachedWorld();
+        if (world != NULL) {
+            return(world->ballPosition(ballNum));
+        }
+    }
+
     // Gets the ball position
     if (isConnected()) {
         try {
@@ -394,6 +595,22 @@ const Position Controller::ballPosition(uint8 ballNum) const {
   ** Returns:     The ball velocity
   ***/
 const Velocity Controller::ballVelocity(uint8 ballNum) const {
+    // Reads the shared world, if attached and the world fits in it
+    if (_sharedWorld != NULL) {
+        WorldSnapshotPtr world = _sharedWorld->read();
+        if (world != NULL) {
+            return(world->ballVelocity(ballNum));
+        }
+    }
+
+    // Reads the cached world, if caching
+    if (_caching) {
+        WorldSnapshotPtr world = cachedWorld();
+        if (world != NULL) {
+            return(world->ballVelocity(ballNum));
+        }
+    }
+
     // Gets the ball velocity
     if (isConnected()) {
         try {
@@ -424,6 +641,54 @@ const Velocity Controller::ballVelocity(uint8 ballNum) const {
 }
 
 
+/*** 'rosterChanged' function
+  ** Description: Verifies, in a single call, if teams, players or balls were added or removed on the server after
+                  a roster version
+  ** Receives:    [sinceVersion] The roster version seen before (0 if none)
+                  [version]      Where the current roster version will be stored (if not NULL)
+  ** Returns:     'true' if the roster changed or the call failed, 'false' otherwise
+  ***/
+bool Controller::rosterChanged(quint64 sinceVersion) const {
+    return(rosterChanged(sinceVersion, NULL));
+}
+
+bool Controller::rosterChanged(quint64 sinceVersion, quint64* version) const {
+    // Verifies the roster version
+    if (isConnected()) {
+        try {
+            CORBA::ULongLong rosterVersion;
+            const bool changed = _corbaController->rosterChanged(sinceVersion, rosterVersion);
+
+            // Returns the result
+            if (version != NULL) {
+                *version = rosterVersion;
+            }
+            return(changed);
+        }
+
+        // Handles CORBA exceptions
+        catch (const CORBA::Exception& exception) {
+            #ifdef GSDEBUGMSG
+            cerr << ">> GEARSystem: Controller::rosterChanged(quint64, quint64*): ";
+            cerr << "Caught CORBA exception: " << exception._name() << "!!" << endl << flush;
+            #endif
+        }
+    }
+    else {
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: Controller::rosterChanged(quint64, quint64*): ";
+        cerr << "The controller is not connected!!" << endl << flush;
+        #endif
+    }
+
+    // Reports a change, so the caller reads the roster again
+    if (version != NULL) {
+        *version = 0;
+    }
+    return(true);
+}
+
+
 /*** Gets functions
   ** Description: Gets the player pose
   ** Receives:    [teamNum]   The team number
@@ -431,6 +696,22 @@ const Velocity Controller::ballVelocity(uint8 ballNum) const {
   ** Returns:     The player position, orientation, velocity or angular speed
   ***/
 const Position Controller::playerPosition(uint8 teamNum, uint8 playerNum) const {
+    // Reads the shared world, if attached and the world fits in it
+    if (_sharedWorld != NULL) {
+        WorldSnapshotPtr world = _sharedWorld->read();
+        if (world != NULL) {
+            return(world->playerPosition(teamNum, playerNum));
+        }
+    }
+
+    // Reads the cached world, if caching
+    if (_caching) {
+        WorldSnapshotPtr world = cachedWorld();
+        if (world != NULL) {
+            return(world->playerPosition(teamNum, playerNum));
+        }
+    }
+
     // Gets the player position
     if (isConnected()) {
         try {
@@ -461,6 +742,22 @@ const Position Controller::playerPosition(uint8 teamNum, uint8 playerNum) const
 }
 
 const Angle Controller::playerOrientation(uint8 teamNum, uint8 playerNum) const {
+    // Reads the shared world, if attached and the world fits in it
+    if (_sharedWorld != NULL) {
+        WorldSnapshotPtr world = _sharedWorld->read();
+        if (world != NULL) {
+            return(world->playerOrientation(teamNum, playerNum));
+        }
+    }
+
+    // Reads the cached world, if caching
+    if (_caching) {
+        WorldSnapshotPtr world = cachedWorld();
+        if (world != NULL) {
+            return(world->playerOrientation(teamNum, playerNum));
+        }
+    }
+
     // Gets the player orientation
     if (isConnected()) {
         try {
@@ -491,6 +788,22 @@ const Angle Controller::playerOrientation(uint8 teamNum, uint8 playerNum) const
 }
 
 const Velocity Controller::playerVelocity(uint8 teamNum, uint8 playerNum) const {
+    // Reads the shared world, if attached and the world fits in it
+    if (_sharedWorld != NULL) {
+        WorldSnapshotPtr world = _sharedWorld->read();
+        if (world != NULL) {
+            return(world->playerVelocity(teamNum, playerNum));
+        }
+    }
+
+    // Reads the cached world, if caching
+    if (_caching) {
+        WorldSnapshotPtr world = cachedWorld();
+        if (world != NULL) {
+            return(world->playerVelocity(teamNum, playerNum));
+        }
+    }
+
     // Gets the player velocity
     if (isConnected()) {
         try {
@@ -521,6 +834,22 @@ const Velocity Controller::playerVelocity(uint8 teamNum, uint8 playerNum) const
 }
 
 const AngularSpeed Controller::playerAngularSpeed(uint8 teamNum, uint8 playerNum) const {
+    // Reads the shared world, if attached and the world fits in it
+    if (_sharedWorld != NULL) {
+        WorldSnapshotPtr world = _sharedWorld->read();
+        if (world != NULL) {
+            return(world->playerAngularSpeed(teamNum, playerNum));
+        }
+    }
+
+    // Reads the cached world, if caching
+    if (_caching) {
+        WorldSnapshotPtr world = cachedWorld();
+        if (world != NULL) {
+            return(world->playerAngularSpeed(teamNum, playerNum));
+        }
+    }
+
     // Gets the player angular speed
     if (isConnected()) {
         try {
@@ -558,6 +887,22 @@ const AngularSpeed Controller::playerAngularSpeed(uint8 teamNum, uint8 playerNum
   ** Returns:     'true' if the player has the ball, 'false' otherwise
   ***/
 bool Controller::ballPossession(uint8 teamNum, uint8 playerNum) {
+    // Reads the shared world, if attached and the world fits in it
+    if (_sharedWorld != NULL) {
+        WorldSnapshotPtr world = _sharedWorld->read();
+        if (world != NULL) {
+            return(world->ballPossession(teamNum, playerNum));
+        }
+    }
+
+    // Reads the cached world, if caching
+    if (_caching) {
+        WorldSnapshotPtr world = cachedWorld();
+        if (world != NULL) {
+            return(world->ballPossession(teamNum, playerNum));
+        }
+    }
+
     // Gets the flag
     if (isConnected()) {
         try {
@@ -594,6 +939,22 @@ bool Controller::ballPossession(uint8 teamNum, uint8 playerNum) {
   ** Returns:     'true' if the player has the enabled kick, 'false' otherwise
   ***/
 bool Controller::kickEnabled(uint8 teamNum, uint8 playerNum) const {
+    // Reads the shared world, if attached and the world fits in it
+    if (_sharedWorld != NULL) {
+        WorldSnapshotPtr world = _sharedWorld->read();
+        if (world != NULL) {
+            return(world->kickEnabled(teamNum, playerNum));
+        }
+    }
+
+    // Reads the cached world, if caching
+    if (_caching) {
+        WorldSnapshotPtr world = cachedWorld();
+        if (world != NULL) {
+            return(world->kickEnabled(teamNum, playerNum));
+        }
+    }
+
     // Gets the flag
     if (isConnected()) {
         try {
@@ -630,6 +991,22 @@ bool Controller::kickEnabled(uint8 teamNum, uint8 playerNum) const {
   ** Returns:     'true' if the player has the enabled kick, 'false' otherwise
   ***/
 bool Controller::dribbleEnabled(uint8 teamNum, uint8 playerNum) const {
+    // Reads the shared world, if attached and the world fits in it
+    if (_sharedWorld != NULL) {
+        WorldSnapshotPtr world = _sharedWorld->read();
+        if (world != NULL) {
+            return(world->dribbleEnabled(teamNum, playerNum));
+        }
+    }
+
+    // Reads the cached world, if caching
+    if (_caching) {
+        WorldSnapshotPtr world = cachedWorld();
+        if (world != NULL) {
+            return(world->dribbleEnabled(teamNum, playerNum));
+        }
+    }
+
     // Gets the flag
     if (isConnected()) {
         try {
@@ -666,6 +1043,22 @@ bool Controller::dribbleEnabled(uint8 teamNum, uint8 playerNum) const {
   ** Returns:     The charge value
   ***/
 unsigned char Controller::batteryCharge(uint8 teamNum, uint8 playerNum) const {
+    // Reads the shared world, if attached and the world fits in it
+    if (_sharedWorld != NULL) {
+        WorldSnapshotPtr world = _sharedWorld->read();
+        if (world != NULL) {
+            return(world->batteryCharge(teamNum, playerNum));
+        }
+    }
+
+    // Reads the cached world, if caching
+    if (_caching) {
+        WorldSnapshotPtr world = cachedWorld();
+        if (world != NULL) {
+            return(world->batteryCharge(teamNum, playerNum));
+        }
+    }
+
     // Gets the flag
     if (isConnected()) {
         try {
@@ -702,6 +1095,22 @@ unsigned char Controller::batteryCharge(uint8 teamNum, uint8 playerNum) const {
   ** Returns:     The charge value
   ***/
 unsigned char Controller::capacitorCharge(uint8 teamNum, uint8 playerNum) const {
+    // Reads the shared world, if attached and the world fits in it
+    if (_sharedWorld != NULL) {
+        WorldSnapshotPtr world = _sharedWorld->read();
+        if (world != NULL) {
+            return(world->capacitorCharge(teamNum, playerNum));
+        }
+    }
+
+    // Reads the cached world, if caching
+    if (_caching) {
+        WorldSnapshotPtr world = cachedWorld();
+        if (world != NULL) {
+            return(world->capacitorCharge(teamNum, playerNum));
+        }
+    }
+
     // Gets the flag
     if (isConnected()) {
         try {
@@ -731,113 +1140,596 @@ unsigned char Controller::capacitorCharge(uint8 teamNum, uint8 playerNum) const
     return(0);
 }
 
-
-/*** 'setSpeed'
-  ** Description: Sets a player speed
+/*** 'playerState' function
+  ** Description: Gets the whole player state (pose, velocities, flags and charges) in a single call
   ** Receives:    [teamNum]   The team number
-                  [playerNum] The team number
-                  [x]         The x speed component
-                  [y]         The y speed component
-                  [theta]     The angular speed
-  ** Returns:     Nothing
+                  [playerNum] The player number
+  ** Returns:     The player state, invalid if there is no such player or an error occourred
   ***/
-void Controller::setSpeed(uint8 teamNum, uint8 playerNum, float x, float y, float theta) {
-    // Sends the 'setSpeed' command
+PlayerState Controller::playerState(uint8 teamNum, uint8 playerNum) const {
+    // Reads the shared world, if attached and the world fits in it
+    if (_sharedWorld != NULL) {
+        WorldSnapshotPtr world = _sharedWorld->read();
+        if (world != NULL) {
+            return(world->playerState(teamNum, playerNum));
+        }
+    }
+
+    // Reads the cached world, if caching
+    if (_caching) {
+        WorldSnapshotPtr world = cachedWorld();
+        if (world != NULL) {
+            return(world->playerState(teamNum, playerNum));
+        }
+    }
+
+    // Gets the state
     if (isConnected()) {
         try {
-            _corbaController->setSpeed(teamNum, playerNum, x, y, theta);
+            CORBATypes::PlayerState state;
+            if (_corbaController->playerState(teamNum, playerNum, state)) {
+                // Returns the state
+                return(PlayerState(state));
+            }
         }
 
         // Handles CORBA exceptions
         catch (const CORBA::Exception& exception) {
             #ifdef GSDEBUGMSG
-            cerr << ">> GEARSystem: Controller::setSpeed(uint8, uint8, float, float, float): ";
+            cerr << ">> GEARSystem: Controller::playerState(uint8, uint8): ";
             cerr << "Caught CORBA exception: " << exception._name() << "!!" << endl << flush;
             #endif
         }
     }
     else {
         #ifdef GSDEBUGMSG
-        cerr << ">> GEARSystem: Controller::setSpeed(uint8, uint8, float, float, float): ";
+        cerr << ">> GEARSystem: Controller::playerState(uint8, uint8): ";
         cerr << "The controller is not connected!!" << endl << flush;
         #endif
     }
+
+    // Returns an invalid state if an error occourred
+    return(PlayerState(teamNum, playerNum));
 }
 
-/*** 'kick'
-  ** Description: Activates the player kicking device
-  ** Receives:    [teamNum]   The team number
-                  [playerNum] The team number
-                  [power]     The kick power
-  ** Returns:     Nothing
+
+/*** Positions at a time functions
+  ** Description: Gets a ball or player pose at a given capture time, interpolated from the history the
+                  server keeps for each ball and player
+  ** Receives:    [ballNum]   The ball number
+                  [teamNum]   The team number
+                  [playerNum] The player number
+                  [time]      The capture time, in seconds
+  ** Returns:     The position or orientation (the latest one after the last frame, invalid if the time is
+                  older than the history)
   ***/
-void Controller::kick(uint8 teamNum, uint8 playerNum, float power) {
-    // Sends the 'kick' command
+const Position Controller::ballPositionAt(uint8 ballNum, double time) const {
+    // Gets the ball position
     if (isConnected()) {
         try {
-            _corbaController->kick(teamNum, playerNum, power);
+            CORBATypes::Position position;
+            _corbaController->ballPositionAt(ballNum, time, position);
+
+            // Returns the position
+            return(Position(position));
         }
 
         // Handles CORBA exceptions
         catch (const CORBA::Exception& exception) {
             #ifdef GSDEBUGMSG
-            cerr << ">> GEARSystem: Controller::kick(uint8, uint8, float): ";
+            cerr << ">> GEARSystem: Controller::ballPositionAt(uint8, double): ";
             cerr << "Caught CORBA exception: " << exception._name() << "!!" << endl << flush;
             #endif
         }
     }
     else {
         #ifdef GSDEBUGMSG
-        cerr << ">> GEARSystem: Controller::kick(uint8, uint8, float): ";
+        cerr << ">> GEARSystem: Controller::ballPositionAt(uint8, double): ";
         cerr << "The controller is not connected!!" << endl << flush;
         #endif
     }
+
+    // Returns an invalid position
+    return(_invalidPosition);
 }
 
-/*** 'chipKick'
-  ** Description: Activates the player chip-kicking device
-  ** Receives:    [teamNum]   The team number
-                  [playerNum] The team number
-                  [power]     The kick power
-  ** Returns:     Nothing
-  ***/
-void Controller::chipKick(uint8 teamNum, uint8 playerNum, float power) {
-    // Sends the 'chipKick' command
+const Position Controller::playerPositionAt(uint8 teamNum, uint8 playerNum, double time) const {
+    // Gets the player position
     if (isConnected()) {
         try {
-            _corbaController->chipKick(teamNum, playerNum, power);
+            CORBATypes::Position position;
+            _corbaController->playerPositionAt(teamNum, playerNum, time, position);
+
+            // Returns the position
+            return(Position(position));
         }
 
         // Handles CORBA exceptions
         catch (const CORBA::Exception& exception) {
             #ifdef GSDEBUGMSG
-            cerr << ">> GEARSystem: Controller::chipKick(uint8, uint8, float): ";
+            cerr << ">> GEARSystem: Controller::playerPositionAt(uint8, uint8, double): ";
             cerr << "Caught CORBA exception: " << exception._name() << "!!" << endl << flush;
             #endif
         }
     }
     else {
         #ifdef GSDEBUGMSG
-        cerr << ">> GEARSystem: Controller::chipKick(uint8, uint8, float): ";
+        cerr << ">> GEARSystem: Controller::playerPositionAt(uint8, uint8, double): ";
         cerr << "The controller is not connected!!" << endl << flush;
         #endif
     }
+
+    // Returns an invalid position
+    return(_invalidPosition);
 }
 
-/*** 'kickOnTouch'
-  ** Description: Activates the player kicking device when the ball touches it
-  ** Receives:    [teamNum]   The team number
-                  [playerNum] The team number
-                  [enable]    'true' if the player must kick on touch,
-                              'false' otherwise
-                  [power]     The kick power
+const Angle Controller::playerOrientationAt(uint8 teamNum, uint8 playerNum, double time) const {
+    // Gets the player orientation
+    if (isConnected()) {
+        try {
+            CORBATypes::Angle orientation;
+            _corbaController->playerOrientationAt(teamNum, playerNum, time, orientation);
+
+            // Returns the orientation
+            return(Angle(orientation));
+        }
+
+        // Handles CORBA exceptions
+        catch (const CORBA::Exception& exception) {
+            #ifdef GSDEBUGMSG
+            cerr << ">> GEARSystem: Controller::playerOrientationAt(uint8, uint8, double): ";
+            cerr << "Caught CORBA exception: " << exception._name() << "!!" << endl << flush;
+            #endif
+        }
+    }
+    else {
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: Controller::playerOrientationAt(uint8, uint8, double): ";
+        cerr << "The controller is not connected!!" << endl << flush;
+        #endif
+    }
+
+    // Returns an invalid orientation
+    return(_invalidAngle);
+}
+
+/*** Trajectory functions
+  ** Description: Gets the samples the server stored for a ball or player in a time interval
+  ** Receives:    [ballNum]   The ball number
+                  [teamNum]   The team number
+                  [playerNum] The player number
+                  [startTime] The interval start, in seconds
+                  [endTime]   The interval end, in seconds
+  ** Returns:     The samples, oldest first
+  ***/
+QList<TrajectorySample> Controller::ballTrajectory(uint8 ballNum, double startTime, double endTime) const {
+    // Gets the ball samples
+    if (isConnected()) {
+        try {
+            CORBATypes::TrajectorySampleSeq* samples = NULL;
+            _corbaController->ballTrajectory(ballNum, startTime, endTime, samples);
+
+            // Returns the samples
+            QList<TrajectorySample> list = TrajectorySample::fromCORBA(*samples);
+            delete samples;
+            return(list);
+        }
+
+        // Handles CORBA exceptions
+        catch (const CORBA::Exception& exception) {
+            #ifdef GSDEBUGMSG
+            cerr << ">> GEARSystem: Controller::ballTrajectory(uint8, double, double): ";
+            cerr << "Caught CORBA exception: " << exception._name() << "!!" << endl << flush;
+            #endif
+        }
+    }
+    else {
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: Controller::ballTrajectory(uint8, double, double): ";
+        cerr << "The controller is not connected!!" << endl << flush;
+        #endif
+    }
+
+    // Returns an empty trajectory
+    return(QList<TrajectorySample>());
+}
+
+QList<TrajectorySample> Controller::playerTrajectory(uint8 teamNum, uint8 playerNum, double startTime, double endTime) const {
+    // Gets the player samples
+    if (isConnected()) {
+        try {
+            CORBATypes::TrajectorySampleSeq* samples = NULL;
+            _corbaController->playerTrajectory(teamNum, playerNum, startTime, endTime, samples);
+
+            // Returns the samples
+            QList<TrajectorySample> list = TrajectorySample::fromCORBA(*samples);
+            delete samples;
+            return(list);
+        }
+
+        // Handles CORBA exceptions
+        catch (const CORBA::Exception& exception) {
+            #ifdef GSDEBUGMSG
+            cerr << ">> GEARSystem: Controller::playerTrajectory(uint8, uint8, double, double): ";
+            cerr << "Caught CORBA exception: " << exception._name() << "!!" << endl << flush;
+            #endif
+        }
+    }
+    else {
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: Controller::playerTrajectory(uint8, uint8, double, double): ";
+        cerr << "The controller is not connected!!" << endl << flush;
+        #endif
+    }
+
+    // Returns an empty trajectory
+    return(QList<TrajectorySample>());
+}
+
+
+/*** Prediction functions
+  ** Description: Predicts a ball position or a player pose at a given capture time, using the server
+                  motion model
+  ** Receives:    [ballNum]   The ball number
+                  [teamNum]   The team number
+                  [playerNum] The player number
+                  [time]      The capture time, in seconds (on the frames clock)
+  ** Returns:     The predicted position, or the predicted pose along with the last known velocity
+  ***/
+const Position Controller::predictedBallPosition(uint8 ballNum, double time) const {
+    // Gets the predicted position
+    if (isConnected()) {
+        try {
+            CORBATypes::Position position;
+            _corbaController->predictedBallPosition(ballNum, time, position);
+
+            // Returns the position
+            return(Position(position));
+        }
+
+        // Handles CORBA exceptions
+        catch (const CORBA::Exception& exception) {
+            #ifdef GSDEBUGMSG
+            cerr << ">> GEARSystem: Controller::predictedBallPosition(uint8, double): ";
+            cerr << "Caught CORBA exception: " << exception._name() << "!!" << endl << flush;
+            #endif
+        }
+    }
+    else {
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: Controller::predictedBallPosition(uint8, double): ";
+        cerr << "The controller is not connected!!" << endl << flush;
+        #endif
+    }
+
+    // Returns an invalid position
+    return(_invalidPosition);
+}
+
+TrajectorySample Controller::predictedPlayerPose(uint8 teamNum, uint8 playerNum, double time) const {
+    // Gets the predicted pose
+    if (isConnected()) {
+        try {
+            CORBATypes::TrajectorySample pose;
+            _corbaController->predictedPlayerPose(teamNum, playerNum, time, pose);
+
+            // Returns the pose
+            return(TrajectorySample(pose));
+        }
+
+        // Handles CORBA exceptions
+        catch (const CORBA::Exception& exception) {
+            #ifdef GSDEBUGMSG
+            cerr << ">> GEARSystem: Controller::predictedPlayerPose(uint8, uint8, double): ";
+            cerr << "Caught CORBA exception: " << exception._name() << "!!" << endl << flush;
+            #endif
+        }
+    }
+    else {
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: Controller::predictedPlayerPose(uint8, uint8, double): ";
+        cerr << "The controller is not connected!!" << endl << flush;
+        #endif
+    }
+
+    // Returns an invalid pose
+    return(TrajectorySample());
+}
+
+/*** Spatial query functions
+  ** Description: Finds the players closest to a point, within a radius of a point, or within a radius of a
+                  segment (a pass lane), in a single call to the server
+  ** Receives:    [point]  The queried point
+                  [k]      The maximum number of players
+                  [radius] The search radius
+                  [a]      The segment start
+                  [b]      The segment end
+                  [teams]  The teams searched (an empty bitmap searches all teams)
+  ** Returns:     The players and their distances to the point or segment, closest first
+  ***/
+QList<PlayerDistance> Controller::nearestPlayers(const Position& point, int k) const {
+    return(nearestPlayers(point, k, IdBitmap()));
+}
+
+QList<PlayerDistance> Controller::nearestPlayers(const Position& point, int k, const IdBitmap& teams) const {
+    // Runs the query on the server
+    if (isConnected()) {
+        try {
+            CORBATypes::Position corbaPoint;
+            point.toCORBA(&corbaPoint);
+            CORBATypes::IdBitmap corbaTeams;
+            teams.toCORBA(corbaTeams);
+            CORBATypes::PlayerDistanceSeq* players = NULL;
+            _corbaController->nearestPlayers(corbaPoint, qBound(0, k, 0xFFFF), corbaTeams, players);
+
+            // Returns the players
+            QList<PlayerDistance> list = PlayerDistance::fromCORBA(*players);
+            delete players;
+            return(list);
+        }
+
+        // Handles CORBA exceptions
+        catch (const CORBA::Exception& exception) {
+            #ifdef GSDEBUGMSG
+            cerr << ">> GEARSystem: Controller::nearestPlayers(Position, int, IdBitmap): ";
+            cerr << "Caught CORBA exception: " << exception._name() << "!!" << endl << flush;
+            #endif
+        }
+    }
+    else {
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: Controller::nearestPlayers(Position, int, IdBitmap): ";
+        cerr << "The controller is not connected!!" << endl << flush;
+        #endif
+    }
+
+    // Returns no players
+    return(QList<PlayerDistance>());
+}
+
+QList<PlayerDistance> Controller::playersWithinRadius(const Position& point, float radius) const {
+    return(playersWithinRadius(point, radius, IdBitmap()));
+}
+
+QList<PlayerDistance> Controller::playersWithinRadius(const Position& point, float radius, const IdBitmap& teams) const {
+    // Runs the query on the server
+    if (isConnected()) {
+        try {
+            CORBATypes::Position corbaPoint;
+            point.toCORBA(&corbaPoint);
+            CORBATypes::IdBitmap corbaTeams;
+            teams.toCORBA(corbaTeams);
+            CORBATypes::PlayerDistanceSeq* players = NULL;
+            _corbaController->playersWithinRadius(corbaPoint, radius, corbaTeams, players);
+
+            // Returns the players
+            QList<PlayerDistance> list = PlayerDistance::fromCORBA(*players);
+            delete players;
+            return(list);
+        }
+
+        // Handles CORBA exceptions
+        catch (const CORBA::Exception& exception) {
+            #ifdef GSDEBUGMSG
+            cerr << ">> GEARSystem: Controller::playersWithinRadius(Position, float, IdBitmap): ";
+            cerr << "Caught CORBA exception: " << exception._name() << "!!" << endl << flush;
+            #endif
+        }
+    }
+    else {
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: Controller::playersWithinRadius(Position, float, IdBitmap): ";
+        cerr << "The controller is not connected!!" << endl << flush;
+        #endif
+    }
+
+    // Returns no players
+    return(QList<PlayerDistance>());
+}
+
+QList<PlayerDistance> Controller::segmentClearance(const Position& a, const Position& b, float radius) const {
+    return(segmentClearance(a, b, radius, IdBitmap()));
+}
+
+QList<PlayerDistance> Controller::segmentClearance(const Position& a, const Position& b, float radius, const IdBitmap& teams) const {
+    // Runs the query on the server
+    if (isConnected()) {
+        try {
+            CORBATypes::Position corbaA, corbaB;
+            a.toCORBA(&corbaA);
+            b.toCORBA(&corbaB);
+            CORBATypes::IdBitmap corbaTeams;
+            teams.toCORBA(corbaTeams);
+            CORBATypes::PlayerDistanceSeq* players = NULL;
+            _corbaController->segmentClearance(corbaA, corbaB, radius, corbaTeams, players);
+
+            // Returns the players
+            QList<PlayerDistance> list = PlayerDistance::fromCORBA(*players);
+            delete players;
+            return(list);
+        }
+
+        // Handles CORBA exceptions
+        catch (const CORBA::Exception& exception) {
+            #ifdef GSDEBUGMSG
+            cerr << ">> GEARSystem: Controller::segmentClearance(Position, Position, float, IdBitmap): ";
+            cerr << "Caught CORBA exception: " << exception._name() << "!!" << endl << flush;
+            #endif
+        }
+    }
+    else {
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: Controller::segmentClearance(Position, Position, float, IdBitmap): ";
+        cerr << "The controller is not connected!!" << endl << flush;
+        #endif
+    }
+
+    // Returns no players
+    return(QList<PlayerDistance>());
+}
+
+
+/*** 'setSpeed'
+  ** Description: Sets a player speed
+  ** Receives:    [teamNum]   The team number
+                  [playerNum] The team number
+                  [x]         The x speed component
+                  [y]         The y speed component
+                  [theta]     The angular speed
+  ** Returns:     Nothing
+  ***/
+void Controller::setSpeed(uint8 teamNum, uint8 playerNum, float x, float y, float theta) {
+    // Sends the 'setSpeed' command
+    if (isConnected()) {
+        try {
+            if (_asynchronousCommands) {
+                _corbaController->setSpeedAsync(teamNum, playerNum, x, y, theta);
+            }
+            else {
+                _corbaController->setSpeed(teamNum, playerNum, x, y, theta);
+            }
+        }
+
+        // Handles CORBA exceptions
+        catch (const CORBA::Exception& exception) {
+            #ifdef GSDEBUGMSG
+            cerr << ">> GEARSystem: Controller::setSpeed(uint8, uint8, float, float, float): ";
+            cerr << "Caught CORBA exception: " << exception._name() << "!!" << endl << flush;
+            #endif
+        }
+    }
+    else {
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: Controller::setSpeed(uint8, uint8, float, float, float): ";
+        cerr << "The controller is not connected!!" << endl << flush;
+        #endif
+    }
+}
+
+/*** 'setSpeeds'
+  ** Description: Sets the speed of several players at once
+  ** Receives:    [commands] The speed commands
+  ** Returns:     Nothing
+  ***/
+void Controller::setSpeeds(const QList<RobotCommand>& commands) {
+    // Sends the 'setSpeeds' command
+    if (isConnected()) {
+        try {
+            CORBATypes::RobotCommandSeq corbaCommands;
+            RobotCommand::toCORBA(commands, &corbaCommands);
+            if (_asynchronousCommands) {
+                _corbaController->setSpeedsAsync(corbaCommands);
+            }
+            else {
+                _corbaController->setSpeeds(corbaCommands);
+            }
+        }
+
+        // Handles CORBA exceptions
+        catch (const CORBA::Exception& exception) {
+            #ifdef GSDEBUGMSG
+            cerr << ">> GEARSystem: Controller::setSpeeds(const QList<RobotCommand>&): ";
+            cerr << "Caught CORBA exception: " << exception._name() << "!!" << endl << flush;
+            #endif
+        }
+    }
+    else {
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: Controller::setSpeeds(const QList<RobotCommand>&): ";
+        cerr << "The controller is not connected!!" << endl << flush;
+        #endif
+    }
+}
+
+/*** 'kick'
+  ** Description: Activates the player kicking device
+  ** Receives:    [teamNum]   The team number
+                  [playerNum] The team number
+                  [power]     The kick power
+  ** Returns:     Nothing
+  ***/
+void Controller::kick(uint8 teamNum, uint8 playerNum, float power) {
+    // Sends the 'kick' command
+    if (isConnected()) {
+        try {
+            if (_asynchronousCommands) {
+                _corbaController->kickAsync(teamNum, playerNum, power);
+            }
+            else {
+                _corbaController->kick(teamNum, playerNum, power);
+            }
+        }
+
+        // Handles CORBA exceptions
+        catch (const CORBA::Exception& exception) {
+            #ifdef GSDEBUGMSG
+            cerr << ">> GEARSystem: Controller::kick(uint8, uint8, float): ";
+            cerr << "Caught CORBA exception: " << exception._name() << "!!" << endl << flush;
+            #endif
+        }
+    }
+    else {
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: Controller::kick(uint8, uint8, float): ";
+        cerr << "The controller is not connected!!" << endl << flush;
+        #endif
+    }
+}
+
+/*** 'chipKick'
+  ** Description: Activates the player chip-kicking device
+  ** Receives:    [teamNum]   The team number
+                  [playerNum] The team number
+                  [power]     The kick power
+  ** Returns:     Nothing
+  ***/
+void Controller::chipKick(uint8 teamNum, uint8 playerNum, float power) {
+    // Sends the 'chipKick' command
+    if (isConnected()) {
+        try {
+            if (_asynchronousCommands) {
+                _corbaController->chipKickAsync(teamNum, playerNum, power);
+            }
+            else {
+                _corbaController->chipKick(teamNum, playerNum, power);
+            }
+        }
+
+        // Handles CORBA exceptions
+        catch (const CORBA::Exception& exception) {
+            #ifdef GSDEBUGMSG
+            cerr << ">> GEARSystem: Controller::chipKick(uint8, uint8, float): ";
+            cerr << "Caught CORBA exception: " << exception._name() << "!!" << endl << flush;
+            #endif
+        }
+    }
+    else {
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: Controller::chipKick(uint8, uint8, float): ";
+        cerr << "The controller is not connected!!" << endl << flush;
+        #endif
+    }
+}
+
+/*** 'kickOnTouch'
+  ** Description: Activates the player kicking device when the ball touches it
+  ** Receives:    [teamNum]   The team number
+                  [playerNum] The team number
+                  [enable]    'true' if the player must kick on touch,
+                              'false' otherwise
+                  [power]     The kick power
   ** Returns:     Nothing
   ***/
 void Controller::kickOnTouch(uint8 teamNum, uint8 playerNum, bool enable, float power) {
     // Sends the 'kickOnTouch' command
     if (isConnected()) {
         try {
-            _corbaController->kickOnTouch(teamNum, playerNum, enable, power);
+            if (_asynchronousCommands) {
+                _corbaController->kickOnTouchAsync(teamNum, playerNum, enable, power);
+            }
+            else {
+                _corbaController->kickOnTouch(teamNum, playerNum, enable, power);
+            }
         }
 
         // Handles CORBA exceptions
@@ -869,7 +1761,12 @@ void Controller::chipKickOnTouch(uint8 teamNum, uint8 playerNum, bool enable, fl
     // Sends the 'chipKickOnTouch' command
     if (isConnected()) {
         try {
-            _corbaController->chipKickOnTouch(teamNum, playerNum, enable, power);
+            if (_asynchronousCommands) {
+                _corbaController->chipKickOnTouchAsync(teamNum, playerNum, enable, power);
+            }
+            else {
+                _corbaController->chipKickOnTouch(teamNum, playerNum, enable, power);
+            }
         }
 
         // Handles CORBA exceptions
@@ -900,7 +1797,12 @@ void Controller::holdBall(uint8 teamNum, uint8 playerNum, bool enable) {
     // Sends the 'holdBall' command
     if (isConnected()) {
         try {
-            _corbaController->holdBall(teamNum, playerNum, enable);
+            if (_asynchronousCommands) {
+                _corbaController->holdBallAsync(teamNum, playerNum, enable);
+            }
+            else {
+                _corbaController->holdBall(teamNum, playerNum, enable);
+            }
         }
 
         // Handles CORBA exceptions
@@ -924,6 +1826,12 @@ void Controller::holdBall(uint8 teamNum, uint8 playerNum, bool enable) {
   ** Description: Handles field info
   ***/
 const Position Controller::fieldTopRightCorner() const {
+    // Reads the cached field, if caching
+    Field field;
+    if (_caching && cachedField(&field, NULL)) {
+        return(field.topRightCorner());
+    }
+
     // Gets the field corner
     if (isConnected()) {
         try {
@@ -954,6 +1862,12 @@ const Position Controller::fieldTopRightCorner() const {
 }
 
 const Position Controller::fieldTopLeftCorner() const {
+    // Reads the cached field, if caching
+    Field field;
+    if (_caching && cachedField(&field, NULL)) {
+        return(field.topLeftCorner());
+    }
+
     // Gets the field corner
     if (isConnected()) {
         try {
@@ -984,6 +1898,12 @@ const Position Controller::fieldTopLeftCorner() const {
 }
 
 const Position Controller::fieldBottomLeftCorner() const {
+    // Reads the cached field, if caching
+    Field field;
+    if (_caching && cachedField(&field, NULL)) {
+        return(field.bottomLeftCorner());
+    }
+
     // Gets the field corner
     if (isConnected()) {
         try {
@@ -1014,6 +1934,12 @@ const Position Controller::fieldBottomLeftCorner() const {
 }
 
 const Position Controller::fieldBottomRightCorner() const {
+    // Reads the cached field, if caching
+    Field field;
+    if (_caching && cachedField(&field, NULL)) {
+        return(field.bottomRightCorner());
+    }
+
     // Gets the field corner
     if (isConnected()) {
         try {
@@ -1044,6 +1970,12 @@ const Position Controller::fieldBottomRightCorner() const {
 }
 
 const Position Controller::fieldCenter() const {
+    // Reads the cached field, if caching
+    Field field;
+    if (_caching && cachedField(&field, NULL)) {
+        return(field.center());
+    }
+
     // Gets the field corner
     if (isConnected()) {
         try {
@@ -1074,6 +2006,12 @@ const Position Controller::fieldCenter() const {
 }
 
 const Goal Controller::leftGoal() const {
+    // Reads the cached field, if caching
+    Field field;
+    if (_caching && cachedField(&field, NULL)) {
+        return(field.leftGoal());
+    }
+
     // Gets the goal
     if (isConnected()) {
         try {
@@ -1110,6 +2048,12 @@ const Goal Controller::leftGoal() const {
 }
 
 const Goal Controller::rightGoal() const {
+    // Reads the cached field, if caching
+    Field field;
+    if (_caching && cachedField(&field, NULL)) {
+        return(field.rightGoal());
+    }
+
     // Gets the goal
     if (isConnected()) {
         try {
@@ -1145,6 +2089,12 @@ const Goal Controller::rightGoal() const {
 }
 
 const Position Controller::leftPenaltyMark() const {
+    // Reads the cached field, if caching
+    Field field;
+    if (_caching && cachedField(&field, NULL)) {
+        return(field.leftPenaltyMark());
+    }
+
     // Gets the mark
     if (isConnected()) {
         try {
@@ -1175,6 +2125,12 @@ const Position Controller::leftPenaltyMark() const {
 }
 
 const Position Controller::rightPenaltyMark() const {
+    // Reads the cached field, if caching
+    Field field;
+    if (_caching && cachedField(&field, NULL)) {
+        return(field.rightPenaltyMark());
+    }
+
     // Gets the mark
     if (isConnected()) {
         try {
@@ -1205,6 +2161,12 @@ const Position Controller::rightPenaltyMark() const {
 }
 
 float Controller::fieldCenterRadius() const {
+    // Reads the cached field, if caching
+    Field field;
+    if (_caching && cachedField(&field, NULL)) {
+        return(field.centerRadius());
+    }
+
     // Gets the field center radius
     if (isConnected()) {
         try {
@@ -1233,3 +2195,482 @@ float Controller::fieldCenterRadius() const {
     // Returns an invalid position
     return(0.0f);
 }
+
+
+/*** 'fieldGeometry' function
+  ** Description: Gets every field element in a single call
+  ** Receives:    [version] Where the server geometry version will be stored (if not NULL)
+  ** Returns:     The field (empty, version 0, if the call failed)
+  ***/
+const Field Controller::fieldGeometry() const {
+    return(fieldGeometry(NULL));
+}
+
+const Field Controller::fieldGeometry(quint64* version) const {
+    // Reads the cached field, if caching
+    Field field;
+    if (_caching && cachedField(&field, version)) {
+        return(field);
+    }
+
+    // Gets the field
+    if (isConnected()) {
+        try {
+            CORBATypes::FieldGeometry geometry;
+            _corbaController->fieldGeometry(geometry);
+
+            // Returns the field
+            if (version != NULL) {
+                *version = geometry.version;
+            }
+            return(Field(geometry));
+        }
+
+        // Handles CORBA exceptions
+        catch (const CORBA::Exception& exception) {
+            #ifdef GSDEBUGMSG
+            cerr << ">> GEARSystem: Controller::fieldGeometry(quint64*): ";
+            cerr << "Caught CORBA exception: " << exception._name() << "!!" << endl << flush;
+            #endif
+        }
+    }
+    else {
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: Controller::fieldGeometry(quint64*): ";
+        cerr << "The controller is not connected!!" << endl << flush;
+        #endif
+    }
+
+    // Returns an empty field
+    if (version != NULL) {
+        *version = 0;
+    }
+    return(Field());
+}
+
+
+/*** 'worldState' function
+  ** Description: Gets every team, player and ball, from the same frame, in a single call
+  ** Receives:    Nothing
+  ** Returns:     The world snapshot (empty, version 0, if the call failed)
+  ***/
+WorldSnapshotPtr Controller::worldState() const {
+    // Reads the shared world, if attached and the world fits in it
+    if (_sharedWorld != NULL) {
+        WorldSnapshotPtr world = _sharedWorld->read();
+        if (world != NULL) {
+            return(world);
+        }
+    }
+
+    // Reads the cached world, if caching
+    if (_caching) {
+        WorldSnapshotPtr world = cachedWorld();
+        if (world != NULL) {
+            return(world);
+        }
+    }
+
+    // Gets the world state
+    if (isConnected()) {
+        try {
+            CORBATypes::WorldState* state = NULL;
+            _corbaController->worldState(state);
+
+            // Returns the snapshot
+            WorldSnapshotPtr snapshot(new WorldSnapshot(*state));
+            delete state;
+            return(snapshot);
+        }
+
+        // Handles CORBA exceptions
+        catch (const CORBA::Exception& exception) {
+            #ifdef GSDEBUGMSG
+            cerr << ">> GEARSystem: Controller::worldState(): ";
+            cerr << "Caught CORBA exception: " << exception._name() << "!!" << endl << flush;
+            #endif
+        }
+    }
+    else {
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: Controller::worldState(): ";
+        cerr << "The controller is not connected!!" << endl << flush;
+        #endif
+    }
+
+    // Returns an empty snapshot
+    return(WorldSnapshotPtr(new WorldSnapshot()));
+}
+
+
+/*** 'subscribe' function
+  ** Description: Asks the server to push every committed frame to this controller
+  ** Receives:    [name] The subscriber name (unique among the controllers connected to the server)
+  ** Returns:     'true' if the subscription was made, 'false' otherwise
+  ***/
+bool Controller::subscribe(const QString& name) {
+    if (!isConnected()) {
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: Controller::subscribe(const QString&): ";
+        cerr << "The controller is not connected!!" << endl << flush;
+        #endif
+
+        return(false);
+    }
+
+    // Replaces a previous subscription (its last frame may come from an older server run)
+    unsubscribe();
+    resetLastFrame();
+
+    try {
+        // Gets the POA
+        int argc = 0;
+        CORBA::ORB_var orb = CORBA::ORB_init(argc, NULL);
+        CORBA::Object_var obj = orb->resolve_initial_references("RootPOA");
+        _poa = PortableServer::POA::_narrow(obj);
+        if (CORBA::is_nil(_poa)) {
+            _poa = NULL;
+
+            #ifdef GSDEBUGMSG
+            cerr << ">> GEARSystem: Controller::subscribe(const QString&): Could not resolve POA!!" << endl << flush;
+            #endif
+
+            return(false);
+        }
+
+        // Activates the listener
+        _corbaListener = new CORBAImplementations::WorldListener(this);
+        PortableServer::ObjectId_var listenerId = _poa->activate_object(_corbaListener);
+        _poa->the_POAManager()->activate();
+
+        // Subscribes it
+        CORBAInterfaces::WorldListener_var listener = _corbaListener->_this();
+        _corbaController->subscribe(name.toStdString().c_str(), listener);
+    }
+
+    // Handles CORBA exceptions
+    catch (const CORBA::Exception& exception) {
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: Controller::subscribe(const QString&): ";
+        cerr << "Caught CORBA exception: " << exception._name() << "!!" << endl << flush;
+        #endif
+
+        releaseListener();
+        return(false);
+    }
+
+    // Sets as subscribed
+    _subscriptionName = name;
+    _isSubscribed     = true;
+    return(true);
+}
+
+/*** 'unsubscribe' function
+  ** Description: Stops receiving frames from the server
+  ** Receives:    Nothing
+  ** Returns:     Nothing
+  ***/
+void Controller::unsubscribe() {
+    if (!_isSubscribed) {
+        return;
+    }
+
+    // Removes the subscription from the server
+    if (isConnected()) {
+        try {
+            _corbaController->unsubscribe(_subscriptionName.toStdString().c_str());
+        }
+
+        // Handles CORBA exceptions
+        catch (const CORBA::Exception& exception) {
+            #ifdef GSDEBUGMSG
+            cerr << ">> GEARSystem: Controller::unsubscribe(): ";
+            cerr << "Caught CORBA exception: " << exception._name() << "!!" << endl << flush;
+            #endif
+        }
+    }
+
+    // Sets as unsubscribed
+    releaseListener();
+    _subscriptionName.clear();
+    _isSubscribed = false;
+}
+
+/*** 'isSubscribed' function
+  ** Description: Verifies if the controller receives the frames pushed by the server
+  ** Receives:    Nothing
+  ** Returns:     'true' if it is subscribed, 'false' otherwise
+  ***/
+bool Controller::isSubscribed() const { return(_isSubscribed); }
+
+/*** 'waitForFrame' function
+  ** Description: Blocks until a frame newer than a given version is pushed by the server
+  ** Receives:    [afterVersion] The version of the last frame the caller has seen (0 for any frame)
+                  [timeout]      The maximum waiting time, in milliseconds
+  ** Returns:     The newest pushed frame (empty, version 0, if none arrived in time)
+  ***/
+WorldSnapshotPtr Controller::waitForFrame(quint64 afterVersion, uint32 timeout) {
+    // Handles the lock
+    QMutexLocker frameLocker(_frameLock);
+
+    // Waits for a newer frame
+    QElapsedTimer timer;
+    timer.start();
+    while (_lastFrame->version() <= afterVersion) {
+        const qint64 remaining = (qint64) timeout - timer.elapsed();
+        if (remaining <= 0) {
+            return(WorldSnapshotPtr(new WorldSnapshot()));
+        }
+        (void) _frameArrived->wait(_frameLock, (unsigned long) remaining);
+    }
+
+    return(_lastFrame);
+}
+
+/*** 'lastFrame' function
+  ** Description: Gets the newest frame pushed by the server, without blocking
+  ** Receives:    Nothing
+  ** Returns:     The frame (empty, version 0, if none arrived yet)
+  ***/
+WorldSnapshotPtr Controller::lastFrame() const {
+    QMutexLocker frameLocker(_frameLock);
+    return(_lastFrame);
+}
+
+/*** Listeners handling functions
+  ** Description: Registers or unregisters an object notified of each pushed frame
+  ** Receives:    [listener] The listener
+  ** Returns:     Nothing
+  ***/
+void Controller::addListener(WorldListener* listener) {
+    QMutexLocker listenersLocker(_listenersLock);
+    if (!_listeners.contains(listener)) {
+        _listeners.append(listener);
+    }
+}
+
+void Controller::removeListener(WorldListener* listener) {
+    QMutexLocker listenersLocker(_listenersLock);
+    (void) _listeners.removeAll(listener);
+}
+
+
+/*** 'frameReceived' function
+  ** Description: Stores a frame pushed by the server and notifies the waiting threads and listeners
+  ** Receives:    [frame] The frame
+  ** Returns:     Nothing
+  ***/
+void Controller::frameReceived(const WorldSnapshotPtr& frame) {
+    // Keeps the frame, unless a newer one already arrived
+    _frameLock->lock();
+    if (frame->version() <= _lastFrame->version()) {
+        _frameLock->unlock();
+        return;
+    }
+    _lastFrame = frame;
+    _frameArrived->wakeAll();
+    _frameLock->unlock();
+
+    // Notifies the listeners
+    QMutexLocker listenersLocker(_listenersLock);
+    for (int i = 0; i < _listeners.size(); i++) {
+        _listeners.at(i)->frameCommitted(frame);
+    }
+}
+
+/*** 'resetLastFrame' function
+  ** Description: Drops the last pushed frame, so the next one is accepted whatever its version
+  ** Receives:    Nothing
+  ** Returns:     Nothing
+  ***/
+void Controller::resetLastFrame() const {
+    QMutexLocker frameLocker(_frameLock);
+    _lastFrame = WorldSnapshotPtr(new WorldSnapshot());
+}
+
+/*** 'releaseListener' function
+  ** Description: Deactivates and releases the CORBA listener
+  ** Receives:    Nothing
+  ** Returns:     Nothing
+  ***/
+void Controller::releaseListener() {
+    if (_corbaListener == NULL) {
+        return;
+    }
+
+    // Deactivates it (if it was activated)
+    try {
+        PortableServer::ObjectId_var listenerId = _poa->servant_to_id(_corbaListener);
+        _poa->deactivate_object(listenerId);
+    }
+
+    // Handles CORBA exceptions
+    catch (const CORBA::Exception& exception) {
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: Controller::releaseListener(): ";
+        cerr << "Caught CORBA exception: " << exception._name() << "!!" << endl << flush;
+        #endif
+    }
+
+    // Releases it
+    _corbaListener->_remove_ref();
+    _corbaListener = NULL;
+}
+
+/*** 'cachedWorld' function
+  ** Description: Gets the cached world, fetching it again if the server version changed
+  ** Receives:    Nothing
+  ** Returns:     The world (NULL if it could not be fetched)
+  ***/
+WorldSnapshotPtr Controller::cachedWorld() const {
+    // Handles the lock
+    QMutexLocker cacheLocker(_cacheLock);
+
+    // Verifies if the cached world is outdated
+    if (!checkVersions()) {
+        return(WorldSnapshotPtr());
+    }
+
+    // Uses the last pushed frame while subscribed, unless the server changed after it (pushes only follow
+    // committed frames, not the values set one by one)
+    if (_isSubscribed) {
+        WorldSnapshotPtr frame = lastFrame();
+        if (frame->version() > 0 && frame->version() >= _serverWorldVersion) {
+            return(frame);
+        }
+    }
+    if (_cachedWorld != NULL && _cachedWorldVersion == _serverWorldVersion) {
+        return(_cachedWorld);
+    }
+
+    // Fetches it again
+    try {
+        CORBATypes::WorldState* state = NULL;
+        _corbaController->worldState(state);
+
+        // It is at least as new as the checked version (the snapshot version may lag behind it)
+        _cachedWorld        = WorldSnapshotPtr(new WorldSnapshot(*state));
+        _cachedWorldVersion = _serverWorldVersion;
+        delete state;
+    }
+
+    // Handles CORBA exceptions
+    catch (const CORBA::Exception& exception) {
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: Controller::cachedWorld(): ";
+        cerr << "Caught CORBA exception: " << exception._name() << "!!" << endl << flush;
+        #endif
+
+        return(WorldSnapshotPtr());
+    }
+
+    return(_cachedWorld);
+}
+
+/*** 'cachedField' function
+  ** Description: Gets the cached field, fetching it again if the server geometry version changed
+  ** Receives:    [field]   Where the field will be copied
+                  [version] Where its geometry version will be stored (if not NULL)
+  ** Returns:     'true' if the field was copied, 'false' if it could not be fetched
+  ***/
+bool Controller::cachedField(Field* field, quint64* version) const {
+    // Handles the lock
+    QMutexLocker cacheLocker(_cacheLock);
+
+    // Verifies if the cached field is outdated
+    if (!checkVersions()) {
+        return(false);
+    }
+    if (!_hasCachedField || _cachedGeometryVersion < _serverGeometryVersion) {
+        // Fetches it again, in a single call
+        try {
+            CORBATypes::FieldGeometry geometry;
+            _corbaController->fieldGeometry(geometry);
+
+            _cachedField           = Field(geometry);
+            _cachedGeometryVersion = geometry.version;
+            _hasCachedField        = true;
+        }
+
+        // Handles CORBA exceptions
+        catch (const CORBA::Exception& exception) {
+            #ifdef GSDEBUGMSG
+            cerr << ">> GEARSystem: Controller::cachedField(Field*, quint64*): ";
+            cerr << "Caught CORBA exception: " << exception._name() << "!!" << endl << flush;
+            #endif
+
+            _hasCachedField = false;
+            return(false);
+        }
+    }
+
+    *field = _cachedField;
+    if (version != NULL) {
+        *version = _cachedGeometryVersion;
+    }
+    return(true);
+}
+
+/*** 'checkVersions' function
+  ** Description: Gets the server versions, unless they were checked less than an interval ago
+  ** Receives:    Nothing
+  ** Returns:     'true' if the versions are known, 'false' otherwise
+  ***/
+bool Controller::checkVersions() const {
+    // Uses the last versions within the interval
+    if (_cacheTimer.isValid() && _cacheTimer.elapsed() < qint64(_cacheInterval)) {
+        return(true);
+    }
+
+    // The callers report it when not connected
+    if (!isConnected()) {
+        return(false);
+    }
+
+    // Gets the versions
+    try {
+        CORBA::ULongLong worldVersion;
+        CORBA::ULongLong geometryVersion;
+        _corbaController->versions(worldVersion, geometryVersion);
+
+        // Drops what came from an older server run
+        if (worldVersion < _serverWorldVersion || geometryVersion < _serverGeometryVersion) {
+            _cachedWorld.reset();
+            _cachedWorldVersion    = 0;
+            _cachedGeometryVersion = 0;
+            _hasCachedField        = false;
+            resetLastFrame();
+        }
+
+        _serverWorldVersion    = worldVersion;
+        _serverGeometryVersion = geometryVersion;
+        _cacheTimer.start();
+    }
+
+    // Handles CORBA exceptions
+    catch (const CORBA::Exception& exception) {
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: Controller::checkVersions(): ";
+        cerr << "Caught CORBA exception: " << exception._name() << "!!" << endl << flush;
+        #endif
+
+        return(false);
+    }
+
+    return(true);
+}
+
+/*** 'clearCache' function
+  ** Description: Drops the cached world and field
+  ** Receives:    Nothing
+  ** Returns:     Nothing
+  ***/
+void Controller::clearCache() {
+    _cacheTimer.invalidate();
+    _serverWorldVersion    = 0;
+    _serverGeometryVersion = 0;
+    _cachedWorld.reset();
+    _cachedWorldVersion    = 0;
+    _cachedGeometryVersion = 0;
+    _hasCachedField        = false;
+}
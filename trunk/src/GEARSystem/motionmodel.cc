@@ -0,0 +1,103 @@
+/*** GEARSystem - MotionModel implementation
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Includes the class header
+#include <GEARSystem/motionmodel.hh>
+
+
+// Selects namespace
+using namespace GEARSystem;
+
+
+/*** Constructor
+  ** Description: Creates the default model, with no ball deceleration
+  ** Receives:    Nothing
+  ***/
+MotionModel::MotionModel() {
+    _ballDeceleration = 0.0f;
+    _maxInterval      = defaultMaxInterval;
+}
+
+/*** Destructor
+  ** Description: Destroys the model
+  ** Receives:    Nothing
+  ***/
+MotionModel::~MotionModel() {
+}
+
+
+/*** Parameters functions
+  ** Description: Handles the model parameters
+  ** Receives:    [deceleration] The ball rolling deceleration, in distance units per squared second
+                  [interval]     The maximum prediction interval, in seconds (longer ones are clamped)
+  ** Returns:     Nothing, or the requested parameter
+  ***/
+void   MotionModel::setBallDeceleration(float deceleration) { _ballDeceleration = qMax(deceleration, 0.0f); }
+float  MotionModel::ballDeceleration() const                { return(_ballDeceleration); }
+void   MotionModel::setMaxInterval(double interval)         { _maxInterval = qMax(interval, 0.0); }
+double MotionModel::maxInterval() const                     { return(_maxInterval); }
+
+
+/*** 'predictBall' function
+  ** Description: Extrapolates a ball position
+  ** Receives:    [position] The last known position
+                  [velocity] The last known velocity
+                  [interval] The time since the position was captured, in seconds (at least 0 and at
+                             most 'maxInterval')
+  ** Returns:     The predicted position (invalid or unknown if the last position is)
+  ***/
+Position MotionModel::predictBall(const Position& position, const Velocity& velocity, double interval) const {
+    Position predicted(position);
+    if (!position.isValid() || position.isUnknown() || !velocity.isValid() || velocity.isUnknown()) {
+        return(predicted);
+    }
+
+    // Constant velocity
+    const float speed = velocity.abs();
+    float       time  = static_cast<float>(interval);
+    if ((_ballDeceleration <= 0.0f) || (speed <= 0.0f)) {
+        predicted.setPosition(position.x()+velocity.x()*time, position.y()+velocity.y()*time, position.z());
+        return(predicted);
+    }
+
+    // Constant deceleration, until the ball stops
+    time = qMin(time, speed/_ballDeceleration);
+    const float distance = speed*time - 0.5f*_ballDeceleration*time*time;
+    predicted.setPosition(position.x()+velocity.x()/speed*distance, position.y()+velocity.y()/speed*distance, position.z());
+    return(predicted);
+}
+
+/*** 'predictPlayer' function
+  ** Description: Extrapolates a player pose
+  ** Receives:    [position]     The last known position
+                  [orientation]  The last known orientation
+                  [velocity]     The last known velocity
+                  [angularSpeed] The last known angular speed
+                  [interval]     The time since the pose was captured, in seconds (at least 0 and at
+                                 most 'maxInterval')
+                  [newPosition]    Where the predicted position will be stored
+                  [newOrientation] Where the predicted orientation will be stored
+  ** Returns:     Nothing
+  ***/
+void MotionModel::predictPlayer(const Position& position, const Angle& orientation, const Velocity& velocity,
+                                const AngularSpeed& angularSpeed, double interval,
+                                Position* newPosition, Angle* newOrientation) const {
+    const float time = static_cast<float>(interval);
+
+    // Moves at constant velocity
+    *newPosition = position;
+    if (position.isValid() && !position.isUnknown() && velocity.isValid() && !velocity.isUnknown()) {
+        newPosition->setPosition(position.x()+velocity.x()*time, position.y()+velocity.y()*time, position.z());
+    }
+
+    // Turns at constant angular speed
+    *newOrientation = orientation;
+    if (orientation.isValid() && !orientation.isUnknown() && angularSpeed.isValid() && !angularSpeed.isUnknown()) {
+        newOrientation->setValue(orientation.value()+angularSpeed.value()*time);
+    }
+}
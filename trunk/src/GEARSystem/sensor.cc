@@ -27,6 +27,38 @@ using std::endl;
 using std::flush;
 
 
+/*** Constructors
+  ** Description: Creates an empty sample of player #0 of team #0, or a sample with the given values
+  ***/
+Sensor::PlayerSample::PlayerSample() {
+    teamNum   = 0;
+    playerNum = 0;
+}
+
+Sensor::PlayerSample::PlayerSample(uint8 teamNumber, uint8 playerNumber, const Position& playerPosition, const Angle& playerOrientation,
+                                   const Velocity& playerVelocity, const AngularSpeed& playerAngularSpeed) {
+    teamNum      = teamNumber;
+    playerNum    = playerNumber;
+    position     = playerPosition;
+    orientation  = playerOrientation;
+    velocity     = playerVelocity;
+    angularSpeed = playerAngularSpeed;
+}
+
+/*** Constructors
+  ** Description: Creates an empty sample of ball #0, or a sample with the given values
+  ***/
+Sensor::BallSample::BallSample() {
+    ballNum = 0;
+}
+
+Sensor::BallSample::BallSample(uint8 ballNumber, const Position& ballPosition, const Velocity& ballVelocity) {
+    ballNum  = ballNumber;
+    position = ballPosition;
+    velocity = ballVelocity;
+}
+
+
 /*** Constructor
   ** Description: Creates the sensor
   ** Receives:    Nothing
@@ -508,6 +540,160 @@ void Sensor::setBallPossession(uint8 teamNum, uint8 playerNum, bool possession)
 }
 
 
+/*** 'toCORBA' functions
+  ** Description: Copies the samples of a frame to CORBA sequences
+  ** Receives:    [players] The players seen
+                  [balls]   The balls seen
+                  [other]   The CORBA sequence
+  ** Returns:     Nothing
+  ***/
+void Sensor::toCORBA(const QList<PlayerSample>& players, CORBATypes::PlayerSampleSeq* other) {
+    other->length(players.size());
+    for (int i = 0; i < players.size(); i++) {
+        const PlayerSample& player = players.at(i);
+        (*other)[i].teamNum   = player.teamNum;
+        (*other)[i].playerNum = player.playerNum;
+        player.position.toCORBA(&(*other)[i].position);
+        player.orientation.toCORBA(&(*other)[i].orientation);
+        player.velocity.toCORBA(&(*other)[i].velocity);
+        player.angularSpeed.toCORBA(&(*other)[i].angularSpeed);
+    }
+}
+
+void Sensor::toCORBA(const QList<BallSample>& balls, CORBATypes::BallSampleSeq* other) {
+    other->length(balls.size());
+    for (int i = 0; i < balls.size(); i++) {
+        const BallSample& ball = balls.at(i);
+        (*other)[i].ballNum = ball.ballNum;
+        ball.position.toCORBA(&(*other)[i].position);
+        ball.velocity.toCORBA(&(*other)[i].velocity);
+    }
+}
+
+
+/*** Frames handling functions
+  ** Description: Groups the changes of a vision frame
+  ** Receives:    [frameId]     The frame number
+                  [captureTime] The frame capture time, in seconds
+                  [players]     The players seen
+                  [balls]       The balls seen
+  ** Returns:     Nothing
+  ***/
+void Sensor::beginFrame(uint32 frameId, double captureTime) {
+    // Opens the frame
+    if (isConnected()) {
+        try {
+            _corbaSensor->beginFrame(frameId, captureTime);
+        }
+
+        // Handles CORBA exceptions
+        catch (const CORBA::Exception& exception) {
+            #ifdef GSDEBUGMSG
+            cerr << ">> GEARSystem: Sensor::beginFrame(uint32, double): ";
+            cerr << "Caught CORBA exception: " << exception._name() << "!!" << endl << flush;
+            #endif
+        }
+    }
+    else {
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: Sensor::beginFrame(uint32, double): ";
+        cerr << "The sensor is not connected!!" << endl << flush;
+        #endif
+    }
+}
+
+void Sensor::stageSamples(uint32 frameId, const QList<PlayerSample>& players, const QList<BallSample>& balls) {
+    // Stages the samples
+    if (isConnected()) {
+        try {
+            CORBATypes::PlayerSampleSeq corbaPlayers;
+            CORBATypes::BallSampleSeq   corbaBalls;
+            toCORBA(players, &corbaPlayers);
+            toCORBA(balls, &corbaBalls);
+            _corbaSensor->stageSamples(frameId, corbaPlayers, corbaBalls);
+        }
+
+        // Handles CORBA exceptions
+        catch (const CORBA::Exception& exception) {
+            #ifdef GSDEBUGMSG
+            cerr << ">> GEARSystem: Sensor::stageSamples(uint32, const QList<PlayerSample>&, const QList<BallSample>&): ";
+            cerr << "Caught CORBA exception: " << exception._name() << "!!" << endl << flush;
+            #endif
+        }
+    }
+    else {
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: Sensor::stageSamples(uint32, const QList<PlayerSample>&, const QList<BallSample>&): ";
+        cerr << "The sensor is not connected!!" << endl << flush;
+        #endif
+    }
+}
+
+void Sensor::commitFrame(uint32 frameId) {
+    // Commits the frame
+    if (isConnected()) {
+        try {
+            _corbaSensor->commitFrame(frameId);
+        }
+
+        // Handles CORBA exceptions
+        catch (const CORBA::Exception& exception) {
+            #ifdef GSDEBUGMSG
+            cerr << ">> GEARSystem: Sensor::commitFrame(uint32): ";
+            cerr << "Caught CORBA exception: " << exception._name() << "!!" << endl << flush;
+            #endif
+        }
+    }
+    else {
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: Sensor::commitFrame(uint32): ";
+        cerr << "The sensor is not connected!!" << endl << flush;
+        #endif
+    }
+}
+
+/*** 'pushFrame' function
+  ** Description: Sends a whole vision frame in a single call, applied by the server at once
+  ** Receives:    [frameId]     The frame number
+                  [captureTime] The frame capture time, in seconds
+                  [players]     The players seen
+                  [balls]       The balls seen
+  ** Returns:     Nothing
+  ***/
+void Sensor::pushFrame(uint32 frameId, double captureTime, const QList<PlayerSample>& players, const QList<BallSample>& balls) {
+    // Sends the frame
+    if (isConnected()) {
+        try {
+            // Copies the samples
+            CORBATypes::PlayerSampleSeq corbaPlayers;
+            CORBATypes::BallSampleSeq   corbaBalls;
+            toCORBA(players, &corbaPlayers);
+            toCORBA(balls, &corbaBalls);
+
+            // Sends them
+            CORBATypes::FrameInfo frameInfo;
+            frameInfo.frameId     = frameId;
+            frameInfo.captureTime = captureTime;
+            _corbaSensor->pushFrame(corbaPlayers, corbaBalls, frameInfo);
+        }
+
+        // Handles CORBA exceptions
+        catch (const CORBA::Exception& exception) {
+            #ifdef GSDEBUGMSG
+            cerr << ">> GEARSystem: Sensor::pushFrame(uint32, double, const QList<PlayerSample>&, const QList<BallSample>&): ";
+            cerr << "Caught CORBA exception: " << exception._name() << "!!" << endl << flush;
+            #endif
+        }
+    }
+    else {
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: Sensor::pushFrame(uint32, double, const QList<PlayerSample>&, const QList<BallSample>&): ";
+        cerr << "The sensor is not connected!!" << endl << flush;
+        #endif
+    }
+}
+
+
 /*** Field handling functions
   ** Description: Handles field info
   ***/
@@ -806,3 +992,34 @@ void Sensor::setFieldCenterRadius(float centerRadius) {
         #endif
     }
 }
+
+/*** 'setFieldGeometry' function
+  ** Description: Replaces every field element at once, in a single call
+  ** Receives:    [field] The field
+  ** Returns:     Nothing
+  ***/
+void Sensor::setFieldGeometry(const Field& field) {
+    // Sets the field
+    if (isConnected()) {
+        try {
+            CORBATypes::FieldGeometry geometry;
+            field.toCORBA(&geometry);
+            geometry.version = 0;
+            _corbaSensor->setFieldGeometry(geometry);
+        }
+
+        // Handles CORBA exceptions
+        catch (const CORBA::Exception& exception) {
+            #ifdef GSDEBUGMSG
+            cerr << ">> GEARSystem: Sensor::setFieldGeometry(const Field&): ";
+            cerr << "Caught CORBA exception: " << exception._name() << "!!" << endl << flush;
+            #endif
+        }
+    }
+    else {
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: Sensor::setFieldGeometry(const Field&): ";
+        cerr << "The sensor is not connected!!" << endl << flush;
+        #endif
+    }
+}
@@ -21,6 +21,7 @@
 #include <GEARSystem/CORBAImplementations/corbasensor.hh>
 #include <GEARSystem/CORBAImplementations/corbacommandbus.hh>
 #include <GEARSystem/CORBAImplementations/corbaradiosensor.hh>
+#include <GEARSystem/worldmap.hh>
 
 
 // Selects namespace
@@ -50,6 +51,18 @@ Server::Server(CORBAImplementations::Controller* controller, CORBAImplementation
     _sensor      =  sensor;
     _radioSensor =  radioSensor;
     _commandBus  =  commandBus;
+
+    // The world isn't shared until asked
+    _sharedWorld    = NULL;
+    _sharedWorldMap = NULL;
+}
+
+/*** Destructor
+  ** Description: Destroys the server
+  ** Receives:    Nothing
+  ***/
+Server::~Server() {
+    unshareWorld();
 }
 
 
@@ -207,6 +220,72 @@ void Server::stop() {
 }
 
 
+/*** 'shareWorld' function
+  ** Description: Publishes the world in a shared memory segment, rewritten after every change, so
+                  controllers on this host can read it without going through CORBA
+  ** Receives:    [key] The segment key (SharedWorld::defaultKey if not given)
+  ** Returns:     'true' if the segment was created, 'false' otherwise
+  ** Comments:    Each change builds a snapshot of the whole world and copies it into the segment. Values
+                  set one by one are written once per batch when the sensor has an ingest stage, but once
+                  per call without one, so fast sensors should use an ingest stage or frames
+  ***/
+bool Server::shareWorld() {
+    return(shareWorld(SharedWorld::defaultKey));
+}
+
+bool Server::shareWorld(const QString& key) {
+    // Replaces a previously shared world
+    unshareWorld();
+
+    // Creates the segment
+    SharedWorld* sharedWorld = new SharedWorld(key);
+    if (!sharedWorld->create()) {
+        delete sharedWorld;
+
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: Server::shareWorld(): Could not create the shared world!!" << endl << flush;
+        #endif
+
+        return(false);
+    }
+
+    // Writes every change from now on, and the current world
+    _sharedWorld    = sharedWorld;
+    _sharedWorldMap = _controller->worldMap();
+    _sharedWorldMap->addUpdateListener(_sharedWorld);
+    _sharedWorld->write(_sharedWorldMap->snapshot());
+
+    // Returns 'true' if everything went OK
+    return(true);
+}
+
+/*** 'unshareWorld' function
+  ** Description: Stops publishing the world and removes the segment
+  ** Receives:    Nothing
+  ** Returns:     Nothing
+  ***/
+void Server::unshareWorld() {
+    if (_sharedWorld == NULL) {
+        return;
+    }
+
+    _sharedWorldMap->removeUpdateListener(_sharedWorld);
+    delete _sharedWorld;
+
+    _sharedWorld    = NULL;
+    _sharedWorldMap = NULL;
+}
+
+/*** 'isWorldShared' function
+  ** Description: Verifies if the world is being published in a shared memory segment
+  ** Receives:    Nothing
+  ** Returns:     'true' if they are, 'false' otherwise
+  ***/
+bool Server::isWorldShared() const {
+    return(_sharedWorld != NULL);
+}
+
+
 /*** 'bindController' function
   ** Description: Binds the controller at the name service
   ** Receives:    Nothing
@@ -0,0 +1,478 @@
+/*** GEARSystem - SharedWorld implementation
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Includes the class header
+#include <GEARSystem/sharedworld.hh>
+
+
+// Includes standard library
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+
+// Inlcudes IO streams
+#include <iostream>
+
+
+// Selects namespace
+using namespace GEARSystem;
+using std::cerr;
+using std::endl;
+
+
+// Default segment key
+const char* const SharedWorld::defaultKey = "GEARSystem.World";
+
+// Identifies the segment layout (changes whenever the layout changes)
+static const quint32 sharedWorldMagic = 0x47530003;
+
+// Value states
+static const quint8 sharedInvalid = 0;
+static const quint8 sharedUnknown = 1;
+static const quint8 sharedKnown   = 2;
+
+
+/*** Constructor
+  ** Description: Creates a detached shared world
+  ** Receives:    [key] The segment key
+  ***/
+SharedWorld::SharedWorld(const QString& key) {
+    _memory   = new QSharedMemory(key);
+    _frame    = NULL;
+    _isWriter = false;
+
+    _localData      = new Data;
+    _cachedSequence = 0;
+
+    _lock = new QMutex;
+}
+
+/*** Destructor
+  ** Description: Detaches from the segment and destroys the shared world
+  ** Receives:    Nothing
+  ***/
+SharedWorld::~SharedWorld() {
+    detach();
+
+    delete _memory;
+    delete _localData;
+    delete _lock;
+}
+
+
+/*** 'create' function
+  ** Description: Creates the segment, to be written by this process
+  ** Receives:    Nothing
+  ** Returns:     'true' if the segment was created, 'false' otherwise
+  ** Comments:    A segment left by a crashed server is removed and created again
+  ***/
+bool SharedWorld::create() {
+    QMutexLocker locker(_lock);
+
+    if (_frame != NULL) {
+        return(_isWriter);
+    }
+
+    // Reclaims a segment left by a server that crashed: detaching the last attachment removes it on Unix,
+    // while a segment still used by a running server survives, and the creation below fails
+    if (!_memory->create(sizeof(Frame), QSharedMemory::ReadWrite) &&
+        (_memory->error() == QSharedMemory::AlreadyExists) && _memory->attach(QSharedMemory::ReadOnly)) {
+        (void) _memory->detach();
+        (void) _memory->create(sizeof(Frame), QSharedMemory::ReadWrite);
+    }
+    if (!_memory->isAttached()) {
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: SharedWorld::create(): " << _memory->errorString().toStdString() << endl;
+        #endif
+        return(false);
+    }
+
+    // Starts with an empty frame
+    _frame = static_cast<Frame*>(_memory->data());
+    std::memset(static_cast<void*>(&_frame->data), 0, sizeof(Data));
+    _frame->sequence.store(0);
+    _frame->magic = sharedWorldMagic;
+    std::atomic_thread_fence(std::memory_order_release);
+
+    _isWriter = true;
+    return(true);
+}
+
+/*** 'attach' function
+  ** Description: Attaches to a segment created by the server, for reading
+  ** Receives:    Nothing
+  ** Returns:     'true' if the segment was found, 'false' otherwise
+  ***/
+bool SharedWorld::attach() {
+    QMutexLocker locker(_lock);
+
+    if (_frame != NULL) {
+        return(true);
+    }
+
+    if (!_memory->attach(QSharedMemory::ReadOnly)) {
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: SharedWorld::attach(): " << _memory->errorString().toStdString() << endl;
+        #endif
+        return(false);
+    }
+
+    // Refuses segments written with another layout
+    const Frame* frame = static_cast<const Frame*>(_memory->constData());
+    if ((static_cast<size_t>(_memory->size()) < sizeof(Frame)) || (frame->magic != sharedWorldMagic)) {
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: SharedWorld::attach(): The segment layout doesn't match!!" << endl;
+        #endif
+        (void) _memory->detach();
+        return(false);
+    }
+
+    // The frame is only read through the mapping
+    _frame    = const_cast<Frame*>(frame);
+    _isWriter = false;
+    return(true);
+}
+
+/*** 'detach' function
+  ** Description: Detaches from the segment
+  ** Receives:    Nothing
+  ** Returns:     Nothing
+  ***/
+void SharedWorld::detach() {
+    QMutexLocker locker(_lock);
+
+    if (_frame == NULL) {
+        return;
+    }
+
+    (void) _memory->detach();
+    _frame    = NULL;
+    _isWriter = false;
+
+    _cachedSequence = 0;
+    _cachedSnapshot.reset();
+}
+
+/*** 'isAttached' function
+  ** Description: Verifies if the segment is attached
+  ** Receives:    Nothing
+  ** Returns:     'true' if it is attached, 'false' otherwise
+  ***/
+bool SharedWorld::isAttached() const {
+    QMutexLocker locker(_lock);
+    return(_frame != NULL);
+}
+
+
+/*** 'write' function
+  ** Description: Writes a snapshot into the segment
+  ** Receives:    [snapshot] The snapshot
+  ** Returns:     Nothing
+  ** Comments:    If the players don't fit, the segment is marked as truncated and readers get no world
+  ***/
+void SharedWorld::write(const WorldSnapshotPtr& snapshot) {
+    QMutexLocker locker(_lock);
+
+    if ((_frame == NULL) || (!_isWriter) || (!snapshot)) {
+        return;
+    }
+
+    // Keeps a newer world written by a concurrent change (this is the only writer, so the read needs no retry)
+    if (snapshot->version() < _frame->data.version) {
+        return;
+    }
+
+    // Builds the data locally, so the segment is only busy while it is copied
+    Data& data = *_localData;
+    data.version     = snapshot->version();
+    data.frameId     = snapshot->frameId();
+    data.captureTime = snapshot->captureTime();
+    data.nTeams      = 0;
+    data.nPlayers    = 0;
+    data.nBalls      = 0;
+    data.truncated   = 0;
+
+    const QList<uint8> teamsList = snapshot->teams();
+    for (int i = 0; (i < teamsList.size()) && (data.nTeams < static_cast<quint32>(maxTeams)); i++) {
+        const uint8 teamNum = teamsList.at(i);
+
+        Team& team = data.teams[data.nTeams++];
+        team.teamNum = teamNum;
+        (void) qstrncpy(team.name, snapshot->teamName(teamNum).toUtf8().constData(), maxNameLength);
+
+        const QList<uint8> playersList = snapshot->players(teamNum);
+        for (int j = 0; j < playersList.size(); j++) {
+            const uint8 playerNum = playersList.at(j);
+            if (data.nPlayers == static_cast<quint32>(maxPlayers)) {
+                data.truncated = 1;
+                break;
+            }
+
+            Player& player = data.players[data.nPlayers++];
+            player.teamNum         = teamNum;
+            player.playerNum       = playerNum;
+            player.ballPossession  = snapshot->ballPossession(teamNum, playerNum);
+            player.kickEnabled     = snapshot->kickEnabled(teamNum, playerNum);
+            player.dribbleEnabled  = snapshot->dribbleEnabled(teamNum, playerNum);
+            player.batteryCharge   = snapshot->batteryCharge(teamNum, playerNum);
+            player.capacitorCharge = snapshot->capacitorCharge(teamNum, playerNum);
+            toShared(snapshot->playerPosition(teamNum, playerNum), &player.position);
+            toShared(snapshot->playerOrientation(teamNum, playerNum), &player.orientation);
+            toShared(snapshot->playerVelocity(teamNum, playerNum), &player.velocity);
+            toShared(snapshot->playerAngularSpeed(teamNum, playerNum), &player.angularSpeed);
+        }
+    }
+
+    const QList<uint8> ballsList = snapshot->balls();
+    for (int i = 0; (i < ballsList.size()) && (data.nBalls < static_cast<quint32>(maxBalls)); i++) {
+        Ball& ball = data.balls[data.nBalls++];
+        ball.ballNum = ballsList.at(i);
+        toShared(snapshot->ballPosition(ball.ballNum), &ball.position);
+        toShared(snapshot->ballVelocity(ball.ballNum), &ball.velocity);
+    }
+
+    // Writes the data between two sequence increments, copying only the used entries
+    const quint32 sequence = _frame->sequence.load();
+    _frame->sequence.store(sequence + 1);
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(static_cast<void*>(&_frame->data), &data, offsetof(Data, teams));
+    std::memcpy(static_cast<void*>(_frame->data.teams), data.teams, data.nTeams*sizeof(Team));
+    std::memcpy(static_cast<void*>(_frame->data.players), data.players, data.nPlayers*sizeof(Player));
+    std::memcpy(static_cast<void*>(_frame->data.balls), data.balls, data.nBalls*sizeof(Ball));
+    _frame->sequence.storeRelease(sequence + 2);
+}
+
+/*** 'frameCommitted' function
+  ** Description: Writes each committed frame into the segment
+  ** Receives:    [snapshot] The world right after the frame was committed
+  ** Returns:     Nothing
+  ***/
+void SharedWorld::frameCommitted(const WorldSnapshotPtr& snapshot) {
+    write(snapshot);
+}
+
+/*** 'worldUpdated' function
+  ** Description: Writes the world into the segment after each change
+  ** Receives:    [snapshot] The world right after the change
+  ** Returns:     Nothing
+  ***/
+void SharedWorld::worldUpdated(const WorldSnapshotPtr& snapshot) {
+    write(snapshot);
+}
+
+/*** 'read' function
+  ** Description: Reads a consistent copy of the frame in the segment
+  ** Receives:    Nothing
+  ** Returns:     The frame (empty, version 0, if the segment isn't attached). While the segment
+                  doesn't change, the same snapshot is returned without copying
+  ***/
+WorldSnapshotPtr SharedWorld::read() const {
+    QMutexLocker locker(_lock);
+
+    if (_frame == NULL) {
+        return(WorldSnapshotPtr(new WorldSnapshot));
+    }
+
+    // Copies the data, retrying if a write happened meanwhile
+    quint32 sequence;
+    forever {
+        sequence = _frame->sequence.loadAcquire();
+        if (sequence & 1) {
+            QThread::yieldCurrentThread();
+            continue;
+        }
+
+        if ((sequence == _cachedSequence) && (_cachedSnapshot)) {
+            return(_cachedSnapshot);
+        }
+
+        // Copies the header, then only the used entries
+        Data& data = *_localData;
+        std::memcpy(_localData, static_cast<const void*>(&_frame->data), offsetof(Data, teams));
+        data.nTeams   = qMin(data.nTeams, static_cast<quint32>(maxTeams));
+        data.nPlayers = qMin(data.nPlayers, static_cast<quint32>(maxPlayers));
+        data.nBalls   = qMin(data.nBalls, static_cast<quint32>(maxBalls));
+        std::memcpy(data.teams, static_cast<const void*>(_frame->data.teams), data.nTeams*sizeof(Team));
+        std::memcpy(data.players, static_cast<const void*>(_frame->data.players), data.nPlayers*sizeof(Player));
+        std::memcpy(data.balls, static_cast<const void*>(_frame->data.balls), data.nBalls*sizeof(Ball));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (_frame->sequence.load() == sequence) {
+            break;
+        }
+    }
+
+    // Gives no world if it didn't fit, so the caller gets it some other way
+    const Data& data = *_localData;
+    if (data.truncated) {
+        _cachedSequence = 0;
+        _cachedSnapshot.reset();
+        return(WorldSnapshotPtr());
+    }
+
+    // Builds the snapshot
+    WorldSnapshot* snapshot = new WorldSnapshot;
+    snapshot->_version     = data.version;
+    snapshot->_frameId     = data.frameId;
+    snapshot->_captureTime = data.captureTime;
+
+    for (quint32 i = 0; i < data.nTeams; i++) {
+        const Team& team = data.teams[i];
+        snapshot->_teams[team.teamNum].name = QString::fromUtf8(team.name, qstrnlen(team.name, maxNameLength));
+    }
+
+    // The writer stores the players in ascending order, so each one is appended to its team
+    for (quint32 i = 0; i < data.nPlayers; i++) {
+        const Player& player = data.players[i];
+        QHash<uint8,WorldSnapshot::TeamState>::iterator it = snapshot->_teams.find(player.teamNum);
+        if (it == snapshot->_teams.end()) {
+            continue;
+        }
+
+        QVector<PlayerState>& players = it.value().players;
+        if (!players.isEmpty() && (players.last().playerNum() >= player.playerNum)) {
+            continue;
+        }
+        players.append(PlayerState(player.teamNum, player.playerNum, positionFromShared(player.position),
+                                   angleFromShared(player.orientation), velocityFromShared(player.velocity),
+                                   angularSpeedFromShared(player.angularSpeed), player.ballPossession,
+                                   player.kickEnabled, player.dribbleEnabled, player.batteryCharge,
+                                   player.capacitorCharge));
+    }
+
+    for (quint32 i = 0; i < data.nBalls; i++) {
+        const Ball& ball = data.balls[i];
+        (void) snapshot->_ballsPositions.insert(ball.ballNum, positionFromShared(ball.position));
+        (void) snapshot->_ballsVelocities.insert(ball.ballNum, velocityFromShared(ball.velocity));
+    }
+
+    _cachedSequence = sequence;
+    _cachedSnapshot = WorldSnapshotPtr(snapshot);
+    return(_cachedSnapshot);
+}
+
+/*** 'version' function
+  ** Description: Gets the version of the frame in the segment, without copying it
+  ** Receives:    Nothing
+  ** Returns:     The version (0 if the segment isn't attached)
+  ***/
+quint64 SharedWorld::version() const {
+    QMutexLocker locker(_lock);
+
+    if (_frame == NULL) {
+        return(0);
+    }
+
+    forever {
+        const quint32 sequence = _frame->sequence.loadAcquire();
+        if (sequence & 1) {
+            QThread::yieldCurrentThread();
+            continue;
+        }
+
+        const quint64 version = _frame->data.version;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (_frame->sequence.load() == sequence) {
+            return(version);
+        }
+    }
+}
+
+
+/*** Conversion functions
+  ** Description: Convert the world types to and from the segment values
+  ** Receives:    [value] The value
+                  [other] The value to be set
+  ** Returns:     Nothing, or the converted value
+  ***/
+void SharedWorld::toShared(const Position& value, Value* other) {
+    other->state = (!value.isValid())? sharedInvalid : (value.isUnknown())? sharedUnknown : sharedKnown;
+    other->v[0]  = value.x();
+    other->v[1]  = value.y();
+    other->v[2]  = value.z();
+
+    other->frameId     = value.frameId();
+    other->captureTime = value.captureTime();
+}
+
+void SharedWorld::toShared(const Angle& value, Value* other) {
+    other->state = (!value.isValid())? sharedInvalid : (value.isUnknown())? sharedUnknown : sharedKnown;
+    other->v[0]  = value.value();
+    other->v[1]  = 0.0;
+    other->v[2]  = 0.0;
+
+    other->frameId     = value.frameId();
+    other->captureTime = value.captureTime();
+}
+
+void SharedWorld::toShared(const Velocity& value, Value* other) {
+    other->state = (!value.isValid())? sharedInvalid : (value.isUnknown())? sharedUnknown : sharedKnown;
+    other->v[0]  = value.x();
+    other->v[1]  = value.y();
+    other->v[2]  = 0.0;
+
+    other->frameId     = value.frameId();
+    other->captureTime = value.captureTime();
+}
+
+void SharedWorld::toShared(const AngularSpeed& value, Value* other) {
+    other->state = (!value.isValid())? sharedInvalid : (value.isUnknown())? sharedUnknown : sharedKnown;
+    other->v[0]  = value.value();
+    other->v[1]  = 0.0;
+    other->v[2]  = 0.0;
+
+    other->frameId     = value.frameId();
+    other->captureTime = value.captureTime();
+}
+
+Position SharedWorld::positionFromShared(const Value& value) {
+    Position position(true, value.v[0], value.v[1], value.v[2]);
+    if (value.state == sharedUnknown) {
+        position.setUnknown();
+    } else if (value.state != sharedKnown) {
+        position.setInvalid();
+    }
+    position.setCapture(value.frameId, value.captureTime);
+
+    return(position);
+}
+
+Angle SharedWorld::angleFromShared(const Value& value) {
+    Angle angle(true, value.v[0]);
+    if (value.state == sharedUnknown) {
+        angle.setUnknown();
+    } else if (value.state != sharedKnown) {
+        angle.setInvalid();
+    }
+    angle.setCapture(value.frameId, value.captureTime);
+
+    return(angle);
+}
+
+Velocity SharedWorld::velocityFromShared(const Value& value) {
+    Velocity velocity(true, value.v[0], value.v[1]);
+    if (value.state == sharedUnknown) {
+        velocity.setUnknown();
+    } else if (value.state != sharedKnown) {
+        velocity.setInvalid();
+    }
+    velocity.setCapture(value.frameId, value.captureTime);
+
+    return(velocity);
+}
+
+AngularSpeed SharedWorld::angularSpeedFromShared(const Value& value) {
+    AngularSpeed angularSpeed(true, value.v[0]);
+    if (value.state == sharedUnknown) {
+        angularSpeed.setUnknown();
+    } else if (value.state != sharedKnown) {
+        angularSpeed.setInvalid();
+    }
+    angularSpeed.setCapture(value.frameId, value.captureTime);
+
+    return(angularSpeed);
+}
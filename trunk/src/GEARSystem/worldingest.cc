@@ -0,0 +1,431 @@
+/*** GEARSystem - WorldIngest implementation
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Includes the class header
+#include <GEARSystem/worldingest.hh>
+
+
+// Inlcudes Qt library
+#include <QtCore/QtCore>
+
+
+// Selects namespace
+using namespace GEARSystem;
+
+
+/*** Constructor
+  ** Description: Creates empty metrics
+  ** Receives:    Nothing
+  ***/
+WorldIngest::Metrics::Metrics() {
+    depth         = 0;
+    maxDepth      = 0;
+    pushed        = 0;
+    applied       = 0;
+    batches       = 0;
+    stalls        = 0;
+    lastLatency   = 0.0;
+    maxLatency    = 0.0;
+    meanLatency   = 0.0;
+    lastApplyTime = 0.0;
+    maxApplyTime  = 0.0;
+}
+
+
+/*** Constructors
+  ** Description: Creates the ingest stage and starts its thread
+  ** Receives:    [worldMap] The world map the updates are applied to
+                  [capacity] The queue capacity (rounded up to a power of two)
+  ***/
+WorldIngest::WorldIngest(WorldMap* worldMap) {
+    setup(worldMap, defaultCapacity);
+}
+
+WorldIngest::WorldIngest(WorldMap* worldMap, int capacity) {
+    setup(worldMap, capacity);
+}
+
+/*** Destructor
+  ** Description: Applies the queued updates, stops the thread and destroys the ingest stage
+  ** Receives:    Nothing
+  ***/
+WorldIngest::~WorldIngest() {
+    // Stops the thread (it drains the ring before returning)
+    _sleepLock->lock();
+    _running.store(0);
+    _wakeCondition->wakeAll();
+    _sleepLock->unlock();
+
+    (void) wait();
+
+    // Deletes the ring and the locks
+    delete[] _slots;
+    delete _wakeCondition;
+    delete _sleepLock;
+}
+
+/*** 'setup' function
+  ** Description: Creates the ring and starts the thread
+  ** Receives:    [worldMap] The world map the updates are applied to
+                  [capacity] The queue capacity
+  ** Returns:     Nothing
+  ***/
+void WorldIngest::setup(WorldMap* worldMap, int capacity) {
+    _worldMap = worldMap;
+
+    // Creates the ring
+    quint32 size = 2;
+    while (size < quint32(qMax(capacity, 2))) {
+        size <<= 1;
+    }
+    _mask  = size-1;
+    _slots = new Slot[size];
+    for (quint32 i = 0; i < size; i++) {
+        _slots[i].sequence.store(i);
+    }
+    _tail.store(0);
+    _head.store(0);
+    _done.store(0);
+
+    // Creates the locks
+    _sleepLock     = new QMutex();
+    _wakeCondition = new QWaitCondition();
+
+    // Clears the metrics
+    _clock.start();
+    resetMetrics();
+
+    // Starts the thread
+    _running.store(1);
+    _sleeping.store(0);
+    start();
+}
+
+
+/*** 'push' functions
+  ** Description: Queues a ball or player update, applied right away or staged in a frame
+  ** Receives:    [frameId]     The number of the frame the update is staged in
+                  [worldUpdate] The update
+  ** Returns:     Nothing
+  ** Comments:    Waits for a free slot if the queue is full
+  ***/
+void WorldIngest::push(const WorldUpdate& worldUpdate) {
+    Item item;
+    item.type        = Update;
+    item.update      = worldUpdate;
+    item.frameId     = 0;
+    item.captureTime = 0.0;
+    enqueue(item);
+}
+
+void WorldIngest::push(quint32 frameId, const WorldUpdate& worldUpdate) {
+    Item item;
+    item.type        = FrameUpdate;
+    item.update      = worldUpdate;
+    item.frameId     = frameId;
+    item.captureTime = 0.0;
+    enqueue(item);
+}
+
+/*** Frames handling functions
+  ** Description: Queues the opening or the commit of a frame
+  ** Receives:    [frameId]     The frame number
+                  [captureTime] The frame capture time, in seconds
+  ** Returns:     Nothing
+  ***/
+void WorldIngest::beginFrame(quint32 frameId, double captureTime) {
+    Item item;
+    item.type        = BeginFrame;
+    item.frameId     = frameId;
+    item.captureTime = captureTime;
+    enqueue(item);
+}
+
+void WorldIngest::commitFrame(quint32 frameId) {
+    Item item;
+    item.type        = CommitFrame;
+    item.frameId     = frameId;
+    item.captureTime = 0.0;
+    enqueue(item);
+}
+
+/*** 'pushFrame' function
+  ** Description: Queues a whole frame, applied at once with 'WorldMap::applyFrame'
+  ** Receives:    [frameId]     The frame number
+                  [captureTime] The frame capture time, in seconds
+                  [updates]     The frame changes
+  ** Returns:     Nothing
+  ***/
+void WorldIngest::pushFrame(quint32 frameId, double captureTime, const QList<WorldUpdate>& updates) {
+    Item item;
+    item.type        = Frame;
+    item.frame       = updates;
+    item.frameId     = frameId;
+    item.captureTime = captureTime;
+    enqueue(item);
+}
+
+/*** 'flush' function
+  ** Description: Waits until everything queued before the call is applied
+  ** Receives:    Nothing
+  ** Returns:     Nothing
+  ***/
+void WorldIngest::flush() {
+    const quint32 target = _tail.loadAcquire();
+    while (qint32(_done.loadAcquire() - target) < 0) {
+        QThread::yieldCurrentThread();
+    }
+}
+
+
+/*** 'capacity' function
+  ** Description: Gets the queue capacity
+  ** Receives:    Nothing
+  ** Returns:     The number of items the queue holds
+  ***/
+int WorldIngest::capacity() const {
+    return(int(_mask+1));
+}
+
+/*** 'depth' function
+  ** Description: Gets the number of items waiting in the queue
+  ** Receives:    Nothing
+  ** Returns:     The queue depth
+  ***/
+int WorldIngest::depth() const {
+    // Claimed slots count as waiting, even if their producer is still writing them
+    const quint32 head = _head.loadAcquire();
+    const quint32 tail = _tail.loadAcquire();
+    return(qMax(qint32(tail-head), 0));
+}
+
+/*** Metrics functions
+  ** Description: Gets or clears the queue and apply metrics
+  ** Receives:    Nothing
+  ** Returns:     The metrics, or nothing
+  ***/
+WorldIngest::Metrics WorldIngest::metrics() const {
+    Metrics metrics;
+    metrics.depth         = depth();
+    metrics.maxDepth      = _maxDepth.loadAcquire();
+    metrics.applied       = _applied.loadAcquire();
+    metrics.pushed        = metrics.applied + metrics.depth;
+    metrics.batches       = _batches.loadAcquire();
+    metrics.stalls        = _stalls.loadAcquire();
+    metrics.lastLatency   = _lastLatency.loadAcquire()*1e-9;
+    metrics.maxLatency    = _maxLatency.loadAcquire()*1e-9;
+    metrics.meanLatency   = (metrics.applied > 0)? (_latencySum.loadAcquire()*1e-9)/metrics.applied : 0.0;
+    metrics.lastApplyTime = _lastApplyTime.loadAcquire()*1e-9;
+    metrics.maxApplyTime  = _maxApplyTime.loadAcquire()*1e-9;
+    return(metrics);
+}
+
+void WorldIngest::resetMetrics() {
+    _stalls.store(0);
+    _applied.store(0);
+    _batches.store(0);
+    _maxDepth.store(0);
+    _latencySum.store(0);
+    _lastLatency.store(0);
+    _maxLatency.store(0);
+    _lastApplyTime.store(0);
+    _maxApplyTime.store(0);
+}
+
+
+/*** 'run' function
+  ** Description: Applies the queued items until the ingest stage is destroyed
+  ** Receives:    Nothing
+  ** Returns:     Nothing
+  ***/
+void WorldIngest::run() {
+    forever {
+        if (applyBatch() > 0) {
+            continue;
+        }
+
+        // Leaves once stopped and drained
+        if (_running.loadAcquire() == 0 && depth() == 0) {
+            return;
+        }
+
+        waitForItems();
+    }
+}
+
+
+/*** 'enqueue' function
+  ** Description: Stores an item in the ring and wakes the apply thread if it sleeps
+  ** Receives:    [item] The item
+  ** Returns:     Nothing
+  ***/
+void WorldIngest::enqueue(const Item& item) {
+    bool stalled = false;
+
+    // Claims the slot at the tail
+    quint32 position = _tail.loadAcquire();
+    Slot*   slot;
+    forever {
+        slot = &_slots[position & _mask];
+        const qint32 lap = qint32(slot->sequence.loadAcquire() - position);
+        if (lap == 0) {
+            if (_tail.testAndSetOrdered(position, position+1)) {
+                break;
+            }
+        }
+        else if (lap < 0) {
+            // The slot still holds an item of the previous lap: the ring is full
+            if (!stalled) {
+                stalled = true;
+                (void) _stalls.fetchAndAddRelaxed(1);
+            }
+            QThread::yieldCurrentThread();
+        }
+        position = _tail.loadAcquire();
+    }
+
+    // Fills and publishes it
+    slot->item          = item;
+    slot->item.pushTime = _clock.nsecsElapsed();
+    (void) slot->sequence.fetchAndStoreOrdered(position+1);
+
+    // Wakes the apply thread. Publishing and reading the flag are ordered operations, as are raising the flag
+    // and checking the ring in 'waitForItems', so either the apply thread sees the item or this sees it asleep
+    if (_sleeping.fetchAndAddOrdered(0) != 0) {
+        QMutexLocker sleepLocker(_sleepLock);
+        _wakeCondition->wakeOne();
+    }
+}
+
+/*** 'dequeue' function
+  ** Description: Takes the oldest item of the ring
+  ** Receives:    [item] Where the item will be stored
+  ** Returns:     'true' if an item was taken, 'false' if the ring is empty
+  ***/
+bool WorldIngest::dequeue(Item* item) {
+    const quint32 position = _head.load();
+    Slot& slot = _slots[position & _mask];
+
+    // Verifies if the slot was published for this lap
+    if (qint32(slot.sequence.loadAcquire() - (position+1)) < 0) {
+        return(false);
+    }
+
+    // Takes the item and frees the slot for the next lap (dropping its frame list, if any)
+    *item = slot.item;
+    slot.item.frame.clear();
+    slot.sequence.storeRelease(position+_mask+1);
+    _head.storeRelease(position+1);
+    return(true);
+}
+
+/*** 'applyBatch' function
+  ** Description: Drains up to 'maxBatchSize' items into the world map
+  ** Receives:    Nothing
+  ** Returns:     The number of items applied
+  ***/
+int WorldIngest::applyBatch() {
+    // Records the depth seen
+    const int waiting = depth();
+    if (waiting > _maxDepth.loadAcquire()) {
+        _maxDepth.store(waiting);
+    }
+
+    // Applies the items, handing each run of updates to the map at once
+    const qint64 start = _clock.nsecsElapsed();
+    QList<WorldUpdate> updates;
+    qint64 pushTimesSum = 0;
+    qint64 oldestPush   = 0;
+    int    count        = 0;
+    Item   item;
+    while (count < maxBatchSize && dequeue(&item)) {
+        if (count == 0) {
+            oldestPush = item.pushTime;
+        }
+        pushTimesSum += item.pushTime;
+        count++;
+
+        switch (item.type) {
+            case Update:
+                updates.append(item.update);
+                break;
+
+            case FrameUpdate:
+                _worldMap->stageUpdate(item.frameId, item.update);
+                break;
+
+            case BeginFrame:
+                _worldMap->applyUpdates(updates);
+                updates.clear();
+                _worldMap->beginFrame(item.frameId, item.captureTime);
+                break;
+
+            case CommitFrame:
+                _worldMap->applyUpdates(updates);
+                updates.clear();
+                _worldMap->commitFrame(item.frameId);
+                break;
+
+            case Frame:
+                _worldMap->applyUpdates(updates);
+                updates.clear();
+                _worldMap->applyFrame(item.frameId, item.captureTime, item.frame);
+                break;
+        }
+    }
+    _worldMap->applyUpdates(updates);
+    if (count == 0) {
+        return(0);
+    }
+
+    // Marks the items as done
+    _done.storeRelease(_head.load());
+
+    // Updates the metrics
+    const qint64 end = _clock.nsecsElapsed();
+    (void) _applied.fetchAndAddRelaxed(count);
+    (void) _batches.fetchAndAddRelaxed(1);
+    (void) _latencySum.fetchAndAddRelaxed(end*count - pushTimesSum);
+    _lastLatency.store(end-oldestPush);
+    storeMax(_maxLatency, end-oldestPush);
+    _lastApplyTime.store(end-start);
+    storeMax(_maxApplyTime, end-start);
+
+    return(count);
+}
+
+/*** 'waitForItems' function
+  ** Description: Sleeps until an item is pushed
+  ** Receives:    Nothing
+  ** Returns:     Nothing
+  ***/
+void WorldIngest::waitForItems() {
+    QMutexLocker sleepLocker(_sleepLock);
+
+    // Announces the sleep, then checks the ring again so a push made meanwhile isn't missed
+    (void) _sleeping.fetchAndStoreOrdered(1);
+    const quint32 position = _head.load();
+    const bool    empty    = qint32(_slots[position & _mask].sequence.fetchAndAddOrdered(0) - (position+1)) < 0;
+    if (empty && _running.loadAcquire() != 0) {
+        (void) _wakeCondition->wait(_sleepLock);
+    }
+    _sleeping.store(0);
+}
+
+/*** 'storeMax' function
+  ** Description: Raises an atomic maximum
+  ** Receives:    [maximum] The maximum
+                  [value]   The new value
+  ** Returns:     Nothing
+  ***/
+void WorldIngest::storeMax(QAtomicInteger<qint64>& maximum, qint64 value) {
+    qint64 current = maximum.loadAcquire();
+    while (value > current && !maximum.testAndSetOrdered(current, value)) {
+        current = maximum.loadAcquire();
+    }
+}
@@ -0,0 +1,31 @@
+/*** GEARSystem - WorldListener implementation
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Includes the class header
+#include <GEARSystem/worldlistener.hh>
+
+
+// Selects namespace
+using namespace GEARSystem;
+
+
+/*** Destructor
+  ** Description: Destroys the listener
+  ** Receives:    Nothing
+  ***/
+WorldListener::~WorldListener() {
+}
+
+
+/*** 'worldUpdated' function
+  ** Description: Receives the world after any change
+  ** Receives:    [snapshot] The world right after the change
+  ** Returns:     Nothing
+  ***/
+void WorldListener::worldUpdated(const WorldSnapshotPtr&) {
+}
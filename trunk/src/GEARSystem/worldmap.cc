@@ -16,6 +16,9 @@
 // Inlcudes IO streams
 #include <iostream>
 
+// Includes standard library
+#include <algorithm>
+
 
 // Selects namespace
 using namespace GEARSystem;
@@ -33,24 +36,698 @@ WorldMap::WorldMap() {
     _nGEARSystemTeams = 0;
     _nBalls = 0;
 
-    _validGEARSystemTeams.clear();
-    _teams.clear();
-    _validBalls.clear();
-    _ballsPositions.clear();
-    _ballsVelocities.clear();
+    _validGEARSystemTeams.reset();
+    _validBalls.reset();
+    for (int i = 0; i < _maxEntities; i++) {
+        _teams[i] = NULL;
+    }
+
+    // Fills the teams pool (it never holds more than one team per number, so it never grows)
+    _teamPool.reserve(_maxEntities);
+    _teamAllocations.store(0);
+    _teamReuses.store(0);
+    reserveTeams(defaultTeamPoolSize);
 
     // Creates the locks
-    //#ifdef GSTHREADSAFE
-    _ballsLock = new QReadWriteLock();
-    _teamsLock = new QReadWriteLock();
-    //#endif
+    _publishLock   = new QMutex();
+    _frameLock     = new QMutex();
+    _listenersLock = new QMutex();
+    _indexLock     = new QMutex();
+    _nUpdateListeners.store(0);
+
+    // Initializes the frames
+    _frameClock.start();
+    _frameTimeout = defaultFrameTimeout;
+    _frameId      = 0;
+    _captureTime  = 0.0;
+
+    // Initializes the history
+    _historyLength = defaultHistoryLength;
+
+    // Uses the default motion model
+    _motionModel = new MotionModel();
+
+    // Marks the spatial index as outdated
+    _indexVersion = quint64(-1);
+
+    // Publishes the empty world
+    _snapshotMode = false;
+    _version.store(0);
+    _geometryVersion.store(0);
+    _rosterVersion.store(0);
+    _snapshot = WorldSnapshotPtr(new WorldSnapshot());
 }
 
 WorldMap::~WorldMap() {
-    //#ifdef GSTHREADSAFE
-    delete _ballsLock;
-    delete _teamsLock;
-    //#endif
+    // Deletes the teams
+    for (int i = 0; i < _maxEntities; i++) {
+        delete _teams[i];
+    }
+    qDeleteAll(_teamPool);
+
+    delete _publishLock;
+    delete _frameLock;
+    delete _listenersLock;
+    delete _indexLock;
+
+    // Deletes the motion model
+    delete _motionModel;
+}
+
+
+/*** Snapshot handling functions
+  ** Description: Handles the snapshot mode and the published snapshots
+  ***/
+void WorldMap::setSnapshotMode(bool enable) {
+    _snapshotMode = enable;
+
+    // Publishes the current state
+    if (enable) {
+        publishSnapshot();
+    }
+}
+
+bool WorldMap::snapshotMode() const { return(_snapshotMode); }
+
+quint64 WorldMap::version() const { return(_version.loadAcquire()); }
+
+quint64 WorldMap::geometryVersion() const { return(_geometryVersion.loadAcquire()); }
+
+WorldSnapshotPtr WorldMap::snapshot() const {
+    // Returns the published snapshot
+    if (_snapshotMode) {
+        return(std::atomic_load(&_snapshot));
+    }
+
+    // Builds one from the shared state
+    return(buildSnapshot());
+}
+
+void WorldMap::publishSnapshot() {
+    // Serializes the publishers, so a newer state is never replaced by an older one
+    QMutexLocker publishLocker(_publishLock);
+
+    // Swaps the snapshot
+    std::atomic_store(&_snapshot, buildSnapshot());
+}
+
+WorldSnapshotPtr WorldMap::buildSnapshot() const {
+    WorldSnapshot* snapshot = new WorldSnapshot();
+
+    // Locks every team at once, so the snapshot never mixes two frames
+    ReadLocker rosterLocker(_rosterLock);
+    const IdBitmap teams = rosterTeams();
+    lockTeamsForRead(teams);
+    _ballsLock.lockForRead();
+    snapshot->_version     = _version.loadAcquire();
+    snapshot->_frameId     = _frameId;
+    snapshot->_captureTime = _captureTime;
+
+    // Copies the teams (only their names and the players in them, not the whole player slots)
+    const QList<quint8> teamsList = teams.toList();
+    for (int i = 0; i < teamsList.size(); i++) {
+        const GEARSystemTeam* team = _teams[teamsList.at(i)];
+        WorldSnapshot::TeamState& teamState = snapshot->_teams[teamsList.at(i)];
+        teamState.name    = team->name();
+        teamState.players = team->playerStates();
+    }
+
+    // Copies the balls
+    const QList<quint8> ballsList = _validBalls.toList();
+    for (int i = 0; i < ballsList.size(); i++) {
+        (void) snapshot->_ballsPositions.insert(ballsList.at(i), _ballsPositions[ballsList.at(i)]);
+        (void) snapshot->_ballsVelocities.insert(ballsList.at(i), _ballsVelocities[ballsList.at(i)]);
+    }
+    _ballsLock.unlock();
+    unlockTeams(teams);
+    rosterLocker.unlock();
+
+    // Copies the field
+    snapshot->_field = _field;
+
+    // Returns the snapshot
+    return(WorldSnapshotPtr(snapshot));
+}
+
+/*** Frames handling functions
+  ** Description: Opens, fills and commits the frames; the updates staged in a frame are applied at once
+  ***/
+void WorldMap::beginFrame(quint32 frameId, double captureTime) {
+    QMutexLocker frameLocker(_frameLock);
+
+    // Drops the frames of the sensors that stopped
+    expireFrames();
+
+    // Restarts an unfinished frame of the same number
+    QHash<quint32,OpenFrame>::iterator it = _openFrames.find(frameId);
+    if (it != _openFrames.end()) {
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: WorldMap::beginFrame(quint32, double): Frame #" << frameId;
+        cerr << " was not committed, dropping " << it.value().updates.size() << " updates!!" << endl << flush;
+        #endif
+        _openFrames.erase(it);
+    }
+
+    // Opens the frame
+    OpenFrame& frame  = _openFrames[frameId];
+    frame.captureTime = captureTime;
+    frame.openTime    = _frameClock.elapsed();
+}
+
+void WorldMap::stageUpdate(quint32 frameId, const WorldUpdate& worldUpdate) {
+    // Stages the change in its frame
+    QMutexLocker frameLocker(_frameLock);
+    QHash<quint32,OpenFrame>::iterator it = _openFrames.find(frameId);
+    if (it != _openFrames.end()) {
+        it.value().updates.append(worldUpdate);
+        it.value().updates.last().setCapture(frameId, it.value().captureTime);
+        return;
+    }
+    frameLocker.unlock();
+
+    // Applies it if the frame was dropped
+    #ifdef GSDEBUGMSG
+    cerr << ">> GEARSystem: WorldMap::stageUpdate(quint32, const WorldUpdate&): Frame #" << frameId;
+    cerr << " is not open, applying the update!!" << endl << flush;
+    #endif
+    update(worldUpdate);
+}
+
+void WorldMap::stageUpdates(quint32 frameId, const QList<WorldUpdate>& updates) {
+    // Stages the changes in their frame
+    QMutexLocker frameLocker(_frameLock);
+    QHash<quint32,OpenFrame>::iterator it = _openFrames.find(frameId);
+    if (it != _openFrames.end()) {
+        QList<WorldUpdate>& staged = it.value().updates;
+        for (int i = 0; i < updates.size(); i++) {
+            staged.append(updates.at(i));
+            staged.last().setCapture(frameId, it.value().captureTime);
+        }
+        return;
+    }
+    frameLocker.unlock();
+
+    // Applies them if the frame was dropped
+    #ifdef GSDEBUGMSG
+    cerr << ">> GEARSystem: WorldMap::stageUpdates(quint32, const QList<WorldUpdate>&): Frame #" << frameId;
+    cerr << " is not open, applying the updates!!" << endl << flush;
+    #endif
+    applyUpdates(updates);
+}
+
+void WorldMap::commitFrame(quint32 frameId) {
+    // Takes the staged updates
+    QMutexLocker frameLocker(_frameLock);
+    QHash<quint32,OpenFrame>::iterator it = _openFrames.find(frameId);
+    if (it == _openFrames.end()) {
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: WorldMap::commitFrame(quint32): Frame #" << frameId << " is not open!!" << endl << flush;
+        #endif
+        return;
+    }
+    QList<WorldUpdate> updates;
+    updates.swap(it.value().updates);
+    const double captureTime = it.value().captureTime;
+    _openFrames.erase(it);
+    frameLocker.unlock();
+
+    // Applies the frame
+    publishFrame(updates, frameId, captureTime);
+}
+
+void WorldMap::abandonFrame(quint32 frameId) {
+    QMutexLocker frameLocker(_frameLock);
+    (void) _openFrames.remove(frameId);
+}
+
+bool WorldMap::inFrame(quint32 frameId) const {
+    QMutexLocker frameLocker(_frameLock);
+    return(_openFrames.contains(frameId));
+}
+
+/*** Frame timeout functions
+  ** Description: Handles how long an open frame waits for its commit
+  ** Receives:    [msecs] The timeout, in milliseconds (0 or less keeps the frames open)
+  ** Returns:     Nothing, or the timeout
+  ***/
+void WorldMap::setFrameTimeout(int msecs) {
+    QMutexLocker frameLocker(_frameLock);
+    _frameTimeout = msecs;
+}
+
+int WorldMap::frameTimeout() const {
+    QMutexLocker frameLocker(_frameLock);
+    return(_frameTimeout);
+}
+
+/*** 'expireFrames' function
+  ** Description: Drops the open frames that waited longer than the frame timeout for their commit
+  ** Receives:    Nothing
+  ** Returns:     Nothing
+  ***/
+void WorldMap::expireFrames() {
+    if (_frameTimeout <= 0) {
+        return;
+    }
+
+    // Drops the expired frames
+    const qint64 now = _frameClock.elapsed();
+    QHash<quint32,OpenFrame>::iterator it = _openFrames.begin();
+    while (it != _openFrames.end()) {
+        if (now - it.value().openTime > _frameTimeout) {
+            #ifdef GSDEBUGMSG
+            cerr << ">> GEARSystem: WorldMap::expireFrames(): Frame #" << it.key() << " timed out, dropping ";
+            cerr << it.value().updates.size() << " updates!!" << endl << flush;
+            #endif
+            it = _openFrames.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+}
+
+quint32 WorldMap::frameId() const {
+    ReadLocker ballsLocker(_ballsLock);
+    return(_frameId);
+}
+
+double WorldMap::captureTime() const {
+    ReadLocker ballsLocker(_ballsLock);
+    return(_captureTime);
+}
+
+
+/*** 'applyUpdates' function
+  ** Description: Applies and publishes all the changes at once
+  ** Receives:    [updates] The changes
+  ** Returns:     Nothing
+  ***/
+void WorldMap::applyUpdates(const QList<WorldUpdate>& updates) {
+    if (updates.isEmpty()) {
+        return;
+    }
+
+    // Applies them under the locks of the changed teams and the balls lock
+    const IdBitmap teams = changedTeams(updates);
+    _rosterLock.lockForRead();
+    lockTeamsForWrite(teams);
+    _ballsLock.lockForWrite();
+    for (int i = 0; i < updates.size(); i++) {
+        apply(updates.at(i));
+    }
+    _ballsLock.unlock();
+    unlockTeams(teams);
+    _rosterLock.unlock();
+
+    // Publishes the changes
+    updated();
+}
+
+/*** 'applyFrame' function
+  ** Description: Applies a whole frame at once, as 'beginFrame', 'stageUpdate' and 'commitFrame' would
+  ** Receives:    [frameId]     The frame number
+                  [captureTime] The frame capture time, in seconds
+                  [updates]     The frame changes
+  ** Returns:     Nothing
+  ***/
+void WorldMap::applyFrame(quint32 frameId, double captureTime, const QList<WorldUpdate>& updates) {
+    // Stamps the values that carry no capture info
+    QList<WorldUpdate> frame = updates;
+    for (int i = 0; i < frame.size(); i++) {
+        frame[i].setCapture(frameId, captureTime);
+    }
+
+    // Applies the frame
+    publishFrame(frame, frameId, captureTime);
+}
+
+
+/*** Listeners handling functions
+  ** Description: Registers or unregisters an object notified after each 'commitFrame'
+  ** Receives:    [listener] The listener
+  ** Returns:     Nothing
+  ***/
+void WorldMap::addListener(WorldListener* listener) const {
+    QMutexLocker listenersLocker(_listenersLock);
+    if (!_listeners.contains(listener)) {
+        _listeners.append(listener);
+    }
+}
+
+void WorldMap::removeListener(WorldListener* listener) const {
+    QMutexLocker listenersLocker(_listenersLock);
+    (void) _listeners.removeAll(listener);
+}
+
+/*** Update listeners handling functions
+  ** Description: Registers or unregisters an object notified with 'worldUpdated' after every change
+  ** Receives:    [listener] The listener
+  ** Returns:     Nothing
+  ***/
+void WorldMap::addUpdateListener(WorldListener* listener) const {
+    QMutexLocker listenersLocker(_listenersLock);
+    if (!_updateListeners.contains(listener)) {
+        _updateListeners.append(listener);
+        _nUpdateListeners.storeRelease(_updateListeners.size());
+    }
+}
+
+void WorldMap::removeUpdateListener(WorldListener* listener) const {
+    QMutexLocker listenersLocker(_listenersLock);
+    (void) _updateListeners.removeAll(listener);
+    _nUpdateListeners.storeRelease(_updateListeners.size());
+}
+
+
+/*** 'update' function
+  ** Description: Applies and publishes a change right away
+  ** Receives:    [worldUpdate] The change
+  ** Returns:     Nothing
+  ***/
+void WorldMap::update(const WorldUpdate& worldUpdate) {
+    // Applies it
+    ReadLocker rosterLocker(_rosterLock);
+    Lock& lock = worldUpdate.isBall()? _ballsLock : _teamLocks[worldUpdate.teamNum()];
+    lock.lockForWrite();
+    apply(worldUpdate);
+    lock.unlock();
+    rosterLocker.unlock();
+
+    // Publishes the change
+    updated();
+}
+
+
+/*** 'apply' function
+  ** Description: Applies a change to the shared state
+  ** Receives:    [worldUpdate] The change
+  ** Returns:     Nothing
+  ** Comments:    Must be called with the roster lock and the write lock of the changed ball or team held
+  ***/
+void WorldMap::apply(const WorldUpdate& worldUpdate) {
+    // Balls updates
+    if (worldUpdate.isBall()) {
+        const uint8 ballNum = worldUpdate.ballNum();
+        if (!_validBalls.test(ballNum)) {
+            #ifdef GSDEBUGMSG
+            cerr << ">> GEARSystem: WorldMap::apply(const WorldUpdate&): No such Ball #";
+            cerr << int(ballNum) << " in this map!!" << endl << flush;
+            #endif
+            return;
+        }
+
+        // Sets the ball position or velocity
+        if (worldUpdate.type() == WorldUpdate::BallPosition) {
+            _ballsPositions[ballNum] = worldUpdate.position();
+        }
+        else {
+            _ballsVelocities[ballNum] = worldUpdate.velocity();
+        }
+        return;
+    }
+
+    // Players updates
+    const uint8 teamNum   = worldUpdate.teamNum();
+    const uint8 playerNum = worldUpdate.playerNum();
+    if (!_validGEARSystemTeams.test(teamNum)) {
+        #ifdef GSDEBUGMSG
+        cerr << ">> GEARSystem: WorldMap::apply(const WorldUpdate&): No such GEARSystemTeam #";
+        cerr << int(teamNum) << " in this map!!" << endl << flush;
+        #endif
+        return;
+    }
+
+    // Sets the player value
+    GEARSystemTeam& team = *(_teams[teamNum]);
+    switch (worldUpdate.type()) {
+        case WorldUpdate::PlayerPosition:     team.setPosition(playerNum, worldUpdate.position());              break;
+        case WorldUpdate::PlayerOrientation:  team.setOrientation(playerNum, worldUpdate.orientation());        break;
+        case WorldUpdate::PlayerVelocity:     team.setVelocity(playerNum, worldUpdate.velocity());              break;
+        case WorldUpdate::PlayerAngularSpeed: team.setAngularSpeed(playerNum, worldUpdate.angularSpeed());      break;
+        case WorldUpdate::BallPossession:     team.setBallPossession(playerNum, worldUpdate.flag());            break;
+        case WorldUpdate::KickEnabled:        team.setPlayerKickStatus(playerNum, worldUpdate.flag());          break;
+        case WorldUpdate::DribbleEnabled:     team.setPlayerDribbleStatus(playerNum, worldUpdate.flag());       break;
+        case WorldUpdate::BatteryCharge:      team.setPlayerBatteryCharge(playerNum, worldUpdate.charge());     break;
+        case WorldUpdate::CapacitorCharge:    team.setPlayerCapacitorCharge(playerNum, worldUpdate.charge());   break;
+        default: break;
+    }
+}
+
+/*** 'record' function
+  ** Description: Stores a sample of each ball and player changed by a committed frame
+  ** Receives:    [updates]     The frame updates
+                  [captureTime] The frame capture time
+  ** Returns:     Nothing
+  ** Comments:    Must be called with the roster lock and the changed teams and balls locks held
+  ***/
+void WorldMap::record(const QList<WorldUpdate>& updates, double captureTime) {
+    WriteLocker historyLocker(_historyLock);
+    if (_historyLength == 0) {
+        return;
+    }
+
+    // Finds the balls and the teams whose pose changed
+    IdBitmap balls;
+    IdBitmap teams;
+    for (int i = 0; i < updates.size(); i++) {
+        const WorldUpdate& worldUpdate = updates.at(i);
+        switch (worldUpdate.type()) {
+            case WorldUpdate::BallPosition:
+            case WorldUpdate::BallVelocity:
+                (void) balls.set(worldUpdate.ballNum());
+                break;
+
+            case WorldUpdate::PlayerPosition:
+            case WorldUpdate::PlayerOrientation:
+            case WorldUpdate::PlayerVelocity:
+                (void) teams.set(worldUpdate.teamNum());
+                break;
+
+            default: break;
+        }
+    }
+
+    // Stores the balls samples
+    for (int ballNum = 0; ballNum < _maxEntities; ballNum++) {
+        if (!balls.test(ballNum) || !_validBalls.test(ballNum)) {
+            continue;
+        }
+
+        QHash<uint8,TrajectoryHistory>::iterator it = _ballsHistory.find(ballNum);
+        if (it == _ballsHistory.end()) {
+            it = _ballsHistory.insert(ballNum, TrajectoryHistory(_historyLength));
+        }
+        it.value().append(TrajectorySample(captureTime, _ballsPositions[ballNum], Angle(), _ballsVelocities[ballNum]));
+    }
+
+    // Stores the players samples, one team at a time
+    for (int teamNum = 0; teamNum < _maxEntities; teamNum++) {
+        if (!teams.test(teamNum) || !_validGEARSystemTeams.test(teamNum)) {
+            continue;
+        }
+
+        // Finds the players of the team whose pose changed
+        IdBitmap players;
+        for (int i = 0; i < updates.size(); i++) {
+            const WorldUpdate& worldUpdate = updates.at(i);
+            const WorldUpdate::Type type = worldUpdate.type();
+            const bool pose = (type == WorldUpdate::PlayerPosition) || (type == WorldUpdate::PlayerOrientation) ||
+                              (type == WorldUpdate::PlayerVelocity);
+            if (pose && (worldUpdate.teamNum() == teamNum)) {
+                (void) players.set(worldUpdate.playerNum());
+            }
+        }
+
+        const GEARSystemTeam& team = *(_teams[teamNum]);
+        const IdBitmap teamPlayers = team.playersBitmap();
+        for (int playerNum = 0; playerNum < _maxEntities; playerNum++) {
+            if (!players.test(playerNum) || !teamPlayers.test(playerNum)) {
+                continue;
+            }
+
+            const quint16 key = (quint16(teamNum) << 8) | playerNum;
+            QHash<quint16,TrajectoryHistory>::iterator it = _playersHistory.find(key);
+            if (it == _playersHistory.end()) {
+                it = _playersHistory.insert(key, TrajectoryHistory(_historyLength));
+            }
+            it.value().append(TrajectorySample(captureTime, *(team.position(playerNum)), *(team.orientation(playerNum)), *(team.velocity(playerNum))));
+        }
+    }
+}
+
+/*** 'publishFrame' function
+  ** Description: Applies the updates of a frame at once, records them, publishes the world and notifies the
+                  listeners
+  ** Receives:    [updates]     The frame updates
+                  [frameId]     The frame number
+                  [captureTime] The frame capture time, in seconds
+  ** Returns:     Nothing
+  ***/
+void WorldMap::publishFrame(const QList<WorldUpdate>& updates, quint32 frameId, double captureTime) {
+    // Applies the whole frame under their locks and the balls lock (which also guards the frame info)
+    const IdBitmap teams = changedTeams(updates);
+    _rosterLock.lockForRead();
+    lockTeamsForWrite(teams);
+    _ballsLock.lockForWrite();
+    for (int i = 0; i < updates.size(); i++) {
+        apply(updates.at(i));
+    }
+    _frameId     = frameId;
+    _captureTime = captureTime;
+    record(updates, captureTime);
+    _ballsLock.unlock();
+    unlockTeams(teams);
+    _rosterLock.unlock();
+
+    // Publishes the frame
+    updated();
+
+    // Notifies the listeners
+    QMutexLocker listenersLocker(_listenersLock);
+    if (!_listeners.isEmpty()) {
+        const WorldSnapshotPtr frame = snapshot();
+        for (int i = 0; i < _listeners.size(); i++) {
+            _listeners.at(i)->frameCommitted(frame);
+        }
+    }
+}
+
+/*** 'predictionInterval' function
+  ** Description: Calculates how far a value must be predicted
+  ** Receives:    [captureTime]     The value capture time (0 if it has none)
+                  [lastCaptureTime] The capture time of the last frame, used if the value has none
+                  [time]            The wanted time
+  ** Returns:     The interval, bounded by the motion model (0 if no frame was captured yet)
+  ** Comments:    Must be called with the motion model lock held
+  ***/
+double WorldMap::predictionInterval(double captureTime, double lastCaptureTime, double time) const {
+    // Without a capture time the value can't be extrapolated
+    const double reference = (captureTime != 0.0)? captureTime : lastCaptureTime;
+    if (reference == 0.0) {
+        return(0.0);
+    }
+
+    return(qBound(0.0, time-reference, _motionModel->maxInterval()));
+}
+
+/*** 'updateIndex' function
+  ** Description: Packs the known player positions into the spatial index, if the map changed since the
+                  last call
+  ** Receives:    Nothing
+  ** Returns:     Nothing
+  ** Comments:    Must be called with the index lock held
+  ***/
+void WorldMap::updateIndex() const {
+    // Reads the published snapshot
+    if (_snapshotMode) {
+        const WorldSnapshotPtr frame = snapshot();
+        if (frame->version() == _indexVersion) {
+            return;
+        }
+
+        // Packs the positions
+        (void) BatchGeometry::packPlayers(*frame, IdBitmap(), &_indexX, &_indexY, NULL, &_indexPlayers);
+        _indexVersion = frame->version();
+        return;
+    }
+
+    // Reads the version before the state, so a change made meanwhile triggers the next rebuild
+    const quint64 version = this->version();
+    if (version == _indexVersion) {
+        return;
+    }
+
+    // Packs the positions, one team at a time
+    ReadLocker rosterLocker(_rosterLock);
+    _indexX.clear();
+    _indexY.clear();
+    _indexPlayers.clear();
+    const QList<quint8> teamsList = _validGEARSystemTeams.toList();
+    for (int i = 0; i < teamsList.size(); i++) {
+        const uint8 teamNum = teamsList.at(i);
+        ReadLocker teamLocker(_teamLocks[teamNum]);
+        const QList<uint8> players = _teams[teamNum]->players();
+        for (int j = 0; j < players.size(); j++) {
+            const Position* position = _teams[teamNum]->position(players.at(j));
+            if (position->isUnknown() || !position->isValid()) {
+                continue;
+            }
+            _indexX.append(position->x());
+            _indexY.append(position->y());
+            _indexPlayers.append((quint16(teamNum) << 8) | players.at(j));
+        }
+    }
+    _indexVersion = version;
+}
+
+void WorldMap::lockTeamsForRead(const IdBitmap& teams) const {
+    const QList<quint8> teamsList = teams.toList();
+    for (int i = 0; i < teamsList.size(); i++) {
+        _teamLocks[teamsList.at(i)].lockForRead();
+    }
+}
+
+void WorldMap::lockTeamsForWrite(const IdBitmap& teams) const {
+    const QList<quint8> teamsList = teams.toList();
+    for (int i = 0; i < teamsList.size(); i++) {
+        _teamLocks[teamsList.at(i)].lockForWrite();
+    }
+}
+
+void WorldMap::unlockTeams(const IdBitmap& teams) const {
+    const QList<quint8> teamsList = teams.toList();
+    for (int i = teamsList.size()-1; i >= 0; i--) {
+        _teamLocks[teamsList.at(i)].unlock();
+    }
+}
+
+IdBitmap WorldMap::changedTeams(const QList<WorldUpdate>& updates) {
+    IdBitmap teams;
+    for (int i = 0; i < updates.size(); i++) {
+        if (!updates.at(i).isBall()) {
+            (void) teams.set(updates.at(i).teamNum());
+        }
+    }
+    return(teams);
+}
+
+IdBitmap WorldMap::rosterTeams() const {
+    return(_validGEARSystemTeams);
+}
+
+GEARSystemTeam* WorldMap::newTeam() {
+    // The team is guarded by the roster lock and its team lock, so it doesn't lock itself
+    GEARSystemTeam* team = new GEARSystemTeam();
+    team->setExternalLocking(true);
+    return(team);
+}
+
+void WorldMap::updated() {
+    // Bumps the version
+    (void) _version.fetchAndAddOrdered(1);
+
+    // Publishes the change
+    if (_snapshotMode) {
+        publishSnapshot();
+    }
+
+    // Notifies the update listeners
+    if (_nUpdateListeners.loadAcquire() > 0) {
+        QMutexLocker listenersLocker(_listenersLock);
+        if (!_updateListeners.isEmpty()) {
+            const WorldSnapshotPtr world = snapshot();
+            for (int i = 0; i < _updateListeners.size(); i++) {
+                _updateListeners.at(i)->worldUpdated(world);
+            }
+        }
+    }
+}
+
+void WorldMap::geometryUpdated() {
+    // Bumps the geometry version before the map version, so a reader seeing the new map version sees it too
+    (void) _geometryVersion.fetchAndAddOrdered(1);
+    updated();
 }
 
 /*** GEARSystemTeams handling functions
@@ -61,63 +738,146 @@ WorldMap::~WorldMap() {
   ***/
 void WorldMap::addTeam(uint8 teamNum, const QString& name) {
     // Handles the lock
-    //#ifdef GSTHREADSAFE
-    QWriteLocker teamsLocker(_teamsLock);
+    WriteLocker rosterLocker(_rosterLock);
     // TODO: Fix fault at this point
-    //#endif
 
-    // Adds the team
-    (void) _teams.remove(teamNum);
-    (void) _validGEARSystemTeams.insert(teamNum, true);
-    _teams[teamNum] = GEARSystemTeam(teamNum, name);
-    _nGEARSystemTeams++;
+    // Takes a team from the pool (an existing team is replaced by an empty one)
+    if (_teams[teamNum] == NULL) {
+        if (_teamPool.isEmpty()) {
+            _teamPool.append(newTeam());
+            (void) _teamAllocations.fetchAndAddRelaxed(1);
+        }
+        else {
+            (void) _teamReuses.fetchAndAddRelaxed(1);
+        }
+        _teams[teamNum] = _teamPool.takeLast();
+        (void) _validGEARSystemTeams.set(teamNum);
+        _nGEARSystemTeams++;
+    }
+    _teams[teamNum]->reset(teamNum, name);
+    (void) _rosterVersion.fetchAndAddOrdered(1);
+
+    // Publishes the change
+    rosterLocker.unlock();
+    updated();
 }
 
 void WorldMap::delGEARSystemTeam(uint8 teamNum) {
     // Handles the lock
-    //#ifdef GSTHREADSAFE
-    QWriteLocker teamsLocker(_teamsLock);
+    WriteLocker rosterLocker(_rosterLock);
     // TODO: Fix fault at this point
-    //#endif
 
-    // Deletes the team
-    (void) _validGEARSystemTeams.remove(teamNum);
-    (void) _teams.remove(teamNum);
-    _nGEARSystemTeams--;
+    // Gives the team back to the pool
+    if (_teams[teamNum] != NULL) {
+        _teamPool.append(_teams[teamNum]);
+        _teams[teamNum] = NULL;
+        (void) _validGEARSystemTeams.clear(teamNum);
+        _nGEARSystemTeams--;
+        (void) _rosterVersion.fetchAndAddOrdered(1);
+    }
+
+    // Drops its players histories
+    _historyLock.lockForWrite();
+    QMutableHashIterator<quint16,TrajectoryHistory> it(_playersHistory);
+    while (it.hasNext()) {
+        if ((it.next().key() >> 8) == teamNum) {
+            it.remove();
+        }
+    }
+    _historyLock.unlock();
+
+    // Publishes the change
+    rosterLocker.unlock();
+    updated();
 }
 
 QList<uint8> WorldMap::teams() const {
+    // Reads the published snapshot
+    if (_snapshotMode) {
+        return(snapshot()->teams());
+    }
+
     // Handles the lock
-    //#ifdef GSTHREADSAFE
-    QReadLocker teamsLocker(_teamsLock);
+    ReadLocker rosterLocker(_rosterLock);
     // TODO: Fix fault at this point
-    //#endif
 
-    // Adds the teams to the list
-    QList<uint8> teamsList;
-    QHashIterator<uint8,GEARSystemTeam> it(_teams);
-    while (it.hasNext()) {
-        teamsList.append(it.next().key());
+    // Returns the list
+    return(_validGEARSystemTeams.toList());
+}
+
+
+/*** Entity pool functions
+  ** Description: Handles the pool the teams are taken from
+  ** Receives:    [teams] The number of free teams the pool must hold
+  ** Returns:     Nothing, the number of free teams, or the number of teams allocated or reused since the map
+                  was created
+  ***/
+void WorldMap::reserveTeams(int teams) {
+    WriteLocker rosterLocker(_rosterLock);
+
+    // Allocates the missing teams (no more than the numbers left free)
+    const int maxTeams = qMin(teams, _maxEntities-_nGEARSystemTeams);
+    while (_teamPool.size() < maxTeams) {
+        _teamPool.append(newTeam());
+        (void) _teamAllocations.fetchAndAddRelaxed(1);
     }
+}
 
-    // Returns the list
-    return(teamsList);
+int WorldMap::pooledTeams() const {
+    ReadLocker rosterLocker(_rosterLock);
+    return(_teamPool.size());
 }
 
+quint64 WorldMap::teamAllocations() const { return(_teamAllocations.loadAcquire()); }
+
+quint64 WorldMap::teamReuses() const { return(_teamReuses.loadAcquire()); }
+
+
+/*** Roster functions
+  ** Description: Gets which teams, players and balls exist, as bitmaps, and the roster version
+  ** Receives:    [teamNum]      The team number
+                  [sinceVersion] A roster version seen before
+  ** Returns:     The teams, players or balls bitmap, the roster version, or 'true' if the roster changed after
+                  'sinceVersion'
+  ***/
+IdBitmap WorldMap::teamsBitmap() const {
+    ReadLocker rosterLocker(_rosterLock);
+    return(_validGEARSystemTeams);
+}
+
+IdBitmap WorldMap::playersBitmap(uint8 teamNum) const {
+    ReadLocker rosterLocker(_rosterLock);
+    if (_validGEARSystemTeams.test(teamNum)) {
+        return(_teams[teamNum]->playersBitmap());
+    }
+    return(IdBitmap());
+}
+
+IdBitmap WorldMap::ballsBitmap() const {
+    ReadLocker ballsLocker(_ballsLock);
+    return(_validBalls);
+}
+
+quint64 WorldMap::rosterVersion() const { return(_rosterVersion.loadAcquire()); }
+
+bool WorldMap::rosterChanged(quint64 sinceVersion) const { return(rosterVersion() > sinceVersion); }
 
 /*** GEARSystemTeam info functions
   ** Description: Controls team name and number
   ***/
 const QString WorldMap::teamName(uint8 teamNum) const {
+    // Reads the published snapshot
+    if (_snapshotMode) {
+        return(snapshot()->teamName(teamNum));
+    }
+
     // Handles the lock
-    //#ifdef GSTHREADSAFE
-    QReadLocker teamsLocker(_teamsLock);
+    ReadLocker rosterLocker(_rosterLock);
     // TODO: Fix fault at this point
-    //#endif
 
     // Returns the team name
-    if (_validGEARSystemTeams.value(teamNum)) {
-        return(_teams[teamNum].name());
+    if (_validGEARSystemTeams.test(teamNum)) {
+        return(_teams[teamNum]->name());
     }
     else {
         #ifdef GSDEBUGMSG
@@ -131,18 +891,20 @@ const QString WorldMap::teamName(uint8 teamNum) const {
 }
 
 uint8 WorldMap::teamNumber(const QString& name) const {
+    // Reads the published snapshot
+    if (_snapshotMode) {
+        return(snapshot()->teamNumber(name));
+    }
+
     // Handles the lock
-    //#ifdef GSTHREADSAFE
-    QReadLocker teamsLocker(_teamsLock);
+    ReadLocker rosterLocker(_rosterLock);
     // TODO: Fix fault at this point
-    //#endif
 
     // Runs the teams searching for the wanted name
-    QHashIterator<uint8,GEARSystemTeam> it(_teams);
-    while (it.hasNext()) {
-        it.next();
-        if (it.value().name() == name) {
-            return(it.value().number());
+    const QList<quint8> teamsList = _validGEARSystemTeams.toList();
+    for (int i = 0; i < teamsList.size(); i++) {
+        if (_teams[teamsList.at(i)]->name() == name) {
+            return(_teams[teamsList.at(i)]->number());
         }
     }
 
@@ -156,6 +918,284 @@ uint8 WorldMap::teamNumber(const QString& name) const {
 }
 
 
+/*** History length functions
+  ** Description: Handles the number of samples kept for each ball and player
+  ** Receives:    [length] The number of samples (0 disables the history)
+  ** Returns:     Nothing, or the number of samples
+  ***/
+void WorldMap::setHistoryLength(int length) {
+    WriteLocker historyLocker(_historyLock);
+    _historyLength = qMax(length, 0);
+
+    // Resizes the stored histories
+    QMutableHashIterator<uint8,TrajectoryHistory> ballsIt(_ballsHistory);
+    while (ballsIt.hasNext()) {
+        ballsIt.next().value().setCapacity(_historyLength);
+    }
+
+    QMutableHashIterator<quint16,TrajectoryHistory> playersIt(_playersHistory);
+    while (playersIt.hasNext()) {
+        playersIt.next().value().setCapacity(_historyLength);
+    }
+}
+
+int WorldMap::historyLength() const {
+    ReadLocker historyLocker(_historyLock);
+    return(_historyLength);
+}
+
+/*** Positions at a time functions
+  ** Description: Gets a ball or player pose at a given capture time, interpolating the stored samples
+  ** Receives:    [ballNum]   The ball number
+                  [teamNum]   The team number
+                  [playerNum] The player number
+                  [time]      The capture time, in seconds
+  ** Returns:     The position or orientation (the latest one after the last frame, invalid if the time is
+                  older than the history)
+  ***/
+const Position WorldMap::ballPositionAt(uint8 ballNum, double time) const {
+    ReadLocker historyLocker(_historyLock);
+    return(_ballsHistory.value(ballNum).sampleAt(time).position());
+}
+
+const Position WorldMap::playerPositionAt(uint8 teamNum, uint8 playerNum, double time) const {
+    ReadLocker historyLocker(_historyLock);
+    return(_playersHistory.value((quint16(teamNum) << 8) | playerNum).sampleAt(time).position());
+}
+
+const Angle WorldMap::playerOrientationAt(uint8 teamNum, uint8 playerNum, double time) const {
+    ReadLocker historyLocker(_historyLock);
+    return(_playersHistory.value((quint16(teamNum) << 8) | playerNum).sampleAt(time).orientation());
+}
+
+/*** Trajectory functions
+  ** Description: Gets the stored samples of a ball or player in a time interval
+  ** Receives:    [ballNum]   The ball number
+                  [teamNum]   The team number
+                  [playerNum] The player number
+                  [startTime] The interval start, in seconds
+                  [endTime]   The interval end, in seconds
+  ** Returns:     The samples, oldest first
+  ***/
+QList<TrajectorySample> WorldMap::ballTrajectory(uint8 ballNum, double startTime, double endTime) const {
+    ReadLocker historyLocker(_historyLock);
+    return(_ballsHistory.value(ballNum).samples(startTime, endTime));
+}
+
+QList<TrajectorySample> WorldMap::playerTrajectory(uint8 teamNum, uint8 playerNum, double startTime, double endTime) const {
+    ReadLocker historyLocker(_historyLock);
+    return(_playersHistory.value((quint16(teamNum) << 8) | playerNum).samples(startTime, endTime));
+}
+
+
+/*** 'setMotionModel' function
+  ** Description: Sets the model used to predict the balls and players
+  ** Receives:    [model] The model (the map takes its ownership, and NULL restores the default model)
+  ** Returns:     Nothing
+  ***/
+void WorldMap::setMotionModel(MotionModel* model) {
+    WriteLocker modelLocker(_motionModelLock);
+
+    // Replaces the model
+    delete _motionModel;
+    _motionModel = (model != NULL)? model : new MotionModel();
+}
+
+/*** Prediction functions
+  ** Description: Predicts a ball position or a player pose at a given capture time, from the last known
+                  state and the motion model
+  ** Receives:    [ballNum]   The ball number
+                  [teamNum]   The team number
+                  [playerNum] The player number
+                  [time]      The capture time, in seconds (on the frames clock)
+  ** Returns:     The predicted position, or the predicted pose along with the last known velocity
+  ***/
+const Position WorldMap::predictedBallPosition(uint8 ballNum, double time) const {
+    // Reads the last known state
+    Position position;
+    Velocity velocity;
+    double   lastCaptureTime;
+    if (_snapshotMode) {
+        const WorldSnapshotPtr frame = snapshot();
+        position        = frame->ballPosition(ballNum);
+        velocity        = frame->ballVelocity(ballNum);
+        lastCaptureTime = frame->captureTime();
+    }
+    else {
+        ReadLocker ballsLocker(_ballsLock);
+        if (!_validBalls.test(ballNum)) {
+            #ifdef GSDEBUGMSG
+            cerr << ">> GEARSystem: WorldMap::predictedBallPosition(uint8, double): No such Ball #";
+            cerr << int(ballNum) << " in this map!!" << endl << flush;
+            #endif
+            return(_invalidPosition);
+        }
+
+        position        = _ballsPositions[ballNum];
+        velocity        = _ballsVelocities[ballNum];
+        lastCaptureTime = _captureTime;
+    }
+
+    // Predicts the position
+    ReadLocker modelLocker(_motionModelLock);
+    return(_motionModel->predictBall(position, velocity, predictionInterval(position.captureTime(), lastCaptureTime, time)));
+}
+
+TrajectorySample WorldMap::predictedPlayerPose(uint8 teamNum, uint8 playerNum, double time) const {
+    // Reads the last known state
+    Position     position;
+    Angle        orientation;
+    Velocity     velocity;
+    AngularSpeed angularSpeed;
+    double       lastCaptureTime;
+    if (_snapshotMode) {
+        const WorldSnapshotPtr frame = snapshot();
+        position        = frame->playerPosition(teamNum, playerNum);
+        orientation     = frame->playerOrientation(teamNum, playerNum);
+        velocity        = frame->playerVelocity(teamNum, playerNum);
+        angularSpeed    = frame->playerAngularSpeed(teamNum, playerNum);
+        lastCaptureTime = frame->captureTime();
+    }
+    else {
+        ReadLocker rosterLocker(_rosterLock);
+        if (!_validGEARSystemTeams.test(teamNum)) {
+            #ifdef GSDEBUGMSG
+            cerr << ">> GEARSystem: WorldMap::predictedPlayerPose(uint8, uint8, double): No such GEARSystemTeam #";
+            cerr << int(teamNum) << " in this map!!" << endl << flush;
+            #endif
+            return(TrajectorySample());
+        }
+
+        ReadLocker teamLocker(_teamLocks[teamNum]);
+        const GEARSystemTeam& team = *(_teams[teamNum]);
+        position        = *(team.position(playerNum));
+        orientation     = *(team.orientation(playerNum));
+        velocity        = *(team.velocity(playerNum));
+        angularSpeed    = *(team.angularSpeed(playerNum));
+
+        ReadLocker ballsLocker(_ballsLock);
+        lastCaptureTime = _captureTime;
+    }
+
+    // Predicts the pose
+    ReadLocker modelLocker(_motionModelLock);
+    Position newPosition;
+    Angle    newOrientation;
+    _motionModel->predictPlayer(position, orientation, velocity, angularSpeed,
+                                predictionInterval(position.captureTime(), lastCaptureTime, time),
+                                &newPosition, &newOrientation);
+
+    // Returns the pose
+    return(TrajectorySample(time, newPosition, newOrientation, velocity));
+}
+
+
+/*** Spatial query functions
+  ** Description: Finds the players closest to a point, within a radius of a point, or within a radius of a
+                  segment (a pass lane)
+  ** Receives:    [point]  The queried point
+                  [k]      The maximum number of players
+                  [radius] The search radius
+                  [a]      The segment start
+                  [b]      The segment end
+                  [teams]  The teams searched (an empty bitmap searches all teams)
+  ** Returns:     The players and their distances to the point or segment, closest first
+  ***/
+QList<PlayerDistance> WorldMap::nearestPlayers(const Position& point, int k) const {
+    return(nearestPlayers(point, k, IdBitmap()));
+}
+
+QList<PlayerDistance> WorldMap::nearestPlayers(const Position& point, int k, const IdBitmap& teams) const {
+    QList<PlayerDistance> found;
+    if (k <= 0 || point.isUnknown() || !point.isValid()) {
+        return(found);
+    }
+
+    // Measures every indexed player
+    QMutexLocker indexLocker(_indexLock);
+    updateIndex();
+    _indexDistances.resize(_indexPlayers.size());
+    BatchGeometry::distances(_indexX.constData(), _indexY.constData(), _indexPlayers.size(), point.x(), point.y(), _indexDistances.data());
+
+    // Keeps the players of the searched teams
+    const bool allTeams = teams.isEmpty();
+    for (int i = 0; i < _indexPlayers.size(); i++) {
+        const quint8 teamNum = _indexPlayers.at(i) >> 8;
+        if (allTeams || teams.test(teamNum)) {
+            found.append(PlayerDistance(teamNum, _indexPlayers.at(i) & 0xFF, _indexDistances.at(i)));
+        }
+    }
+
+    // Keeps the k closest players
+    std::sort(found.begin(), found.end());
+    while (found.size() > k) {
+        found.removeLast();
+    }
+    return(found);
+}
+
+QList<PlayerDistance> WorldMap::playersWithinRadius(const Position& point, float radius) const {
+    return(playersWithinRadius(point, radius, IdBitmap()));
+}
+
+QList<PlayerDistance> WorldMap::playersWithinRadius(const Position& point, float radius, const IdBitmap& teams) const {
+    QList<PlayerDistance> found;
+    if (radius < 0.0f || point.isUnknown() || !point.isValid()) {
+        return(found);
+    }
+
+    // Measures every indexed player
+    QMutexLocker indexLocker(_indexLock);
+    updateIndex();
+    _indexDistances.resize(_indexPlayers.size());
+    BatchGeometry::distances(_indexX.constData(), _indexY.constData(), _indexPlayers.size(), point.x(), point.y(), _indexDistances.data());
+
+    // Keeps the players of the searched teams inside the circle
+    const bool allTeams = teams.isEmpty();
+    for (int i = 0; i < _indexPlayers.size(); i++) {
+        const quint8 teamNum = _indexPlayers.at(i) >> 8;
+        if (_indexDistances.at(i) <= radius && (allTeams || teams.test(teamNum))) {
+            found.append(PlayerDistance(teamNum, _indexPlayers.at(i) & 0xFF, _indexDistances.at(i)));
+        }
+    }
+
+    // Returns the closest players first
+    std::sort(found.begin(), found.end());
+    return(found);
+}
+
+QList<PlayerDistance> WorldMap::segmentClearance(const Position& a, const Position& b, float radius) const {
+    return(segmentClearance(a, b, radius, IdBitmap()));
+}
+
+QList<PlayerDistance> WorldMap::segmentClearance(const Position& a, const Position& b, float radius, const IdBitmap& teams) const {
+    QList<PlayerDistance> found;
+    if (radius < 0.0f || a.isUnknown() || !a.isValid() || b.isUnknown() || !b.isValid()) {
+        return(found);
+    }
+
+    // Measures every indexed player
+    QMutexLocker indexLocker(_indexLock);
+    updateIndex();
+    _indexDistances.resize(_indexPlayers.size());
+    BatchGeometry::segmentDistances(_indexX.constData(), _indexY.constData(), _indexPlayers.size(),
+                                    a.x(), a.y(), b.x(), b.y(), _indexDistances.data());
+
+    // Keeps the players of the searched teams close to the segment
+    const bool allTeams = teams.isEmpty();
+    for (int i = 0; i < _indexPlayers.size(); i++) {
+        const quint8 teamNum = _indexPlayers.at(i) >> 8;
+        if (_indexDistances.at(i) <= radius && (allTeams || teams.test(teamNum))) {
+            found.append(PlayerDistance(teamNum, _indexPlayers.at(i) & 0xFF, _indexDistances.at(i)));
+        }
+    }
+
+    // Returns the closest players first
+    std::sort(found.begin(), found.end());
+    return(found);
+}
+
+
 /*** Balls handling functions
   ** Description: Handles the balls
   ** Receives:    [ballNum] The ball number
@@ -163,46 +1203,56 @@ uint8 WorldMap::teamNumber(const QString& name) const {
   ***/
 void WorldMap::addBall(uint8 ballNum) {
     // Handles the lock
-    //#ifdef GSTHREADSAFE
-    QWriteLocker ballsLocker(_ballsLock);
+    WriteLocker ballsLocker(_ballsLock);
     // TODO: Fix fault at this point
-    //#endif
 
-    // Adds the ball
-    (void) _validBalls.insert(ballNum, true);
-    (void) _ballsPositions.insert(ballNum, new Position(false,0,0,0));
-    (void) _ballsVelocities.insert(ballNum, new Velocity(false,0,0));
+    // Adds the ball (re-adding resets its state)
+    if (!_validBalls.test(ballNum)) {
+        (void) _validBalls.set(ballNum);
+        _nBalls++;
+        (void) _rosterVersion.fetchAndAddOrdered(1);
+    }
+    _ballsPositions[ballNum]  = Position(false,0,0,0);
+    _ballsVelocities[ballNum] = Velocity(false,0,0);
+
+    // Publishes the change
+    ballsLocker.unlock();
+    updated();
 }
 
 void WorldMap::delBall(uint8 ballNum) {
     // Handles the lock
-    //#ifdef GSTHREADSAFE
-    QWriteLocker ballsLocker(_ballsLock);
+    WriteLocker ballsLocker(_ballsLock);
     // TODO: Fix fault at this point
-    //#endif
 
     // Deletes the ball
-    (void) _validBalls.remove(ballNum);
-    (void) _ballsPositions.remove(ballNum);
-    (void) _ballsVelocities.remove(ballNum);
+    if (_validBalls.clear(ballNum)) {
+        _nBalls--;
+        (void) _rosterVersion.fetchAndAddOrdered(1);
+    }
+
+    // Drops its history
+    _historyLock.lockForWrite();
+    (void) _ballsHistory.remove(ballNum);
+    _historyLock.unlock();
+
+    // Publishes the change
+    ballsLocker.unlock();
+    updated();
 }
 
 QList<uint8> WorldMap::balls() const {
+    // Reads the published snapshot
+    if (_snapshotMode) {
+        return(snapshot()->balls());
+    }
+
     // Handles the lock
-    //#ifdef GSTHREADSAFE
-    QReadLocker ballsLocker(_ballsLock);
+    ReadLocker ballsLocker(_ballsLock);
     // TODO: Fix fault at this point
-    //#endif
-
-    // Adds the balls to the list
-    QList<uint8> ballsList;
-    QHashIterator<uint8,Position*> it(_ballsPositions);
-    while (it.hasNext()) {
-        ballsList.append(it.next().key());
-    }
 
     // Returns the list
-    return(ballsList);
+    return(_validBalls.toList());
 }
 
 
@@ -212,15 +1262,18 @@ QList<uint8> WorldMap::balls() const {
   ** Returns:     The ball position
   ***/
 const Position WorldMap::ballPosition(uint8 ballNum) const {
+    // Reads the published snapshot
+    if (_snapshotMode) {
+        return(snapshot()->ballPosition(ballNum));
+    }
+
     // Handles the lock
-    //#ifdef GSTHREADSAFE
-    QReadLocker ballsLocker(_ballsLock);
+    ReadLocker ballsLocker(_ballsLock);
     // TODO: Fix fault at this point
-    //#endif
 
     // Returns the ball position
-    if (_validBalls.value(ballNum)) {
-        return(*(_ballsPositions[ballNum]));
+    if (_validBalls.test(ballNum)) {
+        return(_ballsPositions[ballNum]);
     }
     else {
         #ifdef GSDEBUGMSG
@@ -239,15 +1292,18 @@ const Position WorldMap::ballPosition(uint8 ballNum) const {
   ** Returns:     The ball velocity
   ***/
 const Velocity WorldMap::ballVelocity(uint8 ballNum) const {
+    // Reads the published snapshot
+    if (_snapshotMode) {
+        return(snapshot()->ballVelocity(ballNum));
+    }
+
     // Handles the lock
-    //#ifdef GSTHREADSAFE
-    QReadLocker ballsLocker(_ballsLock);
+    ReadLocker ballsLocker(_ballsLock);
     // TODO: Fix fault at this point
-    //#endif
 
     // Returns the ball velocity
-    if (_validBalls.value(ballNum)) {
-        return(*(_ballsVelocities[ballNum]));
+    if (_validBalls.test(ballNum)) {
+        return(_ballsVelocities[ballNum]);
     }
     else {
         #ifdef GSDEBUGMSG
@@ -267,22 +1323,8 @@ const Velocity WorldMap::ballVelocity(uint8 ballNum) const {
   ** Returns:     Nothing
   ***/
 void WorldMap::setBallPosition(uint8 ballNum, const Position& position) {
-    // Handles the lock
-    //#ifdef GSTHREADSAFE
-    QWriteLocker ballsLocker(_ballsLock);
-    // TODO: Fix fault at this point
-    //#endif
-
-    // Sets the ball position
-    if (_validBalls.value(ballNum)) {
-        (void) _ballsPositions.value(ballNum)->operator =(position);
-    }
-    else {
-        #ifdef GSDEBUGMSG
-        cerr << ">> GEARSystem: WorldMap::setBallPosition(uint8, const Position&): No such Ball #";
-        cerr << int(ballNum) << " in this map!!" << endl << flush;
-        #endif
-    }
+    // Applies the change
+    update(WorldUpdate(ballNum, position));
 }
 
 /*** 'setBallVelocity' function
@@ -292,22 +1334,8 @@ void WorldMap::setBallPosition(uint8 ballNum, const Position& position) {
   ** Returns:     Nothing
   ***/
 void WorldMap::setBallVelocity(uint8 ballNum, const Velocity& velocity) {
-    // Handles the lock
-    //#ifdef GSTHREADSAFE
-    QWriteLocker ballsLocker(_ballsLock);
-    // TODO: Fix fault at this point
-    //#endif
-
-    // Sets the ball velocity
-    if (_validBalls.value(ballNum)) {
-        (void) _ballsVelocities.value(ballNum)->operator =(velocity);
-    }
-    else {
-        #ifdef GSDEBUGMSG
-        cerr << ">> GEARSystem: WorldMap::setBallVelocity(uint8, const Velocity&): No such Ball #";
-        cerr << int(ballNum) << " in this map!!" << endl << flush;
-        #endif
-    }
+    // Applies the change
+    update(WorldUpdate(ballNum, velocity));
 }
 
 
@@ -319,14 +1347,14 @@ void WorldMap::setBallVelocity(uint8 ballNum, const Velocity& velocity) {
   ***/
 void WorldMap::addPlayer(uint8 teamNum, uint8 playerNum) {
     // Handles the lock
-    //#ifdef GSTHREADSAFE
-    QWriteLocker teamsLocker(_teamsLock);
+    WriteLocker rosterLocker(_rosterLock);
     // TODO: Fix fault at this point
-    //#endif
 
     // Adds the player
-    if (_validGEARSystemTeams.value(teamNum)) {
-        _teams[teamNum].addPlayer(playerNum);
+    if (_validGEARSystemTeams.test(teamNum)) {
+        if (_teams[teamNum]->addPlayer(playerNum)) {
+            (void) _rosterVersion.fetchAndAddOrdered(1);
+        }
     }
     else {
         #ifdef GSDEBUGMSG
@@ -334,18 +1362,27 @@ void WorldMap::addPlayer(uint8 teamNum, uint8 playerNum) {
         cerr << int(teamNum) << " in this map!!" << endl << flush;
         #endif
     }
+
+    // Publishes the change
+    rosterLocker.unlock();
+    updated();
 }
 
 void WorldMap::delPlayer(uint8 teamNum, uint8 playerNum) {
     // Handles the lock
-    //#ifdef GSTHREADSAFE
-    QWriteLocker teamsLocker(_teamsLock);
+    WriteLocker rosterLocker(_rosterLock);
     // TODO: Fix fault at this point
-    //#endif
 
     // Deletes the player
-    if (_validGEARSystemTeams.value(teamNum)) {
-        _teams[teamNum].delPlayer(playerNum);
+    if (_validGEARSystemTeams.test(teamNum)) {
+        if (_teams[teamNum]->delPlayer(playerNum)) {
+            (void) _rosterVersion.fetchAndAddOrdered(1);
+        }
+
+        // Drops its history
+        _historyLock.lockForWrite();
+        (void) _playersHistory.remove((quint16(teamNum) << 8) | playerNum);
+        _historyLock.unlock();
     }
     else {
         #ifdef GSDEBUGMSG
@@ -353,18 +1390,25 @@ void WorldMap::delPlayer(uint8 teamNum, uint8 playerNum) {
         cerr << int(teamNum) << " in this map!!" << endl << flush;
         #endif
     }
+
+    // Publishes the change
+    rosterLocker.unlock();
+    updated();
 }
 
 QList<uint8> WorldMap::players(uint8 teamNum) const {
+    // Reads the published snapshot
+    if (_snapshotMode) {
+        return(snapshot()->players(teamNum));
+    }
+
     // Handles the lock
-    //#ifdef GSTHREADSAFE
-    QReadLocker teamsLocker(_teamsLock);
+    ReadLocker rosterLocker(_rosterLock);
     // TODO: Fix fault at this point
-    //#endif
 
     // Returns the players list
-    if (_validGEARSystemTeams.value(teamNum)) {
-        return(_teams[teamNum].players());
+    if (_validGEARSystemTeams.test(teamNum)) {
+        return(_teams[teamNum]->players());
     }
     else {
         #ifdef GSDEBUGMSG
@@ -384,15 +1428,19 @@ QList<uint8> WorldMap::players(uint8 teamNum) const {
                   [playerNum] The player number
   ** Returns:     The player position, orientation, velocity, angular speed, capacitor or battery charges, kick or dribble status
   ***/
-const Position& WorldMap::playerPosition(uint8 teamNum, uint8 playerNum) const {
+const Position WorldMap::playerPosition(uint8 teamNum, uint8 playerNum) const {
+    // Reads the published snapshot
+    if (_snapshotMode) {
+        return(snapshot()->playerPosition(teamNum, playerNum));
+    }
+
     // Handles the lock
-    //#ifdef GSTHREADSAFE
-    QReadLocker teamsLocker(_teamsLock);
+    ReadLocker rosterLocker(_rosterLock);
+    ReadLocker teamLocker(_teamLocks[teamNum]);
     // TODO: Fix fault at this point
-    //#endif
 
     // Returns an invalid position
-    if (!_validGEARSystemTeams.value(teamNum)) {
+    if (!_validGEARSystemTeams.test(teamNum)) {
         #ifdef GSDEBUGMSG
         cerr << ">> GEARSystem: WorldMap::playerPosition(uint8, uint8): No such GEARSystemTeam #";
         cerr << int(teamNum) << " in this map!!" << endl << flush;
@@ -401,18 +1449,22 @@ const Position& WorldMap::playerPosition(uint8 teamNum, uint8 playerNum) const {
     }
 
     // Returns the player position
-    return(*(_teams[teamNum].position(playerNum)));
+    return(*(_teams[teamNum]->position(playerNum)));
 }
 
-const Angle& WorldMap::playerOrientation(uint8 teamNum, uint8 playerNum) const {
+const Angle WorldMap::playerOrientation(uint8 teamNum, uint8 playerNum) const {
+    // Reads the published snapshot
+    if (_snapshotMode) {
+        return(snapshot()->playerOrientation(teamNum, playerNum));
+    }
+
     // Handles the lock
-    //#ifdef GSTHREADSAFE
-    QReadLocker teamsLocker(_teamsLock);
+    ReadLocker rosterLocker(_rosterLock);
+    ReadLocker teamLocker(_teamLocks[teamNum]);
     // TODO: Fix fault at this point
-    //#endif
 
     // Returns an invalid orientation
-    if (!_validGEARSystemTeams.value(teamNum)) {
+    if (!_validGEARSystemTeams.test(teamNum)) {
         #ifdef GSDEBUGMSG
         cerr << ">> GEARSystem: WorldMap::playerOrientation(uint8, uint8): No such GEARSystemTeam #";
         cerr << int(teamNum) << " in this map!!" << endl << flush;
@@ -421,18 +1473,22 @@ const Angle& WorldMap::playerOrientation(uint8 teamNum, uint8 playerNum) const {
     }
 
     // Returns the player orientation
-    return(*(_teams[teamNum].orientation(playerNum)));
+    return(*(_teams[teamNum]->orientation(playerNum)));
 }
 
-const Velocity& WorldMap::playerVelocity(uint8 teamNum, uint8 playerNum) const {
+const Velocity WorldMap::playerVelocity(uint8 teamNum, uint8 playerNum) const {
+    // Reads the published snapshot
+    if (_snapshotMode) {
+        return(snapshot()->playerVelocity(teamNum, playerNum));
+    }
+
     // Handles the lock
-    //#ifdef GSTHREADSAFE
-    QReadLocker teamsLocker(_teamsLock);
+    ReadLocker rosterLocker(_rosterLock);
+    ReadLocker teamLocker(_teamLocks[teamNum]);
     // TODO: Fix fault at this point
-    //#endif
 
     // Returns an invalid velocity
-    if (!_validGEARSystemTeams.value(teamNum)) {
+    if (!_validGEARSystemTeams.test(teamNum)) {
         #ifdef GSDEBUGMSG
         cerr << ">> GEARSystem: WorldMap::playerVelocity(uint8, uint8): No such GEARSystemTeam #";
         cerr << int(teamNum) << " in this map!!" << endl << flush;
@@ -441,18 +1497,22 @@ const Velocity& WorldMap::playerVelocity(uint8 teamNum, uint8 playerNum) const {
     }
 
     // Returns the player velocity
-    return(*(_teams[teamNum].velocity(playerNum)));
+    return(*(_teams[teamNum]->velocity(playerNum)));
 }
 
-const AngularSpeed& WorldMap::playerAngularSpeed(uint8 teamNum, uint8 playerNum) const {
+const AngularSpeed WorldMap::playerAngularSpeed(uint8 teamNum, uint8 playerNum) const {
+    // Reads the published snapshot
+    if (_snapshotMode) {
+        return(snapshot()->playerAngularSpeed(teamNum, playerNum));
+    }
+
     // Handles the lock
-    //#ifdef GSTHREADSAFE
-    QReadLocker teamsLocker(_teamsLock);
+    ReadLocker rosterLocker(_rosterLock);
+    ReadLocker teamLocker(_teamLocks[teamNum]);
     // TODO: Fix fault at this point
-    //#endif
 
     // Returns an invalid speed
-    if (!_validGEARSystemTeams.value(teamNum)) {
+    if (!_validGEARSystemTeams.test(teamNum)) {
         #ifdef GSDEBUGMSG
         cerr << ">> GEARSystem: WorldMap::playerAngularSpeed(uint8, uint8): No such GEARSystemTeam #";
         cerr << int(teamNum) << " in this map!!" << endl << flush;
@@ -461,18 +1521,22 @@ const AngularSpeed& WorldMap::playerAngularSpeed(uint8 teamNum, uint8 playerNum)
     }
 
     // Returns the player angular speed
-    return(*(_teams[teamNum].angularSpeed(playerNum)));
+    return(*(_teams[teamNum]->angularSpeed(playerNum)));
 }
 
 bool WorldMap::ballPossession(uint8 teamNum, uint8 playerNum) const {
+    // Reads the published snapshot
+    if (_snapshotMode) {
+        return(snapshot()->ballPossession(teamNum, playerNum));
+    }
+
     // Handles the lock
-    //#ifdef GSTHREADSAFE
-    QReadLocker teamsLocker(_teamsLock);
+    ReadLocker rosterLocker(_rosterLock);
+    ReadLocker teamLocker(_teamLocks[teamNum]);
     // TODO: Fix fault at this point
-    //#endif
 
     // Returns the flag
-    if (!_validGEARSystemTeams.value(teamNum)) {
+    if (!_validGEARSystemTeams.test(teamNum)) {
         #ifdef GSDEBUGMSG
         cerr << ">> GEARSystem: WorldMap::ballPossession(uint8, uint8): No such GEARSystemTeam #";
         cerr << int(teamNum) << " in this map!!" << endl << flush;
@@ -481,18 +1545,22 @@ bool WorldMap::ballPossession(uint8 teamNum, uint8 playerNum) const {
     }
 
     // Returns the flag
-    return(_teams[teamNum].ballPossession(playerNum));
+    return(_teams[teamNum]->ballPossession(playerNum));
 }
 
 bool WorldMap::kickEnabled(quint8 teamNum, quint8 playerNum) const {
+    // Reads the published snapshot
+    if (_snapshotMode) {
+        return(snapshot()->kickEnabled(teamNum, playerNum));
+    }
+
     // Handles the lock
-    //#ifdef GSTHREADSAFE
-    QReadLocker teamsLocker(_teamsLock);
+    ReadLocker rosterLocker(_rosterLock);
+    ReadLocker teamLocker(_teamLocks[teamNum]);
     // TODO: Fix fault at this point
-    //#endif
 
     // Returns the flag
-    if (!_validGEARSystemTeams.value(teamNum)) {
+    if (!_validGEARSystemTeams.test(teamNum)) {
         #ifdef GSDEBUGMSG
         cerr << ">> GEARSystem: WorldMap::kickEnabled(uint8, uint8): No such GEARSystemTeam #";
         cerr << int(teamNum) << " in this map!!" << endl << flush;
@@ -501,18 +1569,22 @@ bool WorldMap::kickEnabled(quint8 teamNum, quint8 playerNum) const {
     }
 
     // Returns the flag
-    return(_teams[teamNum].kickEnabled(playerNum));
+    return(_teams[teamNum]->kickEnabled(playerNum));
 }
 
 bool WorldMap::dribbleEnabled(quint8 teamNum, quint8 playerNum) const {
+    // Reads the published snapshot
+    if (_snapshotMode) {
+        return(snapshot()->dribbleEnabled(teamNum, playerNum));
+    }
+
     // Handles the lock
-    //#ifdef GSTHREADSAFE
-    QReadLocker teamsLocker(_teamsLock);
+    ReadLocker rosterLocker(_rosterLock);
+    ReadLocker teamLocker(_teamLocks[teamNum]);
     // TODO: Fix fault at this point
-    //#endif
 
     // Returns the flag
-    if (!_validGEARSystemTeams.value(teamNum)) {
+    if (!_validGEARSystemTeams.test(teamNum)) {
         #ifdef GSDEBUGMSG
         cerr << ">> GEARSystem: WorldMap::dribbleEnabled(uint8, uint8): No such GEARSystemTeam #";
         cerr << int(teamNum) << " in this map!!" << endl << flush;
@@ -521,18 +1593,22 @@ bool WorldMap::dribbleEnabled(quint8 teamNum, quint8 playerNum) const {
     }
 
     // Returns the flag
-    return(_teams[teamNum].dribbleEnabled(playerNum));
+    return(_teams[teamNum]->dribbleEnabled(playerNum));
 }
 
 unsigned char WorldMap::batteryCharge(quint8 teamNum, quint8 playerNum) const {
+    // Reads the published snapshot
+    if (_snapshotMode) {
+        return(snapshot()->batteryCharge(teamNum, playerNum));
+    }
+
     // Handles the lock
-    //#ifdef GSTHREADSAFE
-    QReadLocker teamsLocker(_teamsLock);
+    ReadLocker rosterLocker(_rosterLock);
+    ReadLocker teamLocker(_teamLocks[teamNum]);
     // TODO: Fix fault at this point
-    //#endif
 
     // Returns the flag
-    if (!_validGEARSystemTeams.value(teamNum)) {
+    if (!_validGEARSystemTeams.test(teamNum)) {
         #ifdef GSDEBUGMSG
         cerr << ">> GEARSystem: WorldMap::batteryCharge(uint8, uint8): No such GEARSystemTeam #";
         cerr << int(teamNum) << " in this map!!" << endl << flush;
@@ -541,18 +1617,22 @@ unsigned char WorldMap::batteryCharge(quint8 teamNum, quint8 playerNum) const {
     }
 
     // Returns the flag
-    return(_teams[teamNum].batteryCharge(playerNum));
+    return(_teams[teamNum]->batteryCharge(playerNum));
 }
 
 unsigned char WorldMap::capacitorCharge(quint8 teamNum, quint8 playerNum) const {
+    // Reads the published snapshot
+    if (_snapshotMode) {
+        return(snapshot()->capacitorCharge(teamNum, playerNum));
+    }
+
     // Handles the lock
-    //#ifdef GSTHREADSAFE
-    QReadLocker teamsLocker(_teamsLock);
+    ReadLocker rosterLocker(_rosterLock);
+    ReadLocker teamLocker(_teamLocks[teamNum]);
     // TODO: Fix fault at this point
-    //#endif
 
     // Returns the flag
-    if (!_validGEARSystemTeams.value(teamNum)) {
+    if (!_validGEARSystemTeams.test(teamNum)) {
         #ifdef GSDEBUGMSG
         cerr << ">> GEARSystem: WorldMap::capacitorCharge(uint8, uint8): No such GEARSystemTeam #";
         cerr << int(teamNum) << " in this map!!" << endl << flush;
@@ -561,33 +1641,48 @@ unsigned char WorldMap::capacitorCharge(quint8 teamNum, quint8 playerNum) const
     }
 
     // Returns the flag
-    return(_teams[teamNum].capacitorCharge(playerNum));
+    return(_teams[teamNum]->capacitorCharge(playerNum));
 }
 
-/*** 'setPlayerPosition' function
-  ** Description: Sets the player position
+/*** 'playerState' function
+  ** Description: Gets the whole player state at once
   ** Receives:    [teamNum]   The team number
                   [playerNum] The player number
-                  [position]  The player position
-  ** Returns:     Nothing
+  ** Returns:     The player state, invalid if there is no such team or player
   ***/
-void WorldMap::setPlayerPosition(uint8 teamNum, uint8 playerNum, const Position& position) {
+PlayerState WorldMap::playerState(uint8 teamNum, uint8 playerNum) const {
+    // Reads the published snapshot
+    if (_snapshotMode) {
+        return(snapshot()->playerState(teamNum, playerNum));
+    }
+
     // Handles the lock
-    //#ifdef GSTHREADSAFE
-    QWriteLocker teamsLocker(_teamsLock);
-    // TODO: Fix fault at this point
-    //#endif
+    ReadLocker rosterLocker(_rosterLock);
+    ReadLocker teamLocker(_teamLocks[teamNum]);
 
-    // Sets the player position
-    if (_validGEARSystemTeams.value(teamNum)) {
-        _teams[teamNum].setPosition(playerNum, position);
-    }
-    else {
+    // Returns an invalid state
+    if (!_validGEARSystemTeams.test(teamNum)) {
         #ifdef GSDEBUGMSG
-        cerr << ">> GEARSystem: WorldMap::setPlayerPosition(uint8, uint8, const Position&): No such GEARSystemTeam #";
+        cerr << ">> GEARSystem: WorldMap::playerState(uint8, uint8): No such GEARSystemTeam #";
         cerr << int(teamNum) << " in this map!!" << endl << flush;
         #endif
+        return(PlayerState(teamNum, playerNum));
     }
+
+    // Returns the state
+    return(_teams[teamNum]->playerState(playerNum));
+}
+
+/*** 'setPlayerPosition' function
+  ** Description: Sets the player position
+  ** Receives:    [teamNum]   The team number
+                  [playerNum] The player number
+                  [position]  The player position
+  ** Returns:     Nothing
+  ***/
+void WorldMap::setPlayerPosition(uint8 teamNum, uint8 playerNum, const Position& position) {
+    // Applies the change
+    update(WorldUpdate(teamNum, playerNum, position));
 }
 
 /*** 'setPlayerOrientation' function
@@ -598,22 +1693,8 @@ void WorldMap::setPlayerPosition(uint8 teamNum, uint8 playerNum, const Position&
   ** Returns:     Nothing
   ***/
 void WorldMap::setPlayerOrientation(uint8 teamNum, uint8 playerNum, const Angle& orientation) {
-    // Handles the lock
-    //#ifdef GSTHREADSAFE
-    QWriteLocker teamsLocker(_teamsLock);
-    // TODO: Fix fault at this point
-    //#endif
-
-    // Sets the player orientation
-    if (_validGEARSystemTeams.value(teamNum)) {
-        _teams[teamNum].setOrientation(playerNum, orientation);
-    }
-    else {
-        #ifdef GSDEBUGMSG
-        cerr << ">> GEARSystem: WorldMap::setPlayerOrientation(uint8, uint8, const Orientation&): No such GEARSystemTeam #";
-        cerr << int(teamNum) << " in this map!!" << endl << flush;
-        #endif
-    }
+    // Applies the change
+    update(WorldUpdate(teamNum, playerNum, orientation));
 }
 
 /*** 'setPlayerVelocity' function
@@ -624,22 +1705,8 @@ void WorldMap::setPlayerOrientation(uint8 teamNum, uint8 playerNum, const Angle&
   ** Returns:     Nothing
   ***/
 void WorldMap::setPlayerVelocity(uint8 teamNum, uint8 playerNum, const Velocity& velocity) {
-    // Handles the lock
-    //#ifdef GSTHREADSAFE
-    QWriteLocker teamsLocker(_teamsLock);
-    // TODO: Fix fault at this point
-    //#endif
-
-    // Sets the player velocity
-    if (_validGEARSystemTeams.value(teamNum)) {
-        _teams[teamNum].setVelocity(playerNum, velocity);
-    }
-    else {
-        #ifdef GSDEBUGMSG
-        cerr << ">> GEARSystem: WorldMap::setPlayerVelocity(uint8, uint8, const Velocity&): No such GEARSystemTeam #";
-        cerr << int(teamNum) << " in this map!!" << endl << flush;
-        #endif
-    }
+    // Applies the change
+    update(WorldUpdate(teamNum, playerNum, velocity));
 }
 
 
@@ -651,22 +1718,8 @@ void WorldMap::setPlayerVelocity(uint8 teamNum, uint8 playerNum, const Velocity&
   ** Returns:     Nothing
   ***/
 void WorldMap::setPlayerAngularSpeed(uint8 teamNum, uint8 playerNum, const AngularSpeed& angularSpeed) {
-    // Handles the lock
-    //#ifdef GSTHREADSAFE
-    QWriteLocker teamsLocker(_teamsLock);
-    // TODO: Fix fault at this point
-    //#endif
-
-    // Sets the player angular speed
-    if (_validGEARSystemTeams.value(teamNum)) {
-        _teams[teamNum].setAngularSpeed(playerNum, angularSpeed);
-    }
-    else {
-        #ifdef GSDEBUGMSG
-        cerr << ">> GEARSystem: WorldMap::setPlayerAngularSpeed(uint8, uint8, const AngularSpeed&): No such GEARSystemTeam #";
-        cerr << int(teamNum) << " in this map!!" << endl << flush;
-        #endif
-    }
+    // Applies the change
+    update(WorldUpdate(teamNum, playerNum, angularSpeed));
 }
 
 
@@ -678,22 +1731,8 @@ void WorldMap::setPlayerAngularSpeed(uint8 teamNum, uint8 playerNum, const Angul
   ** Returns:     Nothing
   ***/
 void WorldMap::setBallPossession(uint8 teamNum, uint8 playerNum, bool possession) {
-    // Handles the lock
-    //#ifdef GSTHREADSAFE
-    QWriteLocker teamsLocker(_teamsLock);
-    // TODO: Fix fault at this point
-    //#endif
-
-    // Sets the flag
-    if (_validGEARSystemTeams.value(teamNum)) {
-        _teams[teamNum].setBallPossession(playerNum, possession);
-    }
-    else {
-        #ifdef GSDEBUGMSG
-        cerr << ">> GEARSystem: WorldMap::setBallPossession(uint8, uint8, bool): No such GEARSystemTeam #";
-        cerr << int(teamNum) << " in this map!!" << endl << flush;
-        #endif
-    }
+    // Applies the change
+    update(WorldUpdate(WorldUpdate::BallPossession, teamNum, playerNum, possession));
 }
 
 /*** 'setKickEnabled' function
@@ -703,23 +1742,9 @@ void WorldMap::setBallPossession(uint8 teamNum, uint8 playerNum, bool possession
                   [status] 'true' if the player enabled the kick device, 'false' otherwise
   ** Returns:     Nothing
   ***/
-void WorldMap::setKickEnabled(uint8 teamNum, uint8 playerNum, bool status){
-    // Handles the lock
-    //#ifdef GSTHREADSAFE
-    QWriteLocker teamsLocker(_teamsLock);
-    // TODO: Fix fault at this point
-    //#endif
-
-    // Sets the flag
-    if (_validGEARSystemTeams.value(teamNum)) {
-        _teams[teamNum].setPlayerKickStatus(playerNum, status);
-    }
-    else {
-        #ifdef GSDEBUGMSG
-        cerr << ">> GEARSystem: WorldMap::setKickEnabled(uint8, uint8, bool): No such GEARSystemTeam #";
-        cerr << int(teamNum) << " in this map!!" << endl << flush;
-        #endif
-    }
+void WorldMap::setKickEnabled(uint8 teamNum, uint8 playerNum, bool status) {
+    // Applies the change
+    update(WorldUpdate(WorldUpdate::KickEnabled, teamNum, playerNum, status));
 }
 
 /*** 'setDribbleEnabled' function
@@ -729,23 +1754,9 @@ void WorldMap::setKickEnabled(uint8 teamNum, uint8 playerNum, bool status){
                   [possession] 'true' if the player enabled the dribble device, 'false' otherwise
   ** Returns:     Nothing
   ***/
-void WorldMap::setDribbleEnabled(uint8 teamNum, uint8 playerNum, bool status){
-    // Handles the lock
-    //#ifdef GSTHREADSAFE
-    QWriteLocker teamsLocker(_teamsLock);
-    // TODO: Fix fault at this point
-    //#endif
-
-    // Sets the flag
-    if (_validGEARSystemTeams.value(teamNum)) {
-        _teams[teamNum].setPlayerDribbleStatus(playerNum, status);
-    }
-    else {
-        #ifdef GSDEBUGMSG
-        cerr << ">> GEARSystem: WorldMap::setDribbleEnabled(uint8, uint8, bool): No such GEARSystemTeam #";
-        cerr << int(teamNum) << " in this map!!" << endl << flush;
-        #endif
-    }
+void WorldMap::setDribbleEnabled(uint8 teamNum, uint8 playerNum, bool status) {
+    // Applies the change
+    update(WorldUpdate(WorldUpdate::DribbleEnabled, teamNum, playerNum, status));
 }
 
 
@@ -756,23 +1767,9 @@ void WorldMap::setDribbleEnabled(uint8 teamNum, uint8 playerNum, bool status){
                   [charge]     The charge value
   ** Returns:     Nothing
   ***/
-void WorldMap::setBatteryCharge(uint8 teamNum, uint8 playerNum, unsigned char charge){
-    // Handles the lock
-    //#ifdef GSTHREADSAFE
-    QWriteLocker teamsLocker(_teamsLock);
-    // TODO: Fix fault at this point
-    //#endif
-
-    // Sets the flag
-    if (_validGEARSystemTeams.value(teamNum)) {
-        _teams[teamNum].setPlayerBatteryCharge(playerNum, charge);
-    }
-    else {
-        #ifdef GSDEBUGMSG
-        cerr << ">> GEARSystem: WorldMap::setBatteryCharge(uint8, uint8, char): No such GEARSystemTeam #";
-        cerr << int(teamNum) << " in this map!!" << endl << flush;
-        #endif
-    }
+void WorldMap::setBatteryCharge(uint8 teamNum, uint8 playerNum, unsigned char charge) {
+    // Applies the change
+    update(WorldUpdate(WorldUpdate::BatteryCharge, teamNum, playerNum, charge));
 }
 
 
@@ -783,54 +1780,44 @@ void WorldMap::setBatteryCharge(uint8 teamNum, uint8 playerNum, unsigned char ch
                   [charge]     The charge value
   ** Returns:     Nothing
   ***/
-void WorldMap::setCapacitorCharge(uint8 teamNum, uint8 playerNum, unsigned char charge){
-    // Handles the lock
-    //#ifdef GSTHREADSAFE
-    QWriteLocker teamsLocker(_teamsLock);
-    // TODO: Fix fault at this point
-    //#endif
-
-    // Sets the flag
-    if (_validGEARSystemTeams.value(teamNum)) {
-        _teams[teamNum].setPlayerCapacitorCharge(playerNum, charge);
-    }
-    else {
-        #ifdef GSDEBUGMSG
-        cerr << ">> GEARSystem: WorldMap::setBallPossession(uint8, uint8, char): No such GEARSystemTeam #";
-        cerr << int(teamNum) << " in this map!!" << endl << flush;
-        #endif
-    }
+void WorldMap::setCapacitorCharge(uint8 teamNum, uint8 playerNum, unsigned char charge) {
+    // Applies the change
+    update(WorldUpdate(WorldUpdate::CapacitorCharge, teamNum, playerNum, charge));
 }
 
 
 /*** Field handling functions
   ** Description: Handles field info
   ***/
-void WorldMap::setFieldTopRightCorner(const Position& position)    { _field.setTopRightCorner(position);  }
-void WorldMap::setFieldTopLeftCorner(const Position& position)     { _field.setTopLeftCorner(position);   }
-void WorldMap::setFieldBottomLeftCorner(const Position& position)  { _field.setBottomLeftCorner(position);  }
-void WorldMap::setFieldBottomRightCorner(const Position& position) { _field.setBottomRightCorner(position); }
-void WorldMap::setFieldCenter(const Position& position)            { _field.setCenter(position); }
+void WorldMap::setFieldTopRightCorner(const Position& position)    { _field.setTopRightCorner(position); geometryUpdated(); }
+void WorldMap::setFieldTopLeftCorner(const Position& position)     { _field.setTopLeftCorner(position); geometryUpdated(); }
+void WorldMap::setFieldBottomLeftCorner(const Position& position)  { _field.setBottomLeftCorner(position); geometryUpdated(); }
+void WorldMap::setFieldBottomRightCorner(const Position& position) { _field.setBottomRightCorner(position); geometryUpdated(); }
+void WorldMap::setFieldCenter(const Position& position)            { _field.setCenter(position); geometryUpdated(); }
 
 void WorldMap::setLeftGoalPosts(const Position& leftPost, const Position& rightPost) {
     _field.setLeftGoalPosts(leftPost, rightPost);
+    geometryUpdated();
 }
 void WorldMap::setRightGoalPosts(const Position& leftPost, const Position& rightPost) {
     _field.setRightGoalPosts(leftPost, rightPost);
+    geometryUpdated();
 }
 
 void WorldMap::setGoalArea(float length, float width, float roundedRadius) {
     _field.setGoalArea(length, width, roundedRadius);
+    geometryUpdated();
 }
 
 void WorldMap::setGoalDepth(float depth) {
     _field.setGoalDepth(depth);
+    geometryUpdated();
 }
 
-void WorldMap::setLeftPenaltyMark(const Position& position)  { _field.setLeftPenaltyMark(position); }
-void WorldMap::setRightPenaltyMark(const Position& position) { _field.setRightPenaltyMark(position); }
+void WorldMap::setLeftPenaltyMark(const Position& position)  { _field.setLeftPenaltyMark(position); geometryUpdated(); }
+void WorldMap::setRightPenaltyMark(const Position& position) { _field.setRightPenaltyMark(position); geometryUpdated(); }
 
-void WorldMap::setFieldCenterRadius(float centerRadius) { _field.setCenterRadius(centerRadius); }
+void WorldMap::setFieldCenterRadius(float centerRadius) { _field.setCenterRadius(centerRadius); geometryUpdated(); }
 
 const Position& WorldMap::fieldTopRightCorner()    const { return(_field.topRightCorner()); }
 const Position& WorldMap::fieldTopLeftCorner()     const { return(_field.topLeftCorner()); }
@@ -845,3 +1832,10 @@ const Position& WorldMap::leftPenaltyMark()  const { return(_field.leftPenaltyMa
 const Position& WorldMap::rightPenaltyMark() const { return(_field.rightPenaltyMark()); }
 
 float WorldMap::fieldCenterRadius() const { return(_field.centerRadius()); }
+
+void WorldMap::setFieldGeometry(const Field& field) {
+    _field = field;
+    geometryUpdated();
+}
+
+const Field WorldMap::fieldGeometry() const { return(_field); }
@@ -0,0 +1,183 @@
+/*** GEARSystem - WorldPublisher implementation
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Includes the class header
+#include <GEARSystem/worldpublisher.hh>
+
+
+// Includes GEARSystem
+#include <GEARSystem/worldmap.hh>
+
+// Inlcudes Qt library
+#include <QtCore/QtCore>
+
+// Includes omniORB 4
+#include <omniORB4/CORBA.h>
+
+// Inlcudes IO streams
+#include <iostream>
+
+
+// Selects namespace
+using namespace GEARSystem;
+using std::cerr;
+using std::endl;
+using std::flush;
+
+
+/*** Constructor
+  ** Description: Creates the publisher, registers it at the world map and starts its thread
+  ** Receives:    [worldMap] The world map
+  ***/
+WorldPublisher::WorldPublisher(const WorldMap* worldMap) {
+    // Initializes the variables
+    _worldMap = worldMap;
+    _running  = true;
+    _subscribers.clear();
+
+    // Creates the locks
+    _publisherLock  = new QMutex();
+    _frameAvailable = new QWaitCondition();
+
+    // Starts the thread and listens to the map
+    start();
+    _worldMap->addListener(this);
+}
+
+/*** Destructor
+  ** Description: Unregisters the publisher, stops its thread and destroys it
+  ** Receives:    Nothing
+  ***/
+WorldPublisher::~WorldPublisher() {
+    // Stops listening to the map
+    _worldMap->removeListener(this);
+
+    // Stops the thread
+    _publisherLock->lock();
+    _running = false;
+    _frameAvailable->wakeAll();
+    _publisherLock->unlock();
+
+    (void) wait();
+
+    // Deletes the locks
+    delete _frameAvailable;
+    delete _publisherLock;
+}
+
+
+/*** Subscribers handling functions
+  ** Description: Adds or removes a remote listener
+  ** Receives:    [name]     The subscriber name
+                  [listener] The remote listener
+  ** Returns:     Nothing
+  ***/
+void WorldPublisher::subscribe(const QString& name, const CORBAInterfaces::WorldListener_var& listener) {
+    QMutexLocker publisherLocker(_publisherLock);
+    _subscribers[name] = listener;
+}
+
+void WorldPublisher::unsubscribe(const QString& name) {
+    QMutexLocker publisherLocker(_publisherLock);
+    (void) _subscribers.remove(name);
+}
+
+/*** 'dropSubscriber' function
+  ** Description: Removes a subscriber that failed, unless it subscribed again meanwhile
+  ** Receives:    [name]     The subscriber name
+                  [listener] The remote listener that failed
+  ** Returns:     Nothing
+  ***/
+void WorldPublisher::dropSubscriber(const QString& name, const CORBAInterfaces::WorldListener_var& listener) {
+    QMutexLocker publisherLocker(_publisherLock);
+
+    // Keeps a new listener subscribed under the same name while the frame was being pushed
+    QHash<QString,CORBAInterfaces::WorldListener_var>::iterator it = _subscribers.find(name);
+    if ((it == _subscribers.end()) || !it.value()->_is_equivalent(listener.in())) {
+        return;
+    }
+
+    (void) _subscribers.erase(it);
+}
+
+/*** 'subscribers' function
+  ** Description: Gets the number of subscribers
+  ** Receives:    Nothing
+  ** Returns:     The number of subscribers
+  ***/
+int WorldPublisher::subscribers() const {
+    QMutexLocker publisherLocker(_publisherLock);
+    return(_subscribers.size());
+}
+
+
+/*** 'frameCommitted' function
+  ** Description: Queues a committed frame to be pushed to the subscribers
+  ** Receives:    [snapshot] The world right after the frame was committed
+  ** Returns:     Nothing
+  ***/
+void WorldPublisher::frameCommitted(const WorldSnapshotPtr& snapshot) {
+    QMutexLocker publisherLocker(_publisherLock);
+
+    // Replaces a frame that wasn't pushed yet
+    if (!_subscribers.isEmpty()) {
+        _pendingFrame = snapshot;
+        _frameAvailable->wakeOne();
+    }
+}
+
+
+/*** 'run' function
+  ** Description: Pushes the queued frames until the publisher is stopped
+  ** Receives:    Nothing
+  ** Returns:     Nothing
+  ***/
+void WorldPublisher::run() {
+    forever {
+        // Waits for a frame
+        _publisherLock->lock();
+        while (_running && !_pendingFrame) {
+            (void) _frameAvailable->wait(_publisherLock);
+        }
+
+        // Leaves if the publisher was stopped
+        if (!_running) {
+            _publisherLock->unlock();
+            break;
+        }
+
+        // Takes the frame and the subscribers
+        WorldSnapshotPtr frame;
+        frame.swap(_pendingFrame);
+        QHash<QString,CORBAInterfaces::WorldListener_var> subscribers = _subscribers;
+        _publisherLock->unlock();
+
+        // Converts the frame once
+        CORBATypes::WorldState state;
+        frame->toCORBA(&state);
+
+        // Pushes it to every subscriber
+        QHashIterator<QString,CORBAInterfaces::WorldListener_var> it(subscribers);
+        while (it.hasNext()) {
+            it.next();
+            try {
+                it.value()->frameCommitted(state);
+            }
+
+            // Drops unreachable subscribers
+            catch (const CORBA::Exception& exception) {
+                #ifdef GSDEBUGMSG
+                cerr << ">> GEARSystem: WorldPublisher::run(): Caught CORBA exception: " << exception._name();
+                cerr << ", dropping subscriber '" << it.key().toStdString() << "'!!" << endl << flush;
+                #endif
+
+                dropSubscriber(it.key(), it.value());
+            }
+        }
+    }
+}
@@ -0,0 +1,301 @@
+/*** GEARSystem - WorldSnapshot implementation
+  ** GEAR - Grupo de Estudos Avancados em Robotica
+  ** Department of Electrical Engineering, University of Sao Paulo
+  ** http://www.sel.eesc.usp.br/gear
+  ** This file is part of the GEARSystem project
+  ***/
+
+
+// Includes the class header
+#include <GEARSystem/worldsnapshot.hh>
+
+
+// Inlcudes Qt library
+#include <QtCore/QtCore>
+
+
+// Selects namespace
+using namespace GEARSystem;
+
+
+/*** Constructor
+  ** Description: Creates an empty snapshot (version 0)
+  ** Receives:    Nothing
+  ***/
+WorldSnapshot::WorldSnapshot() {
+    _version     = 0;
+    _frameId     = 0;
+    _captureTime = 0.0;
+}
+
+/*** Constructor
+  ** Description: Creates a snapshot from a CORBA WorldState
+  ** Receives:    [state] The CORBA WorldState
+  ***/
+WorldSnapshot::WorldSnapshot(const CORBATypes::WorldState& state) {
+    // Sets the version and frame info
+    _version     = state.version;
+    _frameId     = state.frameId;
+    _captureTime = state.captureTime;
+
+    // Creates the teams
+    for (CORBA::ULong i = 0; i < state.teams.length(); i++) {
+        const CORBATypes::TeamInfo& team = state.teams[i];
+        _teams[team.teamNum].name = QString(static_cast<const char*>(team.name));
+    }
+
+    // Sets the players (the servers send them in ascending order, so they are usually appended)
+    for (CORBA::ULong i = 0; i < state.players.length(); i++) {
+        const CORBATypes::PlayerState& player = state.players[i];
+        QHash<uint8,TeamState>::iterator it = _teams.find(player.teamNum);
+        if (it == _teams.end()) {
+            continue;
+        }
+
+        QVector<PlayerState>& players = it.value().players;
+        const int index = playerIndex(players, player.playerNum);
+        if ((index < players.size()) && (players.at(index).playerNum() == player.playerNum)) {
+            players[index] = PlayerState(player);
+        }
+        else {
+            players.insert(index, PlayerState(player));
+        }
+    }
+
+    // Sets the balls
+    for (CORBA::ULong i = 0; i < state.balls.length(); i++) {
+        const CORBATypes::BallState& ball = state.balls[i];
+        (void) _ballsPositions.insert(ball.ballNum, Position(ball.position));
+        (void) _ballsVelocities.insert(ball.ballNum, Velocity(ball.velocity));
+    }
+}
+
+
+/*** 'toCORBA' function
+  ** Description: Copies the snapshot to a CORBA WorldState
+  ** Receives:    [other] The CORBA WorldState
+  ** Returns:     Nothing
+  ***/
+void WorldSnapshot::toCORBA(CORBATypes::WorldState* other) const {
+    // Sets the version and frame info
+    other->version     = _version;
+    other->frameId     = _frameId;
+    other->captureTime = _captureTime;
+
+    // Counts the players
+    const QList<uint8> teamsList = teams();
+    CORBA::ULong nPlayers = 0;
+    for (int i = 0; i < teamsList.size(); i++) {
+        nPlayers += _teams.constFind(teamsList.at(i))->players.size();
+    }
+
+    // Sets the teams and players
+    other->teams.length(teamsList.size());
+    other->players.length(nPlayers);
+    CORBA::ULong index = 0;
+    for (int i = 0; i < teamsList.size(); i++) {
+        const TeamState& team = *(_teams.constFind(teamsList.at(i)));
+        other->teams[i].teamNum = teamsList.at(i);
+        other->teams[i].name    = CORBA::string_dup(team.name.toStdString().c_str());
+
+        for (int j = 0; j < team.players.size(); j++, index++) {
+            team.players.at(j).toCORBA(&other->players[index]);
+        }
+    }
+
+    // Sets the balls
+    const QList<uint8> ballsList = balls();
+    other->balls.length(ballsList.size());
+    for (int i = 0; i < ballsList.size(); i++) {
+        CORBATypes::BallState& ball = other->balls[i];
+        ball.ballNum = ballsList.at(i);
+        _ballsPositions.value(ball.ballNum).toCORBA(&ball.position);
+        _ballsVelocities.value(ball.ballNum).toCORBA(&ball.velocity);
+    }
+}
+
+
+/*** 'version' function
+  ** Description: Gets the world map version this snapshot was taken at
+  ** Receives:    Nothing
+  ** Returns:     The version
+  ***/
+quint64 WorldSnapshot::version() const { return(_version); }
+
+
+/*** Frame info functions
+  ** Description: Gets the number and capture time of the last frame committed before this snapshot
+  ***/
+quint32 WorldSnapshot::frameId()     const { return(_frameId); }
+double  WorldSnapshot::captureTime() const { return(_captureTime); }
+
+
+/*** Teams info functions
+  ** Description: Gets the teams info
+  ** Receives:    [teamNum] The team number
+                  [name]    The team name
+  ** Returns:     The teams list (in ascending order), the team name or the team number
+  ***/
+QList<uint8> WorldSnapshot::teams() const {
+    QList<uint8> teamsList = _teams.keys();
+    std::sort(teamsList.begin(), teamsList.end());
+    return(teamsList);
+}
+
+const QString& WorldSnapshot::teamName(uint8 teamNum) const {
+    QHash<uint8,TeamState>::const_iterator it = _teams.constFind(teamNum);
+    return((it != _teams.constEnd())? it->name : _invalidName);
+}
+
+uint8 WorldSnapshot::teamNumber(const QString& name) const {
+    // Runs the teams searching for the wanted name
+    QHashIterator<uint8,TeamState> it(_teams);
+    while (it.hasNext()) {
+        it.next();
+        if (it.value().name == name) {
+            return(it.key());
+        }
+    }
+
+    // Returns an invalid number
+    return(_invalidNumber);
+}
+
+
+/*** Balls info functions
+  ** Description: Gets the balls info
+  ** Receives:    [ballNum] The ball number
+  ** Returns:     The balls list (in ascending order), the ball position or the ball velocity
+  ***/
+QList<uint8> WorldSnapshot::balls() const {
+    QList<uint8> ballsList = _ballsPositions.keys();
+    std::sort(ballsList.begin(), ballsList.end());
+    return(ballsList);
+}
+
+const Position& WorldSnapshot::ballPosition(uint8 ballNum) const {
+    QHash<uint8,Position>::const_iterator it = _ballsPositions.constFind(ballNum);
+    return((it != _ballsPositions.constEnd())? it.value() : _invalidPosition);
+}
+
+const Velocity& WorldSnapshot::ballVelocity(uint8 ballNum) const {
+    QHash<uint8,Velocity>::const_iterator it = _ballsVelocities.constFind(ballNum);
+    return((it != _ballsVelocities.constEnd())? it.value() : _invalidVelocity);
+}
+
+
+/*** Players info functions
+  ** Description: Gets the player state
+  ** Receives:    [teamNum]   The team number
+                  [playerNum] The player number
+  ** Returns:     The players list (in ascending order) or the player pose, velocity, angular speed, flags and charges
+  ***/
+QList<uint8> WorldSnapshot::players(uint8 teamNum) const {
+    QList<uint8> playersList;
+    QHash<uint8,TeamState>::const_iterator it = _teams.constFind(teamNum);
+    if (it != _teams.constEnd()) {
+        for (int i = 0; i < it->players.size(); i++) {
+            playersList.append(it->players.at(i).playerNum());
+        }
+    }
+    return(playersList);
+}
+
+const Position& WorldSnapshot::playerPosition(uint8 teamNum, uint8 playerNum) const {
+    const PlayerState* player = findPlayer(teamNum, playerNum);
+    return((player != NULL)? player->position() : _invalidPosition);
+}
+
+const Angle& WorldSnapshot::playerOrientation(uint8 teamNum, uint8 playerNum) const {
+    const PlayerState* player = findPlayer(teamNum, playerNum);
+    return((player != NULL)? player->orientation() : _invalidAngle);
+}
+
+const Velocity& WorldSnapshot::playerVelocity(uint8 teamNum, uint8 playerNum) const {
+    const PlayerState* player = findPlayer(teamNum, playerNum);
+    return((player != NULL)? player->velocity() : _invalidVelocity);
+}
+
+const AngularSpeed& WorldSnapshot::playerAngularSpeed(uint8 teamNum, uint8 playerNum) const {
+    const PlayerState* player = findPlayer(teamNum, playerNum);
+    return((player != NULL)? player->angularSpeed() : _invalidAngularSpeed);
+}
+
+bool WorldSnapshot::ballPossession(uint8 teamNum, uint8 playerNum) const {
+    const PlayerState* player = findPlayer(teamNum, playerNum);
+    return((player != NULL)? player->ballPossession() : false);
+}
+
+bool WorldSnapshot::kickEnabled(uint8 teamNum, uint8 playerNum) const {
+    const PlayerState* player = findPlayer(teamNum, playerNum);
+    return((player != NULL)? player->kickEnabled() : false);
+}
+
+bool WorldSnapshot::dribbleEnabled(uint8 teamNum, uint8 playerNum) const {
+    const PlayerState* player = findPlayer(teamNum, playerNum);
+    return((player != NULL)? player->dribbleEnabled() : false);
+}
+
+unsigned char WorldSnapshot::batteryCharge(uint8 teamNum, uint8 playerNum) const {
+    const PlayerState* player = findPlayer(teamNum, playerNum);
+    return((player != NULL)? player->batteryCharge() : 0);
+}
+
+unsigned char WorldSnapshot::capacitorCharge(uint8 teamNum, uint8 playerNum) const {
+    const PlayerState* player = findPlayer(teamNum, playerNum);
+    return((player != NULL)? player->capacitorCharge() : 0);
+}
+
+PlayerState WorldSnapshot::playerState(uint8 teamNum, uint8 playerNum) const {
+    const PlayerState* player = findPlayer(teamNum, playerNum);
+    return((player != NULL)? *player : PlayerState(teamNum, playerNum));
+}
+
+
+/*** 'findPlayer' function
+  ** Description: Finds the state of a player
+  ** Receives:    [teamNum]   The team number
+                  [playerNum] The player number
+  ** Returns:     The player state, or NULL if there is no such player
+  ***/
+const PlayerState* WorldSnapshot::findPlayer(uint8 teamNum, uint8 playerNum) const {
+    QHash<uint8,TeamState>::const_iterator it = _teams.constFind(teamNum);
+    if (it == _teams.constEnd()) {
+        return(NULL);
+    }
+
+    const QVector<PlayerState>& players = it->players;
+    const int index = playerIndex(players, playerNum);
+    return(((index < players.size()) && (players.at(index).playerNum() == playerNum))? &players.at(index) : NULL);
+}
+
+/*** 'playerIndex' function
+  ** Description: Finds where a player is, or would be, in the players of a team
+  ** Receives:    [players]   The players of the team, in ascending player order
+                  [playerNum] The player number
+  ** Returns:     The index of the first player whose number isn't lower than 'playerNum'
+  ***/
+int WorldSnapshot::playerIndex(const QVector<PlayerState>& players, uint8 playerNum) {
+    // Binary searches the players
+    int low  = 0;
+    int high = players.size();
+    while (low < high) {
+        const int middle = (low + high)/2;
+        if (players.at(middle).playerNum() < playerNum) {
+            low = middle + 1;
+        }
+        else {
+            high = middle;
+        }
+    }
+
+    return(low);
+}
+
+
+/*** 'field' function
+  ** Description: Gets the field info
+  ** Receives:    Nothing
+  ** Returns:     The field
+  ***/
+const Field& WorldSnapshot::field() const { return(_field); }